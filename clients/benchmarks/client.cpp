@@ -38,12 +38,20 @@
 #include <cctype>
 #include <cstdio>
 #include <cstring>
+#include <fstream>
+#include <functional>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <set>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 typedef int hipblas_int;
@@ -57,6 +65,326 @@ int hipblas_bench_datafile()
     return ret;
 }
 
+// Arguments of a hipblas-bench command line logged with HIPBLAS_LAYER=2. Other log lines are
+// not calls, and return false.
+bool hipblas_bench_trace_call(const std::string& line, std::string& args)
+{
+    std::istringstream tokens(line);
+    std::string        token;
+    tokens >> token;
+    auto ends_with = [&](const char* name) {
+        size_t len = strlen(name);
+        return token.size() >= len && !token.compare(token.size() - len, len, name);
+    };
+    if(!ends_with("hipblas-bench") && !ends_with("hipblas_v2-bench"))
+        return false;
+
+    args.clear();
+    while(tokens >> token)
+        args += (args.empty() ? "" : " ") + token;
+    return true;
+}
+
+// A distinct call of a replayed trace: its hipblas-bench arguments, how many times it was
+// called and the time spent in those calls
+struct replay_signature
+{
+    std::string line;
+    uint64_t    count   = 0;
+    double      time_us = 0;
+};
+
+// Rerun the hipblas-bench command lines logged with HIPBLAS_LAYER=2, in order, and report the
+// time of each distinct call and of the whole trace. With collapse, each distinct call is run
+// once and its time weighted by its number of calls.
+int hipblas_bench_replay(const std::string&                                     path,
+                         bool                                                   collapse,
+                         const std::function<Arguments(const std::string& line)>& parse_call)
+{
+    std::ifstream trace(path);
+    if(!trace)
+        throw std::invalid_argument("Cannot open --replay file " + path);
+
+    std::vector<replay_signature> signatures;
+    std::vector<size_t>           calls;
+    std::map<std::string, size_t> signature_index;
+
+    std::string line, args;
+    while(std::getline(trace, line))
+    {
+        if(!hipblas_bench_trace_call(line, args))
+            continue;
+
+        auto it = signature_index.emplace(args, signatures.size()).first;
+        if(it->second == signatures.size())
+            signatures.push_back({args});
+        signatures[it->second].count++;
+        calls.push_back(it->second);
+    }
+
+    auto run = [&](replay_signature& signature, double weight) {
+        Arguments arg = parse_call(signature.line);
+        ArgumentModel_set_log_time_us(ArgumentLogging::NA_value);
+        run_bench_test(arg, 0, 1);
+        double time_us = ArgumentModel_get_log_time_us();
+        if(time_us != ArgumentLogging::NA_value)
+            signature.time_us += time_us * weight;
+    };
+
+    if(collapse)
+        for(replay_signature& signature : signatures)
+            run(signature, signature.count);
+    else
+        for(size_t call : calls)
+            run(signatures[call], 1);
+    test_cleanup::cleanup();
+
+    double total_us = 0;
+    for(const replay_signature& signature : signatures)
+        total_us += signature.time_us;
+
+    std::vector<const replay_signature*> sorted;
+    for(const replay_signature& signature : signatures)
+        sorted.push_back(&signature);
+    std::stable_sort(sorted.begin(), sorted.end(), [](auto a, auto b) {
+        return a->time_us > b->time_us;
+    });
+
+    std::cout << "\nreplay of " << path << ": " << calls.size() << " calls, " << signatures.size()
+              << " distinct\n";
+    std::cout << "calls,hipblas-us,percent,arguments\n";
+    for(const replay_signature* signature : sorted)
+        std::cout << signature->count << ", " << signature->time_us << ", "
+                  << (total_us > 0 ? 100 * signature->time_us / total_us : 0) << ", "
+                  << signature->line << "\n";
+    std::cout << "total," << total_us << std::endl;
+    return 0;
+}
+
+// Types of a GemmEx call as the tuning file names them, and as hipblasGemmExGetSolutionsByType
+// takes them
+static const std::map<std::string, hipDataType> tune_datatypes = {{"f16_r", HIP_R_16F},
+                                                                  {"f32_r", HIP_R_32F},
+                                                                  {"f64_r", HIP_R_64F},
+                                                                  {"bf16_r", HIP_R_16BF},
+                                                                  {"i8_r", HIP_R_8I},
+                                                                  {"i32_r", HIP_R_32I},
+                                                                  {"f32_c", HIP_C_32F},
+                                                                  {"f64_c", HIP_C_64F}};
+
+static const std::map<std::string, hipblasComputeType_t> tune_computetypes
+    = {{"f16_r", HIPBLAS_COMPUTE_16F},
+       {"f32_r", HIPBLAS_COMPUTE_32F},
+       {"f32_c", HIPBLAS_COMPUTE_32F},
+       {"f64_r", HIPBLAS_COMPUTE_64F},
+       {"f64_c", HIPBLAS_COMPUTE_64F},
+       {"i32_r", HIPBLAS_COMPUTE_32I}};
+
+// Precision the backend computes a GemmEx call in, which is what the tuning file names
+std::string hipblas_bench_tune_compute_type(const Arguments& arg)
+{
+#ifdef HIPBLAS_V2
+    std::string c_type  = hipblas_datatype2string(arg.c_type);
+    bool        complex = c_type.size() > 2 && !c_type.compare(c_type.size() - 2, 2, "_c");
+    switch(arg.compute_type_gemm)
+    {
+    case HIPBLAS_COMPUTE_16F:
+        return "f16_r";
+    case HIPBLAS_COMPUTE_32F:
+        return complex ? "f32_c" : "f32_r";
+    case HIPBLAS_COMPUTE_64F:
+        return complex ? "f64_c" : "f64_r";
+    case HIPBLAS_COMPUTE_32I:
+        return "i32_r";
+    default:
+        return "invalid";
+    }
+#else
+    return hipblas_datatype2string(arg.compute_type);
+#endif
+}
+
+// Runs the calls of a sweep without printing their results
+struct tune_null_buffer : std::streambuf
+{
+    int overflow(int c) override
+    {
+        return c;
+    }
+};
+
+// For each distinct GemmEx shape of calls, time every solution the backend has for its types
+// and write those faster than the default choice to the tuning file at path, which
+// HIPBLAS_GEMM_TUNING_FILE then hands to the library. Other functions are skipped.
+int hipblas_bench_tune(const std::string& path, const std::vector<Arguments>& calls)
+{
+    std::ofstream file(path);
+    if(!file)
+        throw std::invalid_argument("Cannot open --tune file " + path);
+    file << "# hipBLAS GEMM tuning file written by hipblas-bench --tune\n"
+         << "function,transA,transB,m,n,k,lda,ldb,ldc,batch_count,a_type,b_type,c_type,"
+            "compute_type,solution_index,hipblas-us,default-us"
+         << std::endl;
+
+    std::cout << "\ntuning of " << calls.size() << " calls into " << path << "\n";
+    std::cout << "function,transA,transB,M,N,K,batch_count,solutions,solution_index,hipblas-us,"
+                 "default-us\n";
+
+    hipblasLocalHandle    handle;
+    std::set<std::string> tuned;
+    for(Arguments call : calls)
+    {
+        std::string function = call.function;
+        if(function != "gemm_ex" && function != "gemm_batched_ex"
+           && function != "gemm_strided_batched_ex")
+            continue;
+
+        std::string a_type       = hipblas_datatype2string(call.a_type);
+        std::string b_type       = hipblas_datatype2string(call.b_type);
+        std::string c_type       = hipblas_datatype2string(call.c_type);
+        std::string compute_type = hipblas_bench_tune_compute_type(call);
+        if(!tune_datatypes.count(a_type) || !tune_datatypes.count(c_type)
+           || !tune_computetypes.count(compute_type))
+            continue;
+
+        // Each distinct shape is tuned once
+        int64_t     batch_count = function == "gemm_ex" ? 1 : call.batch_count;
+        std::string shape       = function + "," + call.transA + "," + call.transB + ","
+                            + std::to_string(call.M) + "," + std::to_string(call.N) + ","
+                            + std::to_string(call.K) + "," + std::to_string(call.lda) + ","
+                            + std::to_string(call.ldb) + "," + std::to_string(call.ldc) + ","
+                            + std::to_string(batch_count) + "," + a_type + "," + b_type + ","
+                            + c_type + "," + compute_type;
+        if(!tuned.insert(shape).second)
+            continue;
+
+        int             count  = 0;
+        hipblasStatus_t status = hipblasGemmExGetSolutionsByType(handle,
+                                                                 tune_datatypes.at(a_type),
+                                                                 tune_datatypes.at(c_type),
+                                                                 tune_computetypes.at(compute_type),
+                                                                 nullptr,
+                                                                 &count);
+        std::vector<int32_t> solutions(count);
+        if(status == HIPBLAS_STATUS_SUCCESS && count)
+            status = hipblasGemmExGetSolutionsByType(handle,
+                                                     tune_datatypes.at(a_type),
+                                                     tune_datatypes.at(c_type),
+                                                     tune_computetypes.at(compute_type),
+                                                     solutions.data(),
+                                                     &count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            std::cerr << "hipblas-bench: cannot list the solutions of " << function << ": "
+                      << hipblasStatusToString(status) << std::endl;
+            return -1;
+        }
+
+        // Time the default choice first
+        call.solution_index = 0;
+        call.norm_check     = 0;
+        auto time_us        = [&]() {
+            tune_null_buffer quiet;
+            std::streambuf*  out = std::cout.rdbuf(&quiet);
+            ArgumentModel_set_log_time_us(ArgumentLogging::NA_value);
+            run_bench_test(call, 0, 1);
+            std::cout.rdbuf(out);
+            return ArgumentModel_get_log_time_us();
+        };
+        double default_us = time_us();
+        if(default_us == ArgumentLogging::NA_value)
+            continue;
+
+        // Solutions that do not apply to the shape report no time
+        int32_t best_index = 0;
+        double  best_us    = default_us;
+        for(int32_t solution : solutions)
+        {
+            call.solution_index = solution;
+            double solution_us  = time_us();
+            if(solution_us != ArgumentLogging::NA_value && solution_us < best_us)
+            {
+                best_index = solution;
+                best_us    = solution_us;
+            }
+        }
+
+        std::cout << function << "," << call.transA << "," << call.transB << "," << call.M << ","
+                  << call.N << "," << call.K << "," << batch_count << "," << solutions.size()
+                  << "," << best_index << "," << best_us << "," << default_us << std::endl;
+        if(best_index)
+            file << shape << "," << best_index << "," << best_us << "," << default_us
+                 << std::endl;
+    }
+    test_cleanup::cleanup();
+    return 0;
+}
+
+// Sizes of a --sweep, from arg.start to arg.end in steps adding or multiplying by arg.step
+std::vector<int64_t> hipblas_bench_sweep_sizes(const Arguments& arg, bool geometric)
+{
+    if(arg.start < 1 || arg.end < arg.start || arg.step < (geometric ? 2 : 1))
+        throw std::invalid_argument(geometric ? "--sweep needs 0 < --start <= --end, --step >= 2"
+                                              : "--sweep needs 0 < --start <= --end, --step >= 1");
+
+    std::vector<int64_t> sizes;
+    for(int64_t size = arg.start; size <= arg.end;)
+    {
+        sizes.push_back(size);
+        size = geometric ? size * arg.step : size + arg.step;
+    }
+    return sizes;
+}
+
+// Run arg at each size of a --sweep of the dimensions named in dims, a subset of "mnk". The
+// leading dimensions grow to the largest dimension of each size. A run of the largest size
+// without hot iterations first allocates the device buffers, which the device pool then keeps
+// for the runs of every size, so they are not allocated again.
+int hipblas_bench_sweep(const Arguments& arg, std::string dims, bool geometric)
+{
+    std::transform(dims.begin(), dims.end(), dims.begin(), ::tolower);
+    if(dims.empty() || dims.find_first_not_of("mnk") != std::string::npos)
+        throw std::invalid_argument("Invalid value for --sweep " + dims);
+
+    auto point = [&](int64_t size) {
+        Arguments call = arg;
+        if(dims.find('m') != std::string::npos)
+            call.M = size;
+        if(dims.find('n') != std::string::npos)
+            call.N = size;
+        if(dims.find('k') != std::string::npos)
+            call.K = size;
+
+        int64_t ld = std::max({call.M, call.N, call.K});
+        call.lda   = std::max(call.lda, ld);
+        call.ldb   = std::max(call.ldb, ld);
+        call.ldc   = std::max(call.ldc, ld);
+        call.ldd   = std::max(call.ldd, ld);
+        return call;
+    };
+
+    std::vector<int64_t> sizes = hipblas_bench_sweep_sizes(arg, geometric);
+    hipblas_device_pool_enable(true);
+    ArgumentModel_set_log_repeated_names(false);
+
+    Arguments largest  = point(sizes.back());
+    largest.cold_iters = 0;
+    largest.iters      = 0;
+    run_bench_test(largest, 0, 1);
+
+    int ret = 0;
+    for(int64_t size : sizes)
+    {
+        Arguments call = point(size);
+        ret |= run_bench_test(call, 0, 1);
+    }
+
+    ArgumentModel_set_log_repeated_names(true);
+    hipblas_device_pool_enable(false);
+    test_cleanup::cleanup();
+    return ret;
+}
+
 void thread_init_device(int id, const Arguments& arg)
 {
     int count;
@@ -112,6 +440,140 @@ int run_bench_multi_gpu_test(int parallel_devices, Arguments& arg)
     return 0;
 }
 
+// Run the calls on streams threads of the current device at once, each with its own handle on
+// its own stream, stream i running calls[i % calls.size()]. The hot loops of the streams start
+// together; each stream prints its own row, and a summary row gives the throughput of the
+// streams together over the span from the first start to the last end, the latency of a call
+// on the fastest and slowest stream, and the overlap: the sum of the GPU times of the hot
+// loops over the span, from 1 for streams that ran one after the other to the number of
+// streams for streams that ran fully at once.
+int hipblas_bench_streams(int streams, const std::vector<Arguments>& calls)
+{
+    if(streams < 1)
+        throw std::invalid_argument("Invalid value for --streams " + std::to_string(streams));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    // load the kernels of each call before timing them concurrently
+    for(const Arguments& call : calls)
+    {
+        Arguments warmup  = call;
+        warmup.cold_iters = 1;
+        warmup.iters      = 0;
+        run_bench_test(warmup, 0, 1);
+    }
+
+    auto run_stream = [&](int index) {
+        CHECK_HIP_ERROR(hipSetDevice(device));
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        hipblas_set_local_stream(stream);
+        hipblas_stream_group_join(index, stream);
+
+        Arguments call = calls[index % calls.size()];
+        run_bench_test(call, 0, 1);
+
+        hipblas_stream_group_leave();
+        hipblas_set_local_stream(nullptr);
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    };
+
+    ArgumentModel_set_log_repeated_names(false);
+    hipblas_stream_group_begin(streams);
+
+    auto thread = std::make_unique<std::thread[]>(streams);
+    for(int index = 0; index < streams; ++index)
+        thread[index] = std::thread(run_stream, index);
+    for(int index = 0; index < streams; ++index)
+        thread[index].join();
+
+    std::vector<hipblas_stream_span> spans = hipblas_stream_group_end();
+    ArgumentModel_set_log_repeated_names(true);
+    test_cleanup::cleanup();
+
+    // times of the streams that timed their hot loop, from the first start to the last end
+    const double infinity = std::numeric_limits<double>::infinity();
+    double       start_us = infinity;
+    double       end_us   = -infinity;
+    double       busy_us  = 0;
+    double       call_min = infinity;
+    double       call_max = -infinity;
+    double       gflop    = 0;
+    double       gbyte    = 0;
+    int          timed    = 0;
+    for(const hipblas_stream_span& span : spans)
+    {
+        if(!span.recorded || !span.calls)
+            continue;
+        double loop_us = span.end_us - span.start_us;
+        start_us       = std::min(start_us, span.start_us);
+        end_us         = std::max(end_us, span.end_us);
+        busy_us += loop_us;
+        call_min = std::min(call_min, loop_us / span.calls);
+        call_max = std::max(call_max, loop_us / span.calls);
+        gflop += span.gflop;
+        gbyte += span.gbyte;
+        timed++;
+    }
+    if(!timed || end_us <= start_us)
+    {
+        std::cerr << "--streams: no stream timed its hot loop" << std::endl;
+        return 0;
+    }
+
+    double total_us = end_us - start_us;
+    std::vector<std::pair<const char*, double>> summary
+        = {{"streams", timed},
+           {"hipblas-Gflops", gflop / total_us * 1e6},
+           {"hipblas-GB/s", gbyte / total_us * 1e6},
+           {"span-us", total_us},
+           {"stream-us-min", call_min},
+           {"stream-us-max", call_max},
+           {"overlap", busy_us / total_us}};
+
+    std::cout << "\nstreams of " << calls.size() << " distinct calls on device " << device << "\n";
+    for(size_t i = 0; i < summary.size(); i++)
+        std::cout << (i ? "," : "") << summary[i].first;
+    std::cout << "\n";
+    for(size_t i = 0; i < summary.size(); i++)
+        std::cout << (i ? ", " : "") << summary[i].second;
+    std::cout << std::endl;
+
+    ArgumentModel_log_output(calls[0], summary);
+    return 0;
+}
+
+// Run arg twice on a stream of its own: a row of eager calls, then a row where the iters hot
+// calls are captured into a HIP graph, which is replayed. The graph row times the calls without
+// their launch overhead, and reports capture_failed if the function synchronizes, allocates or
+// does anything else stream capture prohibits during its hot calls.
+int hipblas_bench_graph(const Arguments& arg)
+{
+    if(arg.iters < 1)
+        throw std::invalid_argument("--graph needs --iters >= 1");
+
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+    hipblas_set_local_stream(stream);
+    ArgumentModel_set_log_repeated_names(false);
+
+    int ret = 0;
+    for(hipblas_graph_mode mode : {hipblas_graph_mode::eager, hipblas_graph_mode::replay})
+    {
+        Arguments call = arg;
+        hipblas_set_graph_mode(mode, call.iters);
+        ret |= run_bench_test(call, 0, 1);
+    }
+
+    hipblas_set_graph_mode(hipblas_graph_mode::off, 0);
+    ArgumentModel_set_log_repeated_names(true);
+    hipblas_set_local_stream(nullptr);
+    test_cleanup::cleanup();
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return ret;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -142,11 +604,21 @@ try
     std::string compute_type;
     std::string compute_type_gemm;
     std::string initialization;
+    std::string replay;
+    std::string tune;
+    std::string output;
+    std::string output_format;
+    std::string sweep;
+    std::string sweep_mode;
     hipblas_int device_id;
     hipblas_int parallel_devices;
+    hipblas_int streams;
+    std::string stream_calls;
 
     bool datafile            = hipblas_parse_data(argc, argv);
     bool atomics_not_allowed = false;
+    bool replay_collapse     = false;
+    bool graph               = false;
     bool log_function_name   = false;
     bool log_datatype        = false;
 
@@ -156,44 +628,44 @@ try
     desc.add_options()
 
         ("sizem,m",
-         value<hipblas_int>(&arg.M)->default_value(128),
+         value<int64_t>(&arg.M)->default_value(128),
          "Specific matrix size: sizem is only applicable to BLAS-2 & BLAS-3: the number of "
          "rows or columns in matrix.")
 
         ("sizen,n",
-         value<hipblas_int>(&arg.N)->default_value(128),
+         value<int64_t>(&arg.N)->default_value(128),
          "Specific matrix/vector size: BLAS-1: the length of the vector. BLAS-2 & "
          "BLAS-3: the number of rows or columns in matrix")
 
         ("sizek,k",
-         value<hipblas_int>(&arg.K)->default_value(128),
+         value<int64_t>(&arg.K)->default_value(128),
          "Specific matrix size: BLAS-2: the number of sub or super-diagonals of A. BLAS-3: "
          "the number of columns in A and rows in B.")
 
         ("kl",
-         value<hipblas_int>(&arg.KL)->default_value(128),
+         value<int64_t>(&arg.KL)->default_value(128),
          "Specific matrix size: kl is only applicable to BLAS-2: The number of sub-diagonals "
          "of the banded matrix A.")
 
         ("ku",
-         value<hipblas_int>(&arg.KU)->default_value(128),
+         value<int64_t>(&arg.KU)->default_value(128),
          "Specific matrix size: ku is only applicable to BLAS-2: The number of super-diagonals "
          "of the banded matrix A.")
 
         ("lda",
-         value<hipblas_int>(&arg.lda)->default_value(128),
+         value<int64_t>(&arg.lda)->default_value(128),
          "Leading dimension of matrix A, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldb",
-         value<hipblas_int>(&arg.ldb)->default_value(128),
+         value<int64_t>(&arg.ldb)->default_value(128),
          "Leading dimension of matrix B, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldc",
-         value<hipblas_int>(&arg.ldc)->default_value(128),
+         value<int64_t>(&arg.ldc)->default_value(128),
          "Leading dimension of matrix C, is only applicable to BLAS-2 & BLAS-3.")
 
         ("ldd",
-         value<hipblas_int>(&arg.ldd)->default_value(128),
+         value<int64_t>(&arg.ldd)->default_value(128),
          "Leading dimension of matrix D, is only applicable to BLAS-EX ")
 
         ("stride_a",
@@ -227,11 +699,11 @@ try
          "BLAS_2: leading dimension.")
 
         ("incx",
-         value<hipblas_int>(&arg.incx)->default_value(1),
+         value<int64_t>(&arg.incx)->default_value(1),
          "increment between values in x vector")
 
         ("incy",
-         value<hipblas_int>(&arg.incy)->default_value(1),
+         value<int64_t>(&arg.incy)->default_value(1),
          "increment between values in y vector")
 
         ("alpha",
@@ -304,12 +776,34 @@ try
          "U = unit diagonal, N = non unit diagonal. Only applicable to certain routines") // xtrsm xtrsm_ex xtrsv xtrmm
 
         ("batch_count",
-         value<hipblas_int>(&arg.batch_count)->default_value(1),
+         value<int64_t>(&arg.batch_count)->default_value(1),
          "Number of matrices. Only applicable to batched and strided_batched routines")
 
+        ("group_count",
+         value<int>(&arg.group_count)->default_value(1),
+         "Number of groups of differently sized matrices, each holding batch_count matrices. "
+         "Only applicable to gemm_grouped_batched_ex")
+
+        ("activation",
+         value<char>(&arg.activation)->default_value('N'),
+         "N = none, R = relu, G = gelu. Only applicable to gemm_ex epilogues")
+
+        ("scale_mode",
+         value<char>(&arg.scale_mode)->default_value('N'),
+         "N = none, R = scale rows, C = scale columns. Only applicable to gemm_ex epilogues")
+
+        ("bias",
+         bool_switch(&arg.bias)->default_value(false),
+         "Add a bias vector. Only applicable to gemm_ex epilogues")
+
+        ("unfused",
+         bool_switch(&arg.unfused)->default_value(false),
+         "Time the epilogue as separate calls after the GEMM. Only applicable to gemm_ex epilogues")
+
         ("inplace",
          value<bool>(&arg.inplace)->default_value(false),
-         "Whether or not to use the in place version of the algorithm. Only applicable to trmm routines")
+         "Whether or not to use the in place version of the algorithm. Only applicable to trmm "
+         "routines, and to gemm_ex epilogues where it writes C instead of D")
 
         ("verify,v",
          value<hipblas_int>(&arg.norm_check)->default_value(0),
@@ -323,13 +817,34 @@ try
          value<hipblas_int>(&arg.cold_iters)->default_value(2),
          "Cold Iterations to run before entering the timing loop")
 
+        ("iteration_stats",
+         bool_switch(&arg.iteration_stats)->default_value(false),
+         "Time each hot iteration on the GPU, in a second pass of the timing loop, and report "
+         "the min, median, mean, p90, p99 and stddev of those times")
+
+        ("outlier_threshold",
+         value<double>(&arg.outlier_threshold)->default_value(0),
+         "Leave hot iterations further than this many median absolute deviations from the "
+         "median out of the --iteration_stats statistics; 0 keeps them all")
+
+        ("flush_batch_count",
+         value<int64_t>(&arg.flush_batch_count)->default_value(1),
+         "Number of copies of the operands that the hot iterations rotate through, so that "
+         "they start with cold caches. Only applicable to gemm, gemm_ex and their strided "
+         "batched variants")
+
+        ("flush_memory_size",
+         value<size_t>(&arg.flush_memory_size)->default_value(0),
+         "Bytes of operand copies for the hot iterations to rotate through, such as the size "
+         "of the device caches; overrides --flush_batch_count")
+
         ("algo",
          value<uint32_t>(&arg.algo)->default_value(0),
          "extended precision gemm algorithm")
 
         ("solution_index",
          value<int32_t>(&arg.solution_index)->default_value(0),
-         "extended precision gemm solution index")
+         "extended precision gemm solution index, set on the handle; 0 for the default choice")
 
         ("flags",
          value<uint32_t>(&arg.flags)->default_value(0),
@@ -339,6 +854,11 @@ try
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
 
+        ("workspace",
+         value<size_t>(&arg.user_allocated_workspace)->default_value(0),
+         "Size in bytes of a device workspace allocated by the client and passed to "
+         "hipblasSetWorkspace. 0 lets the library manage its own workspace (default: 0)")
+
         ("device",
          value<hipblas_int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
@@ -347,6 +867,63 @@ try
          value<hipblas_int>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("streams",
+         value<hipblas_int>(&streams)->default_value(0),
+         "Run the function on this many streams of the device at once, each with its own "
+         "handle, and report the throughput of the streams together and the latency of each")
+
+        ("stream_calls",
+         value<std::string>(&stream_calls),
+         "File of hipblas-bench options, one call per line, that the --streams run in turn "
+         "instead of the call of the command line, to mix workloads. Options given on the "
+         "command line apply to every call unless the call sets them. Without --streams, each "
+         "call runs on a stream of its own")
+
+        ("graph",
+         bool_switch(&graph)->default_value(false),
+         "Time the function eagerly, then with its hot calls captured into a HIP graph that is "
+         "replayed, printing a row for each. The function fails the capture if its hot calls "
+         "synchronize or allocate memory")
+
+        ("replay",
+         value<std::string>(&replay),
+         "Rerun the hipblas-bench command lines in a file logged with HIPBLAS_LAYER=2 and report "
+         "the time of each distinct call and of the whole file. Options given on the command "
+         "line apply to every call unless the call sets them")
+
+        ("replay_collapse",
+         bool_switch(&replay_collapse)->default_value(false),
+         "Run each distinct call of --replay once, weighting its time by its number of calls")
+
+        ("tune",
+         value<std::string>(&tune),
+         "Time every solution of the backend for each gemm_ex, gemm_batched_ex and "
+         "gemm_strided_batched_ex shape of the --yaml file, of the --replay file or of the "
+         "command line, and write those faster than the default to this tuning file. Setting "
+         "HIPBLAS_GEMM_TUNING_FILE to it makes the library run them. Only applicable to rocBLAS")
+
+        ("sweep",
+         value<std::string>(&sweep),
+         "Run the function once for each size from --start to --end, setting to it the "
+         "dimensions named: m, n, k or any combination, such as mnk. Device buffers are "
+         "allocated once, at the largest size, and one result row is printed per size")
+
+        ("sweep_mode",
+         value<std::string>(&sweep_mode)->default_value("linear"),
+         "Step of --sweep: linear adds --step to the size, geometric multiplies it by --step")
+
+        ("start",
+         value<int>(&arg.start)->default_value(1024),
+         "First size of --sweep")
+
+        ("end",
+         value<int>(&arg.end)->default_value(10240),
+         "Last size of --sweep, included if a step reaches it")
+
+        ("step",
+         value<int>(&arg.step)->default_value(1000),
+         "Increment, or factor with --sweep_mode geometric, between the sizes of --sweep")
+
         // ("c_noalias_d",
         //  bool_switch(&arg.c_noalias_d)->default_value(false),
         //  "C and D are stored in separate memory")
@@ -359,6 +936,15 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("output",
+         value<std::string>(&output),
+         "Append a record of each run, with every argument, the device, the library versions "
+         "and the performance, to this file")
+
+        ("format",
+         value<std::string>(&output_format)->default_value("json"),
+         "Format of the --output records: json (one object per line) or csv")
+
         ("fortran",
          bool_switch(&arg.fortran)->default_value(false),
          "Run using Fortran interface")
@@ -395,6 +981,34 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    if(output_format != "json" && output_format != "csv")
+        throw std::invalid_argument("Invalid value for --format " + output_format);
+    ArgumentModel_set_log_output(output, output_format == "json");
+
+    // The run modes each replace the plain run of the call, so a mode given with another one it
+    // does not build on is an error rather than silently ignored
+    using option_given = std::pair<const char*, bool>;
+
+    auto exclusive = [](const option_given& mode, std::initializer_list<option_given> others) {
+        if(mode.second)
+            for(const option_given& other : others)
+                if(other.second)
+                    throw std::invalid_argument(std::string(mode.first) + " cannot be used with "
+                                                + other.first);
+    };
+    const option_given yaml_given{"--yaml", datafile};
+    const option_given replay_given{"--replay", !replay.empty()};
+    const option_given tune_given{"--tune", !tune.empty()};
+    const option_given sweep_given{"--sweep", !sweep.empty()};
+    const option_given devices_given{"--parallel_devices", parallel_devices != 0};
+    const option_given streams_given{streams ? "--streams" : "--stream_calls",
+                                     streams || !stream_calls.empty()};
+    exclusive(replay_given, {yaml_given});
+    exclusive(sweep_given, {yaml_given, replay_given, tune_given, devices_given});
+    exclusive(streams_given, {yaml_given, replay_given, tune_given, sweep_given, devices_given});
+    exclusive({"--graph", graph},
+              {yaml_given, replay_given, tune_given, sweep_given, streams_given, devices_given});
+
     // Device Query
     hipblas_int device_count = query_device_property();
 
@@ -403,50 +1017,159 @@ try
         throw std::invalid_argument("Invalid Device ID");
     set_device(device_id);
 
+    if(datafile && !tune.empty())
+    {
+        std::vector<Arguments> calls;
+        for(Arguments call : HipBLAS_TestData())
+            calls.push_back(call);
+        return hipblas_bench_tune(tune, calls);
+    }
     if(datafile)
         return hipblas_bench_datafile();
 
-    std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
-    auto prec = string2hipblas_datatype(precision);
-    if(prec == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --precision " + precision);
-
-    arg.a_type = a_type == "" ? prec : string2hipblas_datatype(a_type);
-    if(arg.a_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --a_type " + a_type);
-
-    arg.b_type = b_type == "" ? prec : string2hipblas_datatype(b_type);
-    if(arg.b_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --b_type " + b_type);
-
-    arg.c_type = c_type == "" ? prec : string2hipblas_datatype(c_type);
-    if(arg.c_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --c_type " + c_type);
-
-    arg.d_type = d_type == "" ? prec : string2hipblas_datatype(d_type);
-    if(arg.d_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --d_type " + d_type);
+    // Convert the options naming types and the function into arg
+    auto resolve_arguments = [&]() {
+        std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
+        auto prec = string2hipblas_datatype(precision);
+        if(prec == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --precision " + precision);
+
+        arg.a_type = a_type == "" ? prec : string2hipblas_datatype(a_type);
+        if(arg.a_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --a_type " + a_type);
+
+        arg.b_type = b_type == "" ? prec : string2hipblas_datatype(b_type);
+        if(arg.b_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --b_type " + b_type);
+
+        arg.c_type = c_type == "" ? prec : string2hipblas_datatype(c_type);
+        if(arg.c_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --c_type " + c_type);
+
+        arg.d_type = d_type == "" ? prec : string2hipblas_datatype(d_type);
+        if(arg.d_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --d_type " + d_type);
+
+        arg.compute_type = compute_type == "" ? prec : string2hipblas_datatype(compute_type);
+        if(arg.compute_type == HIPBLAS_DATATYPE_INVALID)
+            throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+
+        arg.compute_type_gemm = string2hipblas_computetype(compute_type_gemm);
+
+        arg.initialization = string2hipblas_initialization(initialization);
+        if(arg.initialization == static_cast<hipblas_initialization>(0)) // invalid enum
+            throw std::invalid_argument("Invalid value for --initialization " + initialization);
+
+        if(arg.M < 0)
+            throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
+        if(arg.N < 0)
+            throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
+        if(arg.K < 0)
+            throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+
+        int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
+        if(copied <= 0 || copied >= sizeof(arg.function))
+            throw std::invalid_argument("Invalid value for --function");
+    };
+
+    // Options of a logged call on top of those of the command line
+    auto command_line = std::tie(arg,
+                                 function,
+                                 precision,
+                                 a_type,
+                                 b_type,
+                                 c_type,
+                                 d_type,
+                                 compute_type,
+                                 compute_type_gemm,
+                                 initialization);
+    const auto defaults = std::make_tuple(arg,
+                                          function,
+                                          precision,
+                                          a_type,
+                                          b_type,
+                                          c_type,
+                                          d_type,
+                                          compute_type,
+                                          compute_type_gemm,
+                                          initialization);
+
+    auto parse_call = [&](const std::string& line) {
+        command_line = defaults;
+
+        std::istringstream       tokens(line);
+        std::vector<std::string> args{"hipblas-bench"};
+        for(std::string token; tokens >> token;)
+            args.push_back(token);
+        std::vector<char*> call_argv;
+        for(std::string& token : args)
+            call_argv.push_back(&token[0]);
+
+        variables_map call_vm;
+        store(parse_command_line(int(call_argv.size()), call_argv.data(), desc), call_vm);
+        resolve_arguments();
+        return arg;
+    };
+
+    if(!tune.empty())
+    {
+        // The distinct calls of the --replay file, or the call of the command line
+        std::vector<Arguments> calls;
+        if(!replay.empty())
+        {
+            std::ifstream trace(replay);
+            if(!trace)
+                throw std::invalid_argument("Cannot open --replay file " + replay);
+            std::set<std::string> distinct;
+            for(std::string line, args; std::getline(trace, line);)
+                if(hipblas_bench_trace_call(line, args) && distinct.insert(args).second)
+                    calls.push_back(parse_call(args));
+        }
+        else
+        {
+            resolve_arguments();
+            calls.push_back(arg);
+        }
+        return hipblas_bench_tune(tune, calls);
+    }
 
-    arg.compute_type = compute_type == "" ? prec : string2hipblas_datatype(compute_type);
-    if(arg.compute_type == HIPBLAS_DATATYPE_INVALID)
-        throw std::invalid_argument("Invalid value for --compute_type " + compute_type);
+    if(!replay.empty())
+        return hipblas_bench_replay(replay, replay_collapse, parse_call);
 
-    arg.compute_type_gemm = string2hipblas_computetype(compute_type_gemm);
+    if(streams || !stream_calls.empty())
+    {
+        // The calls of the --stream_calls file, or the call of the command line
+        std::vector<Arguments> calls;
+        if(!stream_calls.empty())
+        {
+            std::ifstream file(stream_calls);
+            if(!file)
+                throw std::invalid_argument("Cannot open --stream_calls file " + stream_calls);
+            for(std::string line; std::getline(file, line);)
+                if(line.find_first_not_of(" \t\r") != std::string::npos && line[0] != '#')
+                    calls.push_back(parse_call(line));
+            if(calls.empty())
+                throw std::invalid_argument("No calls in --stream_calls file " + stream_calls);
+        }
+        else
+        {
+            resolve_arguments();
+            calls.push_back(arg);
+        }
+        return hipblas_bench_streams(streams ? streams : int(calls.size()), calls);
+    }
 
-    arg.initialization = string2hipblas_initialization(initialization);
-    if(arg.initialization == static_cast<hipblas_initialization>(0)) // invalid enum
-        throw std::invalid_argument("Invalid value for --initialization " + initialization);
+    resolve_arguments();
 
-    if(arg.M < 0)
-        throw std::invalid_argument("Invalid value for -m " + std::to_string(arg.M));
-    if(arg.N < 0)
-        throw std::invalid_argument("Invalid value for -n " + std::to_string(arg.N));
-    if(arg.K < 0)
-        throw std::invalid_argument("Invalid value for -k " + std::to_string(arg.K));
+    if(!sweep.empty())
+    {
+        if(sweep_mode != "linear" && sweep_mode != "geometric")
+            throw std::invalid_argument("Invalid value for --sweep_mode " + sweep_mode);
+        return hipblas_bench_sweep(arg, sweep, sweep_mode == "geometric");
+    }
 
-    int copied = snprintf(arg.function, sizeof(arg.function), "%s", function.c_str());
-    if(copied <= 0 || copied >= sizeof(arg.function))
-        throw std::invalid_argument("Invalid value for --function");
+    if(graph)
+        return hipblas_bench_graph(arg);
 
     if(!parallel_devices)
         return run_bench_test(arg, 0, 1);
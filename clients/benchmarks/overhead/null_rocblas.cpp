@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+// The part of the null rocBLAS used by hipblas-overhead-bench that keeps state on its handle.
+// Every other rocBLAS and rocSOLVER function is generated from the headers and only returns
+// rocblas_status_success; any function defined here is left out of the generated ones.
+
+#define ROCBLAS_NO_DEPRECATED_WARNINGS
+#include <rocblas/rocblas.h>
+
+struct _rocblas_handle
+{
+    hipStream_t          stream       = nullptr;
+    rocblas_pointer_mode pointer_mode = rocblas_pointer_mode_host;
+    rocblas_atomics_mode atomics_mode = rocblas_atomics_allowed;
+    size_t               memory_size  = 0;
+    bool                 memory_query = false;
+};
+
+extern "C" {
+
+rocblas_status rocblas_create_handle(rocblas_handle* handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_pointer;
+    *handle = new _rocblas_handle;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_destroy_handle(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    delete handle;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_stream(rocblas_handle handle, hipStream_t stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->stream = stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_stream(rocblas_handle handle, hipStream_t* stream)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!stream)
+        return rocblas_status_invalid_pointer;
+    *stream = handle->stream;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_pointer_mode(rocblas_handle handle, rocblas_pointer_mode pointer_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->pointer_mode = pointer_mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_pointer_mode(rocblas_handle handle, rocblas_pointer_mode* pointer_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!pointer_mode)
+        return rocblas_status_invalid_pointer;
+    *pointer_mode = handle->pointer_mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_atomics_mode(rocblas_handle handle, rocblas_atomics_mode atomics_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->atomics_mode = atomics_mode;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_atomics_mode(rocblas_handle handle, rocblas_atomics_mode* atomics_mode)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!atomics_mode)
+        return rocblas_status_invalid_pointer;
+    *atomics_mode = handle->atomics_mode;
+    return rocblas_status_success;
+}
+
+// Calls need no device memory, so a size query always reports zero bytes
+rocblas_status rocblas_start_device_memory_size_query(rocblas_handle handle)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(handle->memory_query)
+        return rocblas_status_size_query_mismatch;
+    handle->memory_query = true;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_stop_device_memory_size_query(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!handle->memory_query)
+        return rocblas_status_size_query_mismatch;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    handle->memory_query = false;
+    *size                = 0;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_get_device_memory_size(rocblas_handle handle, size_t* size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    if(!size)
+        return rocblas_status_invalid_pointer;
+    *size = handle->memory_size;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_device_memory_size(rocblas_handle handle, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->memory_size = size;
+    return rocblas_status_success;
+}
+
+rocblas_status rocblas_set_workspace(rocblas_handle handle, void* addr, size_t size)
+{
+    if(!handle)
+        return rocblas_status_invalid_handle;
+    handle->memory_size = addr ? size : 0;
+    return rocblas_status_success;
+}
+
+} // extern "C"
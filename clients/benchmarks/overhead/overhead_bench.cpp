@@ -0,0 +1,303 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "program_options.hpp"
+
+#include "hipblas.h"
+#define ROCBLAS_NO_DEPRECATED_WARNINGS
+#include <rocblas/rocblas.h>
+#ifdef __HIP_PLATFORM_SOLVER__
+#include <rocsolver/rocsolver.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace roc; // For emulated program_options
+
+// hipblas-overhead-bench times each hipBLAS call and the rocBLAS call it forwards to, both
+// running against the null rocBLAS linked into this executable. Because the backend returns
+// immediately, the difference is the host time the wrapper spends converting arguments,
+// validating enums, logging and mapping the status.
+
+namespace
+{
+    constexpr int size = 8;
+    constexpr int ld   = size;
+
+    // Host buffers large enough for every call below. The null backend never reads them, but
+    // the HIPBLAS_LAYER logging reads the scalars, so they are real memory.
+    struct overhead_data
+    {
+        float           alpha = 1.0f, beta = 0.0f, c = 1.0f, s = 0.0f, result = 0.0f;
+        hipblasComplex  calpha{1.0f, 0.0f};
+        float           A[size * ld * 2] = {}, B[size * ld * 2] = {}, C[size * ld * 2] = {};
+        float           x[size * 2] = {}, y[size * 2] = {};
+        float*          A_array[2] = {A, A + size * ld};
+        float*          B_array[2] = {B, B + size * ld};
+        float*          C_array[2] = {C, C + size * ld};
+        int             index = 0, info = 0;
+        int             ipiv[size] = {};
+        hipblasHandle_t handle  = nullptr;
+        rocblas_handle  backend = nullptr;
+    };
+
+    // Best of repeats timings of iters back to back calls, in nanoseconds per call. Returns NaN
+    // if any call failed, such as a family the library was built without.
+    template <typename Status, typename Call>
+    double ns_per_call(Call call, int64_t iters, int repeats, Status success)
+    {
+        double best = std::numeric_limits<double>::infinity();
+        for(int r = 0; r < repeats; r++)
+        {
+            bool failed = false;
+            auto start  = std::chrono::steady_clock::now();
+            for(int64_t i = 0; i < iters; i++)
+                failed |= call() != success;
+            auto stop = std::chrono::steady_clock::now();
+
+            if(failed)
+                return std::numeric_limits<double>::quiet_NaN();
+            best = std::min(best, std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        return best / iters;
+    }
+
+    // One benchmarked API: the family it belongs to, and timers for the hipBLAS call and for
+    // the equivalent direct rocBLAS call
+    struct overhead_case
+    {
+        const char*                         family;
+        const char*                         function;
+        std::function<double(int64_t, int)> hipblas_ns;
+        std::function<double(int64_t, int)> rocblas_ns;
+    };
+
+    template <typename HipblasCall, typename RocblasCall>
+    overhead_case make_case(const char* family,
+                            const char* function,
+                            HipblasCall hipblas_call,
+                            RocblasCall rocblas_call)
+    {
+        return {family,
+                function,
+                [=](int64_t iters, int repeats) {
+                    return ns_per_call(hipblas_call, iters, repeats, HIPBLAS_STATUS_SUCCESS);
+                },
+                [=](int64_t iters, int repeats) {
+                    return ns_per_call(rocblas_call, iters, repeats, rocblas_status_success);
+                }};
+    }
+
+    std::vector<overhead_case> overhead_cases(overhead_data& d)
+    {
+        const hipblasOperation_t N      = HIPBLAS_OP_N;
+        const hipblasOperation_t T      = HIPBLAS_OP_T;
+        const hipblasFillMode_t  lower  = HIPBLAS_FILL_MODE_LOWER;
+        const hipblasDiagType_t  diag   = HIPBLAS_DIAG_NON_UNIT;
+        const hipblasSideMode_t  left   = HIPBLAS_SIDE_LEFT;
+        const rocblas_operation  rN     = rocblas_operation_none;
+        const rocblas_operation  rT     = rocblas_operation_transpose;
+        const rocblas_fill       rlower = rocblas_fill_lower;
+        const rocblas_diagonal   rdiag  = rocblas_diagonal_non_unit;
+        const rocblas_side       rleft  = rocblas_side_left;
+        const hipblasStride      sx     = size;
+        const hipblasStride      sA     = size * ld;
+        const int                batch  = 2;
+
+        auto cx      = reinterpret_cast<hipblasComplex*>(d.x);
+        auto cy      = reinterpret_cast<hipblasComplex*>(d.y);
+        auto cA      = reinterpret_cast<hipblasComplex*>(d.A);
+        auto cB      = reinterpret_cast<hipblasComplex*>(d.B);
+        auto cC      = reinterpret_cast<hipblasComplex*>(d.C);
+        auto rcalpha = reinterpret_cast<const rocblas_float_complex*>(&d.calpha);
+
+        return {
+            // clang-format off
+            make_case("level1", "hipblasSaxpy",
+                [=, &d] { return hipblasSaxpy(d.handle, size, &d.alpha, d.x, 1, d.y, 1); },
+                [=, &d] { return rocblas_saxpy(d.backend, size, &d.alpha, d.x, 1, d.y, 1); }),
+            make_case("level1", "hipblasSdot",
+                [=, &d] { return hipblasSdot(d.handle, size, d.x, 1, d.y, 1, &d.result); },
+                [=, &d] { return rocblas_sdot(d.backend, size, d.x, 1, d.y, 1, &d.result); }),
+            make_case("level1", "hipblasSnrm2",
+                [=, &d] { return hipblasSnrm2(d.handle, size, d.x, 1, &d.result); },
+                [=, &d] { return rocblas_snrm2(d.backend, size, d.x, 1, &d.result); }),
+            make_case("level1", "hipblasSscal",
+                [=, &d] { return hipblasSscal(d.handle, size, &d.alpha, d.x, 1); },
+                [=, &d] { return rocblas_sscal(d.backend, size, &d.alpha, d.x, 1); }),
+            make_case("level1", "hipblasIsamax",
+                [=, &d] { return hipblasIsamax(d.handle, size, d.x, 1, &d.index); },
+                [=, &d] { return rocblas_isamax(d.backend, size, d.x, 1, &d.index); }),
+            make_case("level1", "hipblasSrot",
+                [=, &d] { return hipblasSrot(d.handle, size, d.x, 1, d.y, 1, &d.c, &d.s); },
+                [=, &d] { return rocblas_srot(d.backend, size, d.x, 1, d.y, 1, &d.c, &d.s); }),
+            make_case("level1", "hipblasCaxpy",
+                [=, &d] { return hipblasCaxpy(d.handle, size, &d.calpha, cx, 1, cy, 1); },
+                [=, &d] { return rocblas_caxpy(d.backend, size, rcalpha, reinterpret_cast<rocblas_float_complex*>(cx), 1, reinterpret_cast<rocblas_float_complex*>(cy), 1); }),
+
+            make_case("level2", "hipblasSgemv",
+                [=, &d] { return hipblasSgemv(d.handle, N, size, size, &d.alpha, d.A, ld, d.x, 1, &d.beta, d.y, 1); },
+                [=, &d] { return rocblas_sgemv(d.backend, rN, size, size, &d.alpha, d.A, ld, d.x, 1, &d.beta, d.y, 1); }),
+            make_case("level2", "hipblasSger",
+                [=, &d] { return hipblasSger(d.handle, size, size, &d.alpha, d.x, 1, d.y, 1, d.A, ld); },
+                [=, &d] { return rocblas_sger(d.backend, size, size, &d.alpha, d.x, 1, d.y, 1, d.A, ld); }),
+            make_case("level2", "hipblasSsymv",
+                [=, &d] { return hipblasSsymv(d.handle, lower, size, &d.alpha, d.A, ld, d.x, 1, &d.beta, d.y, 1); },
+                [=, &d] { return rocblas_ssymv(d.backend, rlower, size, &d.alpha, d.A, ld, d.x, 1, &d.beta, d.y, 1); }),
+            make_case("level2", "hipblasStrsv",
+                [=, &d] { return hipblasStrsv(d.handle, lower, N, diag, size, d.A, ld, d.x, 1); },
+                [=, &d] { return rocblas_strsv(d.backend, rlower, rN, rdiag, size, d.A, ld, d.x, 1); }),
+
+            make_case("level3", "hipblasSgemm",
+                [=, &d] { return hipblasSgemm(d.handle, N, T, size, size, size, &d.alpha, d.A, ld, d.B, ld, &d.beta, d.C, ld); },
+                [=, &d] { return rocblas_sgemm(d.backend, rN, rT, size, size, size, &d.alpha, d.A, ld, d.B, ld, &d.beta, d.C, ld); }),
+            make_case("level3", "hipblasCgemm",
+                [=, &d] { return hipblasCgemm(d.handle, N, T, size, size, size, &d.calpha, cA, ld, cB, ld, &d.calpha, cC, ld); },
+                [=, &d] { return rocblas_cgemm(d.backend, rN, rT, size, size, size, rcalpha, reinterpret_cast<rocblas_float_complex*>(cA), ld, reinterpret_cast<rocblas_float_complex*>(cB), ld, rcalpha, reinterpret_cast<rocblas_float_complex*>(cC), ld); }),
+            make_case("level3", "hipblasStrsm",
+                [=, &d] { return hipblasStrsm(d.handle, left, lower, N, diag, size, size, &d.alpha, d.A, ld, d.B, ld); },
+                [=, &d] { return rocblas_strsm(d.backend, rleft, rlower, rN, rdiag, size, size, &d.alpha, d.A, ld, d.B, ld); }),
+            make_case("level3", "hipblasSsyrk",
+                [=, &d] { return hipblasSsyrk(d.handle, lower, N, size, size, &d.alpha, d.A, ld, &d.beta, d.C, ld); },
+                [=, &d] { return rocblas_ssyrk(d.backend, rlower, rN, size, size, &d.alpha, d.A, ld, &d.beta, d.C, ld); }),
+
+            make_case("batched", "hipblasSaxpyStridedBatched",
+                [=, &d] { return hipblasSaxpyStridedBatched(d.handle, size, &d.alpha, d.x, 1, sx, d.y, 1, sx, batch); },
+                [=, &d] { return rocblas_saxpy_strided_batched(d.backend, size, &d.alpha, d.x, 1, sx, d.y, 1, sx, batch); }),
+            make_case("batched", "hipblasSgemmBatched",
+                [=, &d] { return hipblasSgemmBatched(d.handle, N, T, size, size, size, &d.alpha, d.A_array, ld, d.B_array, ld, &d.beta, d.C_array, ld, batch); },
+                [=, &d] { return rocblas_sgemm_batched(d.backend, rN, rT, size, size, size, &d.alpha, d.A_array, ld, d.B_array, ld, &d.beta, d.C_array, ld, batch); }),
+            make_case("batched", "hipblasSgemmStridedBatched",
+                [=, &d] { return hipblasSgemmStridedBatched(d.handle, N, T, size, size, size, &d.alpha, d.A, ld, sA, d.B, ld, sA, &d.beta, d.C, ld, sA, batch); },
+                [=, &d] { return rocblas_sgemm_strided_batched(d.backend, rN, rT, size, size, size, &d.alpha, d.A, ld, sA, d.B, ld, sA, &d.beta, d.C, ld, sA, batch); }),
+
+            make_case("ex", "hipblasAxpyEx",
+                [=, &d] { return hipblasAxpyEx(d.handle, size, &d.alpha, HIPBLAS_R_32F, d.x, HIPBLAS_R_32F, 1, d.y, HIPBLAS_R_32F, 1, HIPBLAS_R_32F); },
+                [=, &d] { return rocblas_axpy_ex(d.backend, size, &d.alpha, rocblas_datatype_f32_r, d.x, rocblas_datatype_f32_r, 1, d.y, rocblas_datatype_f32_r, 1, rocblas_datatype_f32_r); }),
+            make_case("ex", "hipblasGemmEx",
+                [=, &d] { return hipblasGemmEx(d.handle, N, T, size, size, size, &d.alpha, d.A, HIPBLAS_R_32F, ld, d.B, HIPBLAS_R_32F, ld, &d.beta, d.C, HIPBLAS_R_32F, ld, HIPBLAS_R_32F, HIPBLAS_GEMM_DEFAULT); },
+                [=, &d] { return rocblas_gemm_ex(d.backend, rN, rT, size, size, size, &d.alpha, d.A, rocblas_datatype_f32_r, ld, d.B, rocblas_datatype_f32_r, ld, &d.beta, d.C, rocblas_datatype_f32_r, ld, d.C, rocblas_datatype_f32_r, ld, rocblas_datatype_f32_r, rocblas_gemm_algo_standard, 0, rocblas_gemm_flags_none); }),
+
+            make_case("ilp64", "hipblasSaxpy_64",
+                [=, &d] { return hipblasSaxpy_64(d.handle, size, &d.alpha, d.x, 1, d.y, 1); },
+                [=, &d] { return rocblas_saxpy_64(d.backend, size, &d.alpha, d.x, 1, d.y, 1); }),
+            make_case("ilp64", "hipblasSgemm_64",
+                [=, &d] { return hipblasSgemm_64(d.handle, N, T, size, size, size, &d.alpha, d.A, ld, d.B, ld, &d.beta, d.C, ld); },
+                [=, &d] { return rocblas_sgemm_64(d.backend, rN, rT, size, size, size, &d.alpha, d.A, ld, d.B, ld, &d.beta, d.C, ld); }),
+
+#ifdef __HIP_PLATFORM_SOLVER__
+            make_case("solver", "hipblasSgetrf",
+                [=, &d] { return hipblasSgetrf(d.handle, size, d.A, ld, d.ipiv, &d.info); },
+                [=, &d] { return rocsolver_sgetrf(d.backend, size, size, d.A, ld, d.ipiv, &d.info); }),
+            make_case("solver", "hipblasSgetrs",
+                [=, &d] { return hipblasSgetrs(d.handle, N, size, 1, d.A, ld, d.ipiv, d.B, ld, &d.info); },
+                [=, &d] { return rocsolver_sgetrs(d.backend, rN, size, 1, d.A, ld, d.ipiv, d.B, ld); }),
+#endif
+            // clang-format on
+        };
+    }
+}
+
+int main(int argc, char* argv[])
+try
+{
+    int64_t     iters   = 0;
+    int         repeats = 0;
+    std::string filter;
+
+    options_description desc("hipblas-overhead-bench command line options");
+
+    // clang-format off
+    desc.add_options()
+
+        ("iters,i",
+         value<int64_t>(&iters)->default_value(1000000),
+         "Number of back to back calls timed for each function")
+
+        ("repeats,r",
+         value<int>(&repeats)->default_value(5),
+         "Number of times the calls are timed; the fastest is reported")
+
+        ("filter,f",
+         value<std::string>(&filter),
+         "Only time the functions whose name or family matches this regular expression")
+
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    variables_map vm;
+    store(parse_command_line(argc, argv, desc), vm);
+    notify(vm);
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(iters <= 0 || repeats <= 0)
+        throw std::invalid_argument("--iters and --repeats must be positive");
+
+    overhead_data d;
+    if(hipblasCreate(&d.handle) != HIPBLAS_STATUS_SUCCESS
+       || rocblas_create_handle(&d.backend) != rocblas_status_success)
+    {
+        std::cerr << "Error: could not create the handles" << std::endl;
+        return -1;
+    }
+
+    std::regex pattern(filter.empty() ? std::string(".*") : filter);
+
+    std::printf("family,function,hipblas-ns,rocblas-ns,overhead-ns\n");
+    for(const overhead_case& test : overhead_cases(d))
+    {
+        if(!std::regex_search(test.function, pattern) && !std::regex_search(test.family, pattern))
+            continue;
+
+        double hipblas_ns = test.hipblas_ns(iters, repeats);
+        double rocblas_ns = test.rocblas_ns(iters, repeats);
+        std::printf("%s,%s,%.2f,%.2f,%.2f\n",
+                    test.family,
+                    test.function,
+                    hipblas_ns,
+                    rocblas_ns,
+                    hipblas_ns - rocblas_ns);
+    }
+
+    hipblasDestroy(d.handle);
+    rocblas_destroy_handle(d.backend);
+    return 0;
+}
+catch(const std::exception& e)
+{
+    std::cerr << "Error: " << e.what() << std::endl;
+    return -1;
+}
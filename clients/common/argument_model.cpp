@@ -21,6 +21,14 @@
  * ************************************************************************ */
 
 #include "argument_model.hpp"
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <type_traits>
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
@@ -47,3 +55,254 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+// per thread, as the streams of hipblas-bench --streams log concurrently
+static thread_local double log_time_us = ArgumentLogging::NA_value;
+
+void ArgumentModel_set_log_time_us(double us)
+{
+    log_time_us = us;
+}
+
+double ArgumentModel_get_log_time_us()
+{
+    return log_time_us;
+}
+
+static bool        log_repeated_names = true;
+static std::string log_last_names;
+
+void ArgumentModel_set_log_repeated_names(bool r)
+{
+    log_repeated_names = r;
+    log_last_names.clear();
+}
+
+void ArgumentModel_log_lines(std::ostream&      str,
+                             const std::string& names,
+                             const std::string& values)
+{
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(log_repeated_names || names != log_last_names)
+        str << names << "\n";
+    log_last_names = names;
+    str << values << std::endl;
+}
+
+static std::string log_output_path;
+static bool        log_output_json = false;
+
+void ArgumentModel_set_log_output(const std::string& path, bool json)
+{
+    log_output_path = path;
+    log_output_json = json;
+}
+
+namespace
+{
+    // Field of a structured record; text is quoted in JSON, and numbers are not
+    struct OutputField
+    {
+        std::string name;
+        std::string value;
+        bool        text;
+    };
+
+    std::string output_number(double value)
+    {
+        std::ostringstream str;
+        if(std::isfinite(value))
+            str << std::setprecision(std::numeric_limits<double>::max_digits10) << value;
+        else
+            str << (log_output_json ? "null" : std::isnan(value) ? "nan" : "inf");
+        return str.str();
+    }
+
+    template <typename T>
+    OutputField output_field(const char* name, const T& value)
+    {
+        if constexpr(std::is_same<T, char>{})
+            return {name, std::string(1, value), true};
+        else if constexpr(std::is_array<T>{})
+            return {name, std::string(value), true};
+        else if constexpr(std::is_same<T, bool>{})
+            return {name, value ? "true" : "false", false};
+        else if constexpr(std::is_same<T, hipblasDatatype_t>{})
+            return {name, hipblas_datatype2string(value), true};
+        else if constexpr(std::is_same<T, hipblasComputeType_t>{})
+            return {name, hipblas_computetype2string(value), true};
+        else if constexpr(std::is_same<T, hipblas_initialization>{})
+            return {name, hipblas_initialization2string(value), true};
+        else if constexpr(std::is_floating_point<T>{})
+            return {name, output_number(value), false};
+        else
+            return {name, std::to_string(value), false};
+    }
+
+    std::string output_json_string(const std::string& value)
+    {
+        std::ostringstream str;
+        str << '"';
+        for(char c : value)
+        {
+            if(c == '"' || c == '\\')
+                str << '\\' << c;
+            else if((unsigned char)c < 0x20)
+                str << "\\u" << std::hex << std::setw(4) << std::setfill('0') << int(c);
+            else
+                str << c;
+        }
+        str << '"';
+        return str.str();
+    }
+
+    std::string output_csv_string(const std::string& value)
+    {
+        if(value.find_first_of(",\"\n") == std::string::npos)
+            return value;
+        std::string quoted = "\"";
+        for(char c : value)
+            quoted += c == '"' ? std::string("\"\"") : std::string(1, c);
+        return quoted + "\"";
+    }
+
+    // Name of the current device and versions of the libraries, which every record starts with
+    std::vector<OutputField> output_context()
+    {
+        static std::mutex                              mutex;
+        static std::map<int, std::vector<OutputField>> contexts;
+
+        int device = 0;
+        (void)hipGetDevice(&device);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto&                       context = contexts[device];
+        if(context.empty())
+        {
+            hipDeviceProp_t props{};
+            int             runtime = 0, driver = 0;
+            (void)hipGetDeviceProperties(&props, device);
+            (void)hipRuntimeGetVersion(&runtime);
+            (void)hipDriverGetVersion(&driver);
+
+            std::string version = std::to_string(hipblasVersionMajor) + "."
+                                  + std::to_string(hipblasVersionMinor) + "."
+                                  + std::to_string(hipblasVersionPatch);
+            context = {{"device", props.name, true},
+                       {"device_id", std::to_string(device), false},
+                       {"hipblas_version", version, true},
+                       {"hip_runtime_version", std::to_string(runtime), false},
+                       {"hip_driver_version", std::to_string(driver), false}};
+        }
+        return context;
+    }
+}
+
+void ArgumentModel_log_output(const Arguments&                                    arg,
+                              const std::vector<std::pair<const char*, double>>& performance)
+{
+    if(log_output_path.empty())
+        return;
+
+    std::vector<OutputField> fields = output_context();
+#define OUTPUT_FIELD(NAME) fields.push_back(output_field(#NAME, arg.NAME))
+    FOR_EACH_ARGUMENT(OUTPUT_FIELD, ;);
+#undef OUTPUT_FIELD
+    for(auto& column : performance)
+        fields.push_back({column.first, output_number(column.second), false});
+
+    // Threads of a multi-GPU run share the file
+    static std::mutex           mutex;
+    std::lock_guard<std::mutex> lock(mutex);
+
+    std::ostringstream record;
+    if(log_output_json)
+    {
+        record << "{";
+        for(size_t i = 0; i < fields.size(); i++)
+            record << (i ? ", " : "") << output_json_string(fields[i].name) << ": "
+                   << (fields[i].text ? output_json_string(fields[i].value) : fields[i].value);
+        record << "}\n";
+    }
+    else
+    {
+        std::string header, values;
+        for(size_t i = 0; i < fields.size(); i++)
+        {
+            header += (i ? "," : "") + output_csv_string(fields[i].name);
+            values += (i ? "," : "") + output_csv_string(fields[i].value);
+        }
+
+        // A header precedes the first record of the file and each record with other columns
+        static std::string last_header;
+        static std::string last_path;
+        if(last_path != log_output_path)
+        {
+            std::ifstream existing(log_output_path);
+            last_header.clear();
+            for(std::string line; std::getline(existing, line);)
+                if(!line.compare(0, 7, "device,"))
+                    last_header = line;
+            last_path = log_output_path;
+        }
+        if(header != last_header)
+            record << header << "\n";
+        record << values << "\n";
+        last_header = header;
+    }
+
+    std::ofstream file(log_output_path, std::ios::app);
+    if(!(file << record.str() << std::flush))
+        std::cerr << "hipblas-bench: cannot write --output file " << log_output_path << std::endl;
+}
+
+ArgumentLogging::IterationStats ArgumentLogging::iteration_stats(std::vector<double> times_us,
+                                                                 double outlier_threshold)
+{
+    IterationStats stats;
+    if(times_us.empty())
+        return stats;
+
+    auto median = [](std::vector<double>& values) {
+        std::sort(values.begin(), values.end());
+        size_t half = values.size() / 2;
+        return values.size() % 2 ? values[half] : (values[half - 1] + values[half]) / 2;
+    };
+
+    if(outlier_threshold > 0)
+    {
+        double              center = median(times_us);
+        std::vector<double> deviations;
+        for(double time_us : times_us)
+            deviations.push_back(std::abs(time_us - center));
+        double bound = outlier_threshold * median(deviations);
+
+        // With half the times or more at the median, no time is an outlier
+        if(bound > 0)
+        {
+            auto kept = std::remove_if(times_us.begin(), times_us.end(), [&](double time_us) {
+                return std::abs(time_us - center) > bound;
+            });
+            stats.outliers = int(times_us.end() - kept);
+            times_us.erase(kept, times_us.end());
+        }
+    }
+
+    // Nearest-rank percentiles of the sorted times
+    double n        = double(times_us.size());
+    auto   quantile = [&](double p) { return times_us[size_t(std::ceil(p * n)) - 1]; };
+
+    stats.median_us = median(times_us);
+    stats.min_us    = times_us.front();
+    stats.p90_us    = quantile(0.90);
+    stats.p99_us    = quantile(0.99);
+    stats.mean_us   = std::accumulate(times_us.begin(), times_us.end(), 0.0) / n;
+
+    double variance = 0;
+    for(double time_us : times_us)
+        variance += (time_us - stats.mean_us) * (time_us - stats.mean_us);
+    stats.stddev_us = std::sqrt(variance / n);
+    return stats;
+}
@@ -153,6 +153,25 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -1759,6 +1778,40 @@ int cblas_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
 // tbmv
 template <>
 void cblas_tbmv<float>(hipblasFillMode_t  uplo,
@@ -178,6 +178,8 @@
 #include "testing_gemm_batched.hpp"
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_epilogue.hpp"
+#include "testing_gemm_grouped_batched_ex.hpp"
 #include "testing_gemm_strided_batched.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "testing_hemm.hpp"
@@ -232,12 +234,29 @@
 #include "testing_getrf_npvt.hpp"
 #include "testing_getrf_npvt_batched.hpp"
 #include "testing_getrf_npvt_strided_batched.hpp"
+#include "testing_getrf_rect.hpp"
+#include "testing_getrf_rect_batched.hpp"
+#include "testing_getrf_rect_npvt.hpp"
+#include "testing_getrf_rect_strided_batched.hpp"
 #include "testing_getrf_strided_batched.hpp"
+#include "testing_getri.hpp"
 #include "testing_getri_batched.hpp"
+#include "testing_getri_npvt.hpp"
 #include "testing_getri_npvt_batched.hpp"
+#include "testing_getri_npvt_strided_batched.hpp"
+#include "testing_getri_strided_batched.hpp"
 #include "testing_getrs.hpp"
 #include "testing_getrs_batched.hpp"
 #include "testing_getrs_strided_batched.hpp"
+#include "testing_potrf.hpp"
+#include "testing_potrf_batched.hpp"
+#include "testing_potrf_strided_batched.hpp"
+#include "testing_potrs.hpp"
+#include "testing_potrs_batched.hpp"
+#include "testing_potrs_strided_batched.hpp"
+#include "testing_xxgesv.hpp"
+#include "testing_xxgesv_batched.hpp"
+#include "testing_xxgesv_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -423,6 +442,9 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm_ex", testname_gemm_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
+        {"gemm_grouped_batched_ex", testname_gemm_grouped_batched_ex},
+        {"gemm_ex_with_epilogue", testname_gemm_ex_with_epilogue},
+        {"gemm_strided_batched_ex_with_epilogue", testname_gemm_strided_batched_ex_with_epilogue},
         {"hemm", testname_hemm},
         {"hemm_batched", testname_hemm_batched},
         {"hemm_strided_batched", testname_hemm_strided_batched},
@@ -470,14 +492,31 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"getrf_npvt", testname_getrf_npvt},
         {"getrf_npvt_batched", testname_getrf_npvt_batched},
         {"getrf_npvt_strided_batched", testname_getrf_npvt_strided_batched},
+        {"getrf_rect", testname_getrf_rect},
+        {"getrf_rect_batched", testname_getrf_rect_batched},
+        {"getrf_rect_strided_batched", testname_getrf_rect_strided_batched},
+        {"getrf_rect_npvt", testname_getrf_rect_npvt},
+        {"getri", testname_getri},
         {"getri_batched", testname_getri_batched},
+        {"getri_strided_batched", testname_getri_strided_batched},
+        {"getri_npvt", testname_getri_npvt},
         {"getri_npvt_batched", testname_getri_npvt_batched},
+        {"getri_npvt_strided_batched", testname_getri_npvt_strided_batched},
         {"getrs", testname_getrs},
         {"getrs_batched", testname_getrs_batched},
         {"getrs_strided_batched", testname_getrs_strided_batched},
         {"gels", testname_gels},
         {"gels_batched", testname_gels_batched},
         {"gels_strided_batched", testname_gels_strided_batched},
+        {"potrf", testname_potrf},
+        {"potrf_batched", testname_potrf_batched},
+        {"potrf_strided_batched", testname_potrf_strided_batched},
+        {"potrs", testname_potrs},
+        {"potrs_batched", testname_potrs_batched},
+        {"potrs_strided_batched", testname_potrs_strided_batched},
+        {"xxgesv", testname_xxgesv},
+        {"xxgesv_batched", testname_xxgesv_batched},
+        {"xxgesv_strided_batched", testname_xxgesv_strided_batched},
 #endif
 
         // Aux
@@ -513,6 +552,8 @@ struct perf_gemm_ex<Ti,
         static const func_map map = {
             {"gemm_ex", testing_gemm_ex_template<Ti, Ti, To, Tc>},
             {"gemm_batched_ex", testing_gemm_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_grouped_batched_ex", testing_gemm_grouped_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_ex_with_epilogue", testing_gemm_ex_with_epilogue_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -538,6 +579,8 @@ struct perf_gemm_strided_batched_ex<
     {
         static const func_map map = {
             {"gemm_strided_batched_ex", testing_gemm_strided_batched_ex_template<Ti, Ti, To, Tc>},
+            {"gemm_strided_batched_ex_with_epilogue",
+             testing_gemm_strided_batched_ex_with_epilogue_template<Ti, Ti, To, Tc>},
         };
         run_function(map, arg);
     }
@@ -688,14 +731,28 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"getrf_npvt", testing_getrf_npvt<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
+            {"getrf_rect", testing_getrf_rect<T>},
+            {"getrf_rect_batched", testing_getrf_rect_batched<T>},
+            {"getrf_rect_strided_batched", testing_getrf_rect_strided_batched<T>},
+            {"getrf_rect_npvt", testing_getrf_rect_npvt<T>},
+            {"getri", testing_getri<T>},
             {"getri_batched", testing_getri_batched<T>},
+            {"getri_strided_batched", testing_getri_strided_batched<T>},
+            {"getri_npvt", testing_getri_npvt<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"getri_npvt_strided_batched", testing_getri_npvt_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
 #endif
 
             // Aux
@@ -910,20 +967,60 @@ struct perf_blas<
             {"getrf_npvt", testing_getrf_npvt<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
+            {"getrf_rect", testing_getrf_rect<T>},
+            {"getrf_rect_batched", testing_getrf_rect_batched<T>},
+            {"getrf_rect_strided_batched", testing_getrf_rect_strided_batched<T>},
+            {"getrf_rect_npvt", testing_getrf_rect_npvt<T>},
+            {"getri", testing_getri<T>},
             {"getri_batched", testing_getri_batched<T>},
+            {"getri_strided_batched", testing_getri_strided_batched<T>},
+            {"getri_npvt", testing_getri_npvt<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
+            {"getri_npvt_strided_batched", testing_getri_npvt_strided_batched<T>},
             {"getrs", testing_getrs<T>},
             {"getrs_batched", testing_getrs_batched<T>},
             {"getrs_strided_batched", testing_getrs_strided_batched<T>},
             {"gels", testing_gels<T>},
             {"gels_batched", testing_gels_batched<T>},
             {"gels_strided_batched", testing_gels_strided_batched<T>},
+            {"potrf", testing_potrf<T>},
+            {"potrf_batched", testing_potrf_batched<T>},
+            {"potrf_strided_batched", testing_potrf_strided_batched<T>},
+            {"potrs", testing_potrs<T>},
+            {"potrs_batched", testing_potrs_batched<T>},
+            {"potrs_strided_batched", testing_potrs_strided_batched<T>},
 #endif
         };
         run_function(map, arg);
     }
 };
 
+#ifdef __HIP_PLATFORM_SOLVER__
+// Mixed precision solvers are named by the precision of the solution, only double and
+// double complex
+template <typename T, typename = void>
+struct perf_blas_xxgesv : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_blas_xxgesv<
+    T,
+    std::enable_if_t<std::is_same<T, double>{} || std::is_same<T, hipblasDoubleComplex>{}>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"xxgesv", testing_xxgesv<T>},
+            {"xxgesv_batched", testing_xxgesv_batched<T>},
+            {"xxgesv_strided_batched", testing_xxgesv_strided_batched<T>},
+        };
+        run_function(map, arg);
+    }
+};
+#endif
+
 template <typename Ta, typename Tx = Ta, typename Ty = Tx, typename Tex = Ty, typename = void>
 struct perf_blas_axpy_ex : hipblas_test_invalid
 {
@@ -1193,9 +1290,9 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
+        int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
 
         if(arg.lda < min_lda)
         {
@@ -1216,9 +1313,9 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     else if(!strcmp(function, "gemm_strided_batched"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
+        int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
         if(arg.lda < min_lda)
         {
             std::cout << "hipblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
@@ -1243,7 +1340,7 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         //          arg.transA == 'N' ? arg.K * arg.lda : arg.M * arg.lda;
         //      hipblas_int min_stride_b =
         //          arg.transB == 'N' ? arg.N * arg.ldb : arg.K * arg.ldb;
-        hipblas_int min_stride_c = arg.ldc * arg.N;
+        hipblasStride min_stride_c = arg.ldc * arg.N;
         //      if (arg.stride_a < min_stride_a)
         //      {
         //          std::cout << "hipblas-bench INFO: stride_a < min_stride_a, set stride_a = " <<
@@ -1264,13 +1361,15 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
     }
 
-    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex"))
+    if(!strcmp(function, "gemm_ex") || !strcmp(function, "gemm_batched_ex")
+       || !strcmp(function, "gemm_grouped_batched_ex")
+       || !strcmp(function, "gemm_ex_with_epilogue"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
-        hipblas_int min_ldd = arg.M;
+        int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
+        int64_t min_ldd = arg.M;
 
         if(arg.lda < min_lda)
         {
@@ -1294,13 +1393,14 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         }
         hipblas_gemm_dispatch<perf_gemm_ex>(arg);
     }
-    else if(!strcmp(function, "gemm_strided_batched_ex"))
+    else if(!strcmp(function, "gemm_strided_batched_ex")
+            || !strcmp(function, "gemm_strided_batched_ex_with_epilogue"))
     {
         // adjust dimension for GEMM routines
-        hipblas_int min_lda = arg.transA == 'N' ? arg.M : arg.K;
-        hipblas_int min_ldb = arg.transB == 'N' ? arg.K : arg.N;
-        hipblas_int min_ldc = arg.M;
-        hipblas_int min_ldd = arg.M;
+        int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
+        int64_t min_ldb = arg.transB == 'N' ? arg.K : arg.N;
+        int64_t min_ldc = arg.M;
+        int64_t min_ldd = arg.M;
         if(arg.lda < min_lda)
         {
             std::cout << "hipblas-bench INFO: lda < min_lda, set lda = " << min_lda << std::endl;
@@ -1321,7 +1421,7 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
             std::cout << "hipblas-bench INFO: ldd < min_ldd, set ldd = " << min_ldc << std::endl;
             arg.ldd = min_ldd;
         }
-        hipblas_int min_stride_c = arg.ldc * arg.N;
+        hipblasStride min_stride_c = arg.ldc * arg.N;
         if(arg.stride_c < min_stride_c)
         {
             std::cout << "hipblas-bench INFO: stride_c < min_stride_c, set stride_c = "
@@ -1358,6 +1458,11 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+#ifdef __HIP_PLATFORM_SOLVER__
+        else if(!strcmp(function, "xxgesv") || !strcmp(function, "xxgesv_batched")
+                || !strcmp(function, "xxgesv_strided_batched"))
+            hipblas_simple_dispatch<perf_blas_xxgesv>(arg);
+#endif
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
@@ -30,12 +30,17 @@
 
 #include "hipblas.h"
 #include "utility.h"
+#include <algorithm>
 #include <chrono>
+#include <condition_variable>
 #include <cstdlib>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <new>
 #include <stdexcept>
 #include <stdlib.h>
+#include <unordered_map>
 
 #ifdef WIN32
 #define strcasecmp(A, B) _stricmp(A, B)
@@ -57,6 +62,8 @@ namespace fs = std::experimental::filesystem;
 hipblas_rng_t hipblas_rng(69069);
 hipblas_rng_t hipblas_seed(hipblas_rng);
 
+size_t hipblas_client_workspace = 0;
+
 template <>
 char type2char<float>()
 {
@@ -178,6 +185,37 @@ std::string hipblas_tempname()
  * local handles *
  *****************/
 
+// Streams of hipblas-bench --streams; reference is recorded when the last hot loop is released
+struct hipblas_stream_group
+{
+    std::mutex                       mutex;
+    std::condition_variable          released;
+    int                              size    = 0;
+    int                              arrived = 0;
+    hipEvent_t                       reference{};
+    std::vector<hipblas_stream_span> spans;
+};
+
+static hipblas_stream_group stream_group;
+
+// Membership of this thread in the group
+struct hipblas_stream_member
+{
+    int         index   = -1;
+    hipStream_t stream  = nullptr;
+    bool        arrived = false;
+};
+
+static thread_local hipblas_stream_member stream_member;
+
+// Stream of the handles created on this thread, null for their default stream
+static thread_local hipStream_t local_stream = nullptr;
+
+void hipblas_set_local_stream(hipStream_t stream)
+{
+    local_stream = stream;
+}
+
 hipblasLocalHandle::hipblasLocalHandle()
 {
     auto status = hipblasCreate(&m_handle);
@@ -197,17 +235,21 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
         status = hipblasSetAtomicsMode(m_handle, hipblasAtomicsMode_t(arg.atomics_mode));
     if(status == HIPBLAS_STATUS_SUCCESS)
     {
-        /*
         // If the test specifies user allocated workspace, allocate and use it
-        if(arg.user_allocated_workspace)
+        size_t workspace = arg.user_allocated_workspace ? arg.user_allocated_workspace
+                                                        : hipblas_client_workspace;
+        if(workspace)
         {
-            if((hipMalloc)(&m_memory, arg.user_allocated_workspace) != hipSuccess)
+            if((hipMalloc)(&m_memory, workspace) != hipSuccess)
                 throw std::bad_alloc();
-            status = rocblas_set_workspace(m_handle, m_memory, arg.user_allocated_workspace);
+            status = hipblasSetWorkspace(m_handle, m_memory, workspace);
         }
-    */
     }
-    else
+    if(status == HIPBLAS_STATUS_SUCCESS && arg.solution_index)
+        status = hipblasSetGemmSolutionIndex(m_handle, arg.solution_index);
+    if(status == HIPBLAS_STATUS_SUCCESS && local_stream)
+        status = hipblasSetStream(m_handle, local_stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
         throw std::runtime_error(hipblasStatusToString(status));
     }
@@ -226,6 +268,411 @@ hipblasLocalHandle::~hipblasLocalHandle()
     }
 }
 
+// Events of the hot loop being timed on this thread, reused across loops: one before each
+// iteration and one after the last when per_iteration, else the two ends of the loop
+struct hipblas_iteration_events
+{
+    std::vector<hipEvent_t> events;
+    int                     recorded      = 0; // events of the loop, -1 if one failed
+    bool                    per_iteration = false;
+
+    ~hipblas_iteration_events()
+    {
+        for(hipEvent_t event : events)
+            (void)hipEventDestroy(event);
+    }
+};
+
+static thread_local hipblas_iteration_events iteration_events;
+
+// Record the next event of the loop on stream
+static void hipblas_record_loop_event(hipStream_t stream)
+{
+    auto& events = iteration_events.events;
+    int   next   = iteration_events.recorded;
+    if(next < 0)
+        return;
+
+    if(size_t(next) == events.size())
+    {
+        hipEvent_t event;
+        if(hipEventCreate(&event) != hipSuccess)
+        {
+            iteration_events.recorded = -1;
+            return;
+        }
+        events.push_back(event);
+    }
+    iteration_events.recorded = hipEventRecord(events[next], stream) == hipSuccess ? next + 1 : -1;
+}
+
+// Timed replays of the graph of a hipblas-bench --graph loop, after an untimed one
+static const int graph_replays = 10;
+
+// Capture of the hot loop of this thread into a graph
+struct hipblas_graph_capture
+{
+    hipblas_graph_mode  mode      = hipblas_graph_mode::off;
+    int                 iters     = 0;
+    hipStream_t         capturing = nullptr; // stream being captured, null if none
+    hipError_t          status    = hipSuccess;
+    std::vector<double> times_us; // time per call of each timed replay
+};
+
+static thread_local hipblas_graph_capture graph_capture;
+
+void hipblas_set_graph_mode(hipblas_graph_mode mode, int iters)
+{
+    graph_capture.mode  = mode;
+    graph_capture.iters = iters;
+}
+
+hipblas_graph_mode hipblas_get_graph_mode()
+{
+    return graph_capture.mode;
+}
+
+void hipblas_graph_abort()
+{
+    if(!graph_capture.capturing)
+        return;
+
+    hipGraph_t graph = nullptr;
+    (void)hipStreamEndCapture(graph_capture.capturing, &graph);
+    if(graph)
+        (void)hipGraphDestroy(graph);
+    graph_capture.capturing = nullptr;
+    if(graph_capture.status == hipSuccess)
+        graph_capture.status = hipErrorStreamCaptureInvalidated;
+}
+
+hipError_t hipblas_take_graph_status()
+{
+    hipError_t status    = graph_capture.status;
+    graph_capture.status = hipSuccess;
+    return status;
+}
+
+// Launch exec on stream once untimed, then graph_replays times, timing each launch
+static hipError_t hipblas_graph_replay(hipGraphExec_t exec, hipStream_t stream)
+{
+    hipEvent_t start, stop;
+    hipError_t status = hipEventCreate(&start);
+    if(status != hipSuccess)
+        return status;
+    status = hipEventCreate(&stop);
+    if(status == hipSuccess)
+    {
+        status = hipGraphLaunch(exec, stream);
+        if(status == hipSuccess)
+            status = hipStreamSynchronize(stream);
+
+        for(int replay = 0; replay < graph_replays && status == hipSuccess; replay++)
+        {
+            float ms;
+            status = hipEventRecord(start, stream);
+            if(status == hipSuccess)
+                status = hipGraphLaunch(exec, stream);
+            if(status == hipSuccess)
+                status = hipEventRecord(stop, stream);
+            if(status == hipSuccess)
+                status = hipEventSynchronize(stop);
+            if(status == hipSuccess)
+                status = hipEventElapsedTime(&ms, start, stop);
+            if(status == hipSuccess)
+                graph_capture.times_us.push_back(ms * 1000.0 / graph_capture.iters);
+        }
+        (void)hipEventDestroy(stop);
+    }
+    (void)hipEventDestroy(start);
+    return status;
+}
+
+// Begin the capture of a hot loop on stream before its first iteration
+static void hipblas_graph_begin(hipStream_t stream)
+{
+    graph_capture.times_us.clear();
+    graph_capture.status = hipStreamBeginCapture(stream, hipStreamCaptureModeGlobal);
+    if(graph_capture.status == hipSuccess)
+        graph_capture.capturing = stream;
+}
+
+// End the capture of a hot loop on stream after its last iteration, then instantiate and
+// replay the graph
+static void hipblas_graph_end(hipStream_t stream)
+{
+    if(graph_capture.capturing != stream)
+        return;
+
+    hipGraph_t graph        = nullptr;
+    hipError_t status       = hipStreamEndCapture(stream, &graph);
+    graph_capture.capturing = nullptr;
+    if(status == hipSuccess && !graph)
+        status = hipErrorStreamCaptureInvalidated;
+    if(status == hipSuccess)
+    {
+        hipGraphExec_t exec;
+        status = hipGraphInstantiate(&exec, graph, nullptr, nullptr, 0);
+        if(status == hipSuccess)
+        {
+            status = hipblas_graph_replay(exec, stream);
+            (void)hipGraphExecDestroy(exec);
+        }
+    }
+    if(graph)
+        (void)hipGraphDestroy(graph);
+    if(status != hipSuccess)
+        graph_capture.times_us.clear();
+    graph_capture.status = status;
+}
+
+void hipblas_stream_group_begin(int streams)
+{
+    std::lock_guard<std::mutex> lock(stream_group.mutex);
+    stream_group.size    = streams;
+    stream_group.arrived = 0;
+    stream_group.spans.assign(streams, {});
+    if(!stream_group.reference)
+        CHECK_HIP_ERROR(hipEventCreate(&stream_group.reference));
+}
+
+void hipblas_stream_group_join(int index, hipStream_t stream)
+{
+    stream_member = {index, stream, false};
+}
+
+// Wait for the other streams of the group to arrive; the last one records the reference event
+static void hipblas_stream_group_arrive(hipStream_t stream)
+{
+    std::unique_lock<std::mutex> lock(stream_group.mutex);
+    stream_member.arrived = true;
+    if(++stream_group.arrived == stream_group.size)
+    {
+        CHECK_HIP_ERROR(hipEventRecord(stream_group.reference, stream));
+        stream_group.released.notify_all();
+    }
+    else
+        stream_group.released.wait(lock, [] { return stream_group.arrived >= stream_group.size; });
+}
+
+void hipblas_stream_group_leave()
+{
+    if(stream_member.index >= 0 && !stream_member.arrived)
+        hipblas_stream_group_arrive(stream_member.stream);
+    stream_member = {};
+}
+
+int hipblas_stream_group_index()
+{
+    return stream_member.index;
+}
+
+void hipblas_stream_group_work(int calls, double gflop, double gbyte)
+{
+    if(stream_member.index < 0)
+        return;
+    std::lock_guard<std::mutex> lock(stream_group.mutex);
+    auto&                       span = stream_group.spans[stream_member.index];
+    span.calls                       = calls;
+    span.gflop                       = gflop;
+    span.gbyte                       = gbyte;
+}
+
+std::vector<hipblas_stream_span> hipblas_stream_group_end()
+{
+    std::lock_guard<std::mutex> lock(stream_group.mutex);
+    stream_group.size = 0;
+    return std::move(stream_group.spans);
+}
+
+// Span of the hot loop recorded by the events of this thread, relative to the group reference
+static void hipblas_stream_group_span(int recorded)
+{
+    auto&                       events = iteration_events.events;
+    std::lock_guard<std::mutex> lock(stream_group.mutex);
+    auto&                       span = stream_group.spans[stream_member.index];
+
+    float start_ms, end_ms;
+    span.recorded
+        = hipEventSynchronize(stream_group.reference) == hipSuccess
+          && hipEventElapsedTime(&start_ms, stream_group.reference, events[0]) == hipSuccess
+          && hipEventElapsedTime(&end_ms, stream_group.reference, events[recorded - 1])
+                 == hipSuccess;
+    span.start_us = start_ms * 1000.0;
+    span.end_us   = end_ms * 1000.0;
+}
+
+hipblas_hot_loop::hipblas_hot_loop(const Arguments& arg, hipStream_t stream)
+    : m_stream(stream)
+    , m_cold_iters(arg.cold_iters)
+    , m_iters(arg.iters)
+    , m_stats(arg.iteration_stats)
+    , m_replay(graph_capture.mode == hipblas_graph_mode::replay)
+    , m_group(stream_member.index >= 0)
+{
+    iteration_events.recorded      = 0;
+    iteration_events.per_iteration = m_stats;
+}
+
+hipblas_hot_loop::~hipblas_hot_loop()
+{
+    hipblas_graph_abort();
+}
+
+bool hipblas_hot_loop::next(int iter)
+{
+    int hot = iter - m_cold_iters;
+    if(hot == 0)
+        start();
+    if(hot < m_iters)
+    {
+        // A loop of a --streams group is timed on the GPU, at each iteration with statistics
+        if(m_group && (hot == 0 || (hot > 0 && m_stats)))
+            hipblas_record_loop_event(m_stream);
+        return true;
+    }
+    if(hot == m_iters)
+        stop();
+    if(!m_rerun)
+        return false;
+
+    hipblas_record_loop_event(m_stream);
+    return hot < 2 * m_iters;
+}
+
+void hipblas_hot_loop::start()
+{
+    m_time_us = get_time_us_sync(m_stream);
+    if(m_replay)
+        hipblas_graph_begin(m_stream);
+    else if(m_group && !stream_member.arrived)
+    {
+        // The hot loops of a --streams group start together
+        hipblas_stream_group_arrive(m_stream);
+    }
+}
+
+void hipblas_hot_loop::stop()
+{
+    if(m_replay)
+        hipblas_graph_end(m_stream);
+    else if(m_group)
+        hipblas_record_loop_event(m_stream);
+    m_time_us = get_time_us_sync(m_stream) - m_time_us;
+
+    // The events of the statistics would be in the wall time, so they time a second pass
+    m_rerun = m_stats && !m_replay && !m_group && m_iters > 0;
+}
+
+hipblas_loop_timing hipblas_take_loop_timing()
+{
+    hipblas_loop_timing timing;
+    if(graph_capture.mode == hipblas_graph_mode::replay)
+    {
+        timing.times_us = std::move(graph_capture.times_us);
+        if(!timing.times_us.empty())
+        {
+            timing.loop_us = 0;
+            for(double time_us : timing.times_us)
+                timing.loop_us += time_us;
+            timing.loop_us = timing.loop_us / timing.times_us.size() * graph_capture.iters;
+        }
+        return timing;
+    }
+
+    auto& events              = iteration_events.events;
+    int   recorded            = iteration_events.recorded;
+    iteration_events.recorded = 0;
+    if(recorded < 2 || hipEventSynchronize(events[recorded - 1]) != hipSuccess)
+        return timing;
+
+    for(int iter = 1; iter < recorded && iteration_events.per_iteration; iter++)
+    {
+        float ms;
+        if(hipEventElapsedTime(&ms, events[iter - 1], events[iter]) != hipSuccess)
+        {
+            timing.times_us.clear();
+            break;
+        }
+        timing.times_us.push_back(ms * 1000.0);
+    }
+    if(stream_member.index >= 0)
+    {
+        float ms;
+        if(hipEventElapsedTime(&ms, events[0], events[recorded - 1]) == hipSuccess)
+            timing.loop_us = ms * 1000.0;
+        hipblas_stream_group_span(recorded);
+    }
+    return timing;
+}
+
+static thread_local size_t flush_copies = 1;
+
+size_t hipblas_flush_copies(const Arguments& arg, size_t bytes)
+{
+    if(arg.flush_memory_size)
+        flush_copies = arg.flush_memory_size / std::max(bytes, size_t(1)) + 1;
+    else
+        flush_copies = std::max(arg.flush_batch_count, int64_t(1));
+    return flush_copies;
+}
+
+size_t hipblas_take_flush_copies()
+{
+    size_t copies = flush_copies;
+    flush_copies  = 1;
+    return copies;
+}
+
+// Memory kept by the device pool of this thread, by size, and the size of each block it gave
+struct hipblas_device_pool
+{
+    bool                              enabled = false;
+    std::multimap<size_t, void*>      kept;
+    std::unordered_map<void*, size_t> given;
+};
+
+static thread_local hipblas_device_pool device_pool;
+
+void hipblas_device_pool_enable(bool enable)
+{
+    device_pool.enabled = enable;
+    if(!enable)
+    {
+        for(auto& block : device_pool.kept)
+            CHECK_HIP_ERROR((hipFree)(block.second));
+        device_pool.kept.clear();
+        device_pool.given.clear();
+    }
+}
+
+void* hipblas_device_pool_take(size_t bytes)
+{
+    auto block = device_pool.kept.lower_bound(bytes);
+    if(!device_pool.enabled || block == device_pool.kept.end())
+        return nullptr;
+
+    void* ptr              = block->second;
+    device_pool.given[ptr] = block->first;
+    device_pool.kept.erase(block);
+    return ptr;
+}
+
+bool hipblas_device_pool_keep(void* ptr, size_t bytes)
+{
+    if(!device_pool.enabled)
+        return false;
+
+    auto given = device_pool.given.find(ptr);
+    if(given != device_pool.given.end())
+    {
+        bytes = given->second;
+        device_pool.given.erase(given);
+    }
+    device_pool.kept.emplace(bytes, ptr);
+    return true;
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
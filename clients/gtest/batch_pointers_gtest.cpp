@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "testing_batch_pointers.hpp"
+#include "utility.h"
+
+using ::testing::TestWithParam;
+using ::testing::Values;
+
+typedef std::tuple<bool> batch_pointers_tuple;
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS batch_pointers:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_batch_pointers_arguments(batch_pointers_tuple tup)
+{
+    Arguments arg;
+    arg.fortran = std::get<0>(tup);
+    return arg;
+}
+
+class batch_pointers_gtest : public ::TestWithParam<batch_pointers_tuple>
+{
+protected:
+    batch_pointers_gtest() {}
+    virtual ~batch_pointers_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(batch_pointers_gtest, default)
+{
+    Arguments       arg    = setup_batch_pointers_arguments(GetParam());
+    hipblasStatus_t status = testing_batch_pointers(arg);
+
+    // Not supported when hipBLAS is built without the HIP compiler
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_auxiliary_small,
+                         batch_pointers_gtest,
+                         Values(batch_pointers_tuple(false)));
@@ -86,8 +86,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(gels_gtest_bad_arg, gels_gtest_bad_arg_test)
 {
     Arguments arg;
@@ -202,5 +200,3 @@ INSTANTIATE_TEST_SUITE_P(hipblasGels,
                                  ValuesIn(is_fortran)));
 
 INSTANTIATE_TEST_SUITE_P(hipblasGelsBadArg, gels_gtest_bad_arg, Combine(ValuesIn(is_fortran)));
-
-#endif
@@ -23,6 +23,8 @@
 
 #include "testing_gemm_batched_ex.hpp"
 #include "testing_gemm_ex.hpp"
+#include "testing_gemm_ex_epilogue.hpp"
+#include "testing_gemm_grouped_batched_ex.hpp"
 #include "testing_gemm_strided_batched_ex.hpp"
 #include "utility.h"
 #include <math.h>
@@ -339,6 +341,41 @@ Arguments setup_gemm_ex_arguments(gemm_ex_tuple tup)
     return arg;
 }
 
+// Epilogues are only defined for real floating point results, and have no Fortran interface
+bool gemm_ex_epilogue_testable(const Arguments& arg)
+{
+    return !arg.fortran
+           && (arg.c_type == HIPBLAS_R_16F || arg.c_type == HIPBLAS_R_16B
+               || arg.c_type == HIPBLAS_R_32F || arg.c_type == HIPBLAS_R_64F);
+}
+
+// Check the status of a test of a GEMM epilogue that did not succeed
+void check_gemm_ex_epilogue_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+    {
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+    }
+    else if(arg.transA == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+    {
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+    }
+    else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+    {
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+    }
+    else
+    {
+#ifndef __HIP_PLATFORM_NVCC__
+        // on HIP we should pass all tests
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+#else
+        // cuBLASLt has no scaling epilogue
+        EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+#endif
+    }
+}
+
 class gemm_ex_gtest : public ::TestWithParam<gemm_ex_tuple>
 {
 protected:
@@ -395,6 +432,23 @@ TEST_P(gemm_ex_gtest, standard)
     }
 }
 
+TEST_P(gemm_ex_gtest, gemm_ex_with_epilogue)
+{
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+    if(!gemm_ex_epilogue_testable(arg))
+        return;
+
+    // bias and relu, which both backends fuse into the GEMM
+    arg.activation = 'R';
+    arg.bias       = true;
+    arg.d_type     = arg.c_type;
+    arg.ldd        = arg.ldc;
+
+    hipblasStatus_t status = testing_gemm_ex_with_epilogue(arg);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        check_gemm_ex_epilogue_status(arg, status);
+}
+
 class gemm_batch_ex_gtest : public ::TestWithParam<gemm_ex_tuple>
 {
 protected:
@@ -451,6 +505,52 @@ TEST_P(gemm_batch_ex_gtest, gemm_batched_ex)
     }
 }
 
+TEST_P(gemm_batch_ex_gtest, gemm_grouped_batched_ex)
+{
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+
+    // hipblasGemmGroupedBatchedEx has no Fortran interface
+    if(arg.fortran)
+        return;
+
+    // three groups, each of its own shape
+    arg.group_count = 3;
+
+    hipblasStatus_t status = testing_gemm_grouped_batched_ex(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(status == HIPBLAS_STATUS_ARCH_MISMATCH)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_ARCH_MISMATCH, status);
+        }
+        else
+        {
+#ifndef __HIP_PLATFORM_NVCC__
+            // on HIP we should pass all tests
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+#else
+            // cublas/rocblas do not have identical support
+            // (i.e. cublas doesn't support i8/i32 here)
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status);
+#endif
+        }
+    }
+}
+
 TEST_P(gemm_batch_ex_gtest, gemm_strided_batched_ex)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
@@ -498,6 +598,23 @@ TEST_P(gemm_batch_ex_gtest, gemm_strided_batched_ex)
     }
 }
 
+TEST_P(gemm_batch_ex_gtest, gemm_strided_batched_ex_with_epilogue)
+{
+    Arguments arg = setup_gemm_ex_arguments(GetParam());
+    if(!gemm_ex_epilogue_testable(arg))
+        return;
+
+    // every step of the epilogue, written over C
+    arg.activation = 'G';
+    arg.scale_mode = 'C';
+    arg.bias       = true;
+    arg.inplace    = true;
+
+    hipblasStatus_t status = testing_gemm_strided_batched_ex_with_epilogue(arg);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        check_gemm_ex_epilogue_status(arg, status);
+}
+
 INSTANTIATE_TEST_SUITE_P(quick_blas_ex_small_int8,
                          gemm_ex_gtest,
                          Combine(ValuesIn(medium_matrix_size_range),
@@ -83,8 +83,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(geqrf_gtest_bad_arg, geqrf_gtest_bad_arg_test)
 {
     Arguments arg;
@@ -196,5 +194,3 @@ INSTANTIATE_TEST_SUITE_P(hipblasGeqrf,
                                  ValuesIn(is_fortran)));
 
 INSTANTIATE_TEST_SUITE_P(hipblasGeqrfBadArg, geqrf_gtest_bad_arg, Combine(ValuesIn(is_fortran)));
-
-#endif
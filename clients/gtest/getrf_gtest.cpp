@@ -79,8 +79,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(getrf_gtest, getrf_gtest_float)
 {
     // GetParam returns a tuple. The setup routine unpacks the tuple
@@ -268,5 +266,3 @@ INSTANTIATE_TEST_SUITE_P(hipblasGetrf,
                                  ValuesIn(stride_scale_range),
                                  ValuesIn(batch_count_range),
                                  ValuesIn(is_fortran)));
-
-#endif
@@ -84,8 +84,6 @@ protected:
     virtual void TearDown() {}
 };
 
-#ifndef __HIP_PLATFORM_NVCC__
-
 TEST_P(getrs_gtest_bad_arg, getrs_gtest_bad_arg_test)
 {
     Arguments arg;
@@ -197,5 +195,3 @@ INSTANTIATE_TEST_SUITE_P(hipblasGetrs,
                                  ValuesIn(is_fortran)));
 
 INSTANTIATE_TEST_SUITE_P(hipblasGetrsBadArg, getrs_gtest_bad_arg, Combine(ValuesIn(is_fortran)));
-
-#endif
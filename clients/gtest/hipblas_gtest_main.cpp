@@ -280,6 +280,35 @@ static void hipblas_set_listener()
     listeners.Append(listener);
 }
 
+// Parse and remove the --workspace option, which sets the size in bytes of a device workspace
+// allocated by the client for every test handle
+static void hipblas_parse_workspace(int& argc, char** argv)
+{
+    char** argv_p = argv + 1;
+    for(int i = 1; argv[i]; ++i)
+    {
+        if(!strcmp(argv[i], "--workspace"))
+        {
+            char* end = nullptr;
+            if(argv[i + 1])
+                hipblas_client_workspace = strtoull(argv[i + 1], &end, 10);
+            if(!end || end == argv[i + 1] || *end)
+            {
+                std::cerr << "The --workspace option requires a size in bytes" << std::endl;
+                exit(EXIT_FAILURE);
+            }
+            ++i;
+        }
+        else
+        {
+            *argv_p++ = argv[i];
+        }
+    }
+
+    *argv_p = nullptr;
+    argc    = argv_p - argv;
+}
+
 /* =====================================================================
       Main function:
 =================================================================== */
@@ -297,6 +326,8 @@ int main(int argc, char** argv)
     }
     set_device(0); // use first device
 
+    hipblas_parse_workspace(argc, argv);
+
     bool datafile = hipblas_parse_data(argc, argv);
 
     ::testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,77 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include "testing_ilp64.hpp"
+#include "utility.h"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+typedef std::tuple<std::vector<int>> ilp64_tuple;
+
+/* =====================================================================
+     BLAS ilp64:
+=================================================================== */
+
+// {M, N, K, batch_count}; small sizes, as every check compares the _64 variant
+// against the 32-bit function on the same problem
+const std::vector<std::vector<int>> ilp64_size_range = {
+    {1, 1, 1, 1},
+    {5, 6, 7, 3},
+    {64, 128, 33, 10},
+};
+
+/* ============================Setup Arguments======================================= */
+
+Arguments setup_ilp64_arguments(ilp64_tuple tup)
+{
+    std::vector<int> sizes = std::get<0>(tup);
+
+    Arguments arg;
+    arg.M           = sizes[0];
+    arg.N           = sizes[1];
+    arg.K           = sizes[2];
+    arg.batch_count = sizes[3];
+    return arg;
+}
+
+class ilp64_gtest : public ::TestWithParam<ilp64_tuple>
+{
+protected:
+    ilp64_gtest() {}
+    virtual ~ilp64_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(ilp64_gtest, default)
+{
+    Arguments       arg    = setup_ilp64_arguments(GetParam());
+    hipblasStatus_t status = testing_ilp64(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+INSTANTIATE_TEST_SUITE_P(hipblas_ilp64_small, ilp64_gtest, Combine(ValuesIn(ilp64_size_range)));
@@ -25,13 +25,37 @@
 #define _ARGUMENT_MODEL_HPP_
 
 #include "hipblas_arguments.hpp"
+#include "utility.h"
 #include <algorithm>
+#include <initializer_list>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace ArgumentLogging
 {
     const double NA_value = -1.0; // invalid for time, GFlop, GB
+
+    // Extra (name, value) columns a test logs after the performance fields
+    using Columns = std::initializer_list<std::pair<const char*, double>>;
+
+    // Statistics of the GPU times in microseconds of the hot iterations of a test
+    struct IterationStats
+    {
+        double min_us    = NA_value;
+        double median_us = NA_value;
+        double mean_us   = NA_value;
+        double p90_us    = NA_value;
+        double p99_us    = NA_value;
+        double stddev_us = NA_value;
+        int    outliers  = 0;
+    };
+
+    // Statistics of times_us, without the times further than outlier_threshold median absolute
+    // deviations from the median when outlier_threshold > 0
+    IterationStats iteration_stats(std::vector<double> times_us, double outlier_threshold);
 }
 
 // these aren't static as ArgumentModel is instantiated for many Arg lists
@@ -41,6 +65,25 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+// time in microseconds of one hot call of the last test that logged its performance
+void   ArgumentModel_set_log_time_us(double us);
+double ArgumentModel_get_log_time_us();
+
+// whether the name line of a test is printed when it is the same as that of the previous test
+void ArgumentModel_set_log_repeated_names(bool r);
+
+// print the name line, unless it is a repeat that is not printed, and the value line of a test;
+// the lines of tests logging concurrently are not interleaved
+void ArgumentModel_log_lines(std::ostream&      str,
+                             const std::string& names,
+                             const std::string& values);
+
+// file to which each test that logs its performance appends a record of its arguments, device,
+// library versions and performance, as a JSON object per line or as CSV; empty for none
+void ArgumentModel_set_log_output(const std::string& path, bool json);
+void ArgumentModel_log_output(const Arguments&                                    arg,
+                              const std::vector<std::pair<const char*, double>>& performance);
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -60,22 +103,49 @@ class ArgumentModel
     }
 
 public:
-    void log_perf(std::stringstream& name_line,
-                  std::stringstream& val_line,
-                  const Arguments&   arg,
-                  double             gpu_us,
-                  double             gflops,
-                  double             gbytes,
-                  double             norm1,
-                  double             norm2)
+    void log_perf(std::stringstream&       name_line,
+                  std::stringstream&       val_line,
+                  const Arguments&         arg,
+                  double                   gpu_us,
+                  double                   gflops,
+                  double                   gbytes,
+                  double                   norm1,
+                  double                   norm2,
+                  ArgumentLogging::Columns extra)
     {
         bool has_batch_count = has(e_batch_count, Args...);
         int  batch_count     = has_batch_count ? arg.batch_count : 1;
         int  hot_calls       = arg.iters < 1 ? 1 : arg.iters;
 
+        // GPU timing of the hot loop recorded by hipblas_hot_loop
+        hipblas_loop_timing timing = hipblas_take_loop_timing();
+
+        // The host time of the loop of a stream of a --streams group includes the wait for the
+        // other streams to start, and that of a --graph replay the capture and the replays, so
+        // those loops are timed on the GPU. A replay without a GPU time failed.
+        int                stream_index = hipblas_stream_group_index();
+        hipblas_graph_mode graph_mode   = hipblas_get_graph_mode();
+        bool               replay       = graph_mode == hipblas_graph_mode::replay;
+        hipError_t         graph_status = replay ? hipblas_take_graph_status() : hipSuccess;
+        if(timing.loop_us >= 0)
+            gpu_us = timing.loop_us;
+        hipblas_stream_group_work(
+            hot_calls, gflops * batch_count * hot_calls, gbytes * batch_count * hot_calls);
+
         // per/us to per/sec *10^6
-        double hipblas_gflops = gflops * batch_count * hot_calls / gpu_us * 1e6;
-        double hipblas_GBps   = gbytes * batch_count * hot_calls / gpu_us * 1e6;
+        bool   timed          = !replay || timing.loop_us >= 0;
+        double call_us        = timed ? gpu_us / hot_calls : ArgumentLogging::NA_value;
+        double hipblas_gflops = timed ? gflops * batch_count * hot_calls / gpu_us * 1e6
+                                      : ArgumentLogging::NA_value;
+        double hipblas_GBps   = timed ? gbytes * batch_count * hot_calls / gpu_us * 1e6
+                                      : ArgumentLogging::NA_value;
+
+        ArgumentModel_set_log_time_us(call_us);
+
+        if(graph_status != hipSuccess)
+            std::cerr << "--graph: the hot loop of " << arg.function
+                      << " could not be captured and replayed: " << hipGetErrorString(graph_status)
+                      << std::endl;
 
         // append performance fields
         if(name_line.rdbuf()->in_avail())
@@ -83,7 +153,65 @@ public:
         name_line << "hipblas-Gflops,hipblas-GB/s,hipblas-us,";
         if(val_line.rdbuf()->in_avail())
             val_line << ",";
-        val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
+        val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << call_us << ", ";
+
+        std::vector<std::pair<const char*, double>> record = {{"hipblas-Gflops", hipblas_gflops},
+                                                              {"hipblas-GB/s", hipblas_GBps},
+                                                              {"hipblas-us", call_us}};
+
+        if(arg.iteration_stats)
+        {
+            // statistics of the per-iteration times, NA_value if the loop did not record them
+            ArgumentLogging::IterationStats stats = ArgumentLogging::iteration_stats(
+                std::move(timing.times_us), arg.outlier_threshold);
+
+            name_line << "hipblas-us-min,hipblas-us-median,hipblas-us-mean,hipblas-us-p90,"
+                         "hipblas-us-p99,hipblas-us-stddev,";
+            val_line << stats.min_us << ", " << stats.median_us << ", " << stats.mean_us << ", "
+                     << stats.p90_us << ", " << stats.p99_us << ", " << stats.stddev_us << ", ";
+            record.insert(record.end(),
+                          {{"hipblas-us-min", stats.min_us},
+                           {"hipblas-us-median", stats.median_us},
+                           {"hipblas-us-mean", stats.mean_us},
+                           {"hipblas-us-p90", stats.p90_us},
+                           {"hipblas-us-p99", stats.p99_us},
+                           {"hipblas-us-stddev", stats.stddev_us}});
+            if(arg.outlier_threshold > 0)
+            {
+                name_line << "hipblas-us-outliers,";
+                val_line << stats.outliers << ", ";
+                record.push_back({"hipblas-us-outliers", stats.outliers});
+            }
+        }
+
+        // copies of the operands the hot loop rotated through, 1 if it ran with warm caches
+        size_t flush_copies = hipblas_take_flush_copies();
+        if(arg.flush_batch_count > 1 || arg.flush_memory_size)
+        {
+            const char* flush_mode = "none";
+            if(flush_copies > 1)
+                flush_mode = arg.flush_memory_size ? "memory_size" : "batch_count";
+            name_line << "flush_mode,flush_copies,";
+            val_line << flush_mode << ", " << flush_copies << ", ";
+            record.push_back({"flush_copies", double(flush_copies)});
+        }
+
+        if(graph_mode != hipblas_graph_mode::off)
+        {
+            const char* launch = "eager";
+            if(replay)
+                launch = graph_status == hipSuccess ? "graph" : "capture_failed";
+            name_line << "launch,";
+            val_line << launch << ", ";
+            record.push_back({"graph", replay ? 1 : 0});
+        }
+
+        if(stream_index >= 0)
+        {
+            name_line << "stream,";
+            val_line << stream_index << ", ";
+            record.push_back({"stream", stream_index});
+        }
 
         if(arg.unit_check || arg.norm_check)
         {
@@ -91,18 +219,30 @@ public:
             {
                 name_line << "norm_error_host_ptr,norm_error_device_ptr,";
                 val_line << norm1 << ", " << norm2 << ", ";
+                record.push_back({"norm_error_host_ptr", norm1});
+                record.push_back({"norm_error_device_ptr", norm2});
             }
         }
+
+        for(auto& column : extra)
+        {
+            name_line << column.first << ",";
+            val_line << column.second << ", ";
+            record.push_back(column);
+        }
+
+        ArgumentModel_log_output(arg, record);
     }
 
     template <typename T>
-    void log_args(std::ostream&    str,
-                  const Arguments& arg,
-                  double           gpu_us,
-                  double           gflops,
-                  double           gpu_bytes = 0,
-                  double           norm1     = 0,
-                  double           norm2     = 0)
+    void log_args(std::ostream&            str,
+                  const Arguments&         arg,
+                  double                   gpu_us,
+                  double                   gflops,
+                  double                   gpu_bytes = 0,
+                  double                   norm1     = 0,
+                  double                   norm2     = 0,
+                  ArgumentLogging::Columns extra     = {})
     {
         if(arg.iters < 1)
             return; // warmup test only
@@ -175,9 +315,9 @@ public:
 #endif
 
         if(arg.timing)
-            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2);
+            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2, extra);
 
-        str << name_list.str() << "\n" << value_list.str() << std::endl;
+        ArgumentModel_log_lines(str, name_list.str(), value_list.str());
     }
 
     void test_name(const Arguments& arg, std::string& name)
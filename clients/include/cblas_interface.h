@@ -199,6 +199,10 @@ void cblas_symv(
 template <typename T>
 int cblas_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int cblas_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
 // tbmv
 template <typename T>
 void cblas_tbmv(hipblasFillMode_t  uplo,
@@ -24,6 +24,7 @@
 #pragma once
 
 #include "hipblas.h"
+#include "utility.h"
 #include <cinttypes>
 #include <clocale>
 #include <cstdio>
@@ -63,8 +64,8 @@ protected:
 
     T* device_vector_setup()
     {
-        T* d;
-        if((hipMalloc)(&d, bytes) != hipSuccess)
+        T* d = static_cast<T*>(hipblas_device_pool_take(bytes));
+        if(!d && (hipMalloc)(&d, bytes) != hipSuccess)
         {
             static char* lc = setlocale(LC_NUMERIC, "");
             fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
@@ -114,8 +115,9 @@ protected:
                 EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
             }
 #endif
-            // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            // Free device memory, unless the device pool keeps it
+            if(!hipblas_device_pool_keep(d, bytes))
+                CHECK_HIP_ERROR((hipFree)(d));
         }
     }
 };
@@ -1908,6 +1908,33 @@ hipblasStatus_t hipblasGetrfStridedBatched(hipblasHandle_t     handle,
                                            int*                info,
                                            const int           batchCount);
 
+// getrf_rect
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetrfRect(
+    hipblasHandle_t handle, const int m, const int n, T* A, const int lda, int* ipiv, int* info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetrfRectBatched(hipblasHandle_t handle,
+                                        const int       m,
+                                        const int       n,
+                                        T* const        A[],
+                                        const int       lda,
+                                        int*            ipiv,
+                                        int*            info,
+                                        const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetrfRectStridedBatched(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               T*                  A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               int*                ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batchCount);
+
 // getrs
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGetrs(hipblasHandle_t          handle,
@@ -1951,6 +1978,16 @@ hipblasStatus_t hipblasGetrsStridedBatched(hipblasHandle_t          handle,
                                            const int                batchCount);
 
 // getri
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetri(hipblasHandle_t handle,
+                             const int       n,
+                             T*              A,
+                             const int       lda,
+                             int*            ipiv,
+                             T*              C,
+                             const int       ldc,
+                             int*            info);
+
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
                                     const int       n,
@@ -1962,6 +1999,20 @@ hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
                                     int*            info,
                                     const int       batchCount);
 
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasGetriStridedBatched(hipblasHandle_t     handle,
+                                           const int           n,
+                                           T*                  A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           int*                ipiv,
+                                           const hipblasStride strideP,
+                                           T*                  C,
+                                           const int           ldc,
+                                           const hipblasStride strideC,
+                                           int*                info,
+                                           const int           batchCount);
+
 // geqrf
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasGeqrf(
@@ -2033,6 +2084,124 @@ hipblasStatus_t hipblasGelsStridedBatched(hipblasHandle_t     handle,
                                           int*                deviceInfo,
                                           const int           batchCount);
 
+// potrf
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrf(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potrs
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrs(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const int               nrhs,
+                             T*                      A,
+                             const int               lda,
+                             T*                      B,
+                             const int               ldb,
+                             int*                    info);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T* const                A[],
+                                    const int               lda,
+                                    T* const                B[],
+                                    const int               ldb,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasPotrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const hipblasStride     strideA,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const hipblasStride     strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// XXgesv: T is the precision of the solution, refined from a factorization in lower precision
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXXgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              T*              A,
+                              const int       lda,
+                              int*            ipiv,
+                              T*              B,
+                              const int       ldb,
+                              T*              X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info,
+                              int*            deviceInfo);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXXgesvBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     const int       nrhs,
+                                     T* const        A[],
+                                     const int       lda,
+                                     int*            ipiv,
+                                     T* const        B[],
+                                     const int       ldb,
+                                     T* const        X[],
+                                     const int       ldx,
+                                     int*            iter,
+                                     int*            info,
+                                     int*            deviceInfo,
+                                     const int       batchCount);
+
+template <typename T, bool FORTRAN = false>
+hipblasStatus_t hipblasXXgesvStridedBatched(hipblasHandle_t     handle,
+                                            const int           n,
+                                            const int           nrhs,
+                                            T*                  A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            int*                ipiv,
+                                            const hipblasStride strideP,
+                                            T*                  B,
+                                            const int           ldb,
+                                            const hipblasStride strideB,
+                                            T*                  X,
+                                            const int           ldx,
+                                            const hipblasStride strideX,
+                                            int*                iter,
+                                            int*                info,
+                                            int*                deviceInfo,
+                                            const int           batchCount);
+
 // dgmm
 template <typename T, bool FORTRAN = false>
 hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
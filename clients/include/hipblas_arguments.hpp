@@ -77,19 +77,20 @@ struct Arguments
 {
     // if you add or reorder members you must update FOR_EACH_ARGUMENT macro
 
-    int M  = 128;
-    int N  = 128;
-    int K  = 128;
-    int KL = 128;
-    int KU = 128;
+    // sizes are 64-bit so that the _64 (ILP64) API can be exercised
+    int64_t M  = 128;
+    int64_t N  = 128;
+    int64_t K  = 128;
+    int64_t KL = 128;
+    int64_t KU = 128;
 
     int rows = 128;
     int cols = 128;
 
-    int lda = 128;
-    int ldb = 128;
-    int ldc = 128;
-    int ldd = 128;
+    int64_t lda = 128;
+    int64_t ldb = 128;
+    int64_t ldc = 128;
+    int64_t ldd = 128;
 
     hipblasDatatype_t a_type = HIPBLAS_R_32F;
     hipblasDatatype_t b_type = HIPBLAS_R_32F;
@@ -103,10 +104,10 @@ struct Arguments
     // used for gemmEx with HIPBLAS_V2 define
     hipblasComputeType_t compute_type_gemm = HIPBLAS_COMPUTE_32F;
 
-    int incx = 1;
-    int incy = 1;
-    int incd = 1;
-    int incb = 1;
+    int64_t incx = 1;
+    int64_t incy = 1;
+    int64_t incd = 1;
+    int64_t incb = 1;
 
     double        stride_scale = 1.0;
     hipblasStride stride_a; //  stride_a > transA == 'N' ? lda * K : lda * M
@@ -131,11 +132,18 @@ struct Arguments
     char uplo   = 'L';
     char diag   = 'N';
 
-    int apiCallCount = 1;
-    int batch_count  = 10;
+    int     apiCallCount = 1;
+    int64_t batch_count  = 10;
+    int     group_count  = 1; // only for gemm_grouped_batched_ex
+
+    // only for the gemm_ex epilogues
+    char activation = 'N'; // N = none, R = relu, G = gelu
+    char scale_mode = 'N'; // N = none, R = row, C = column
+    bool bias       = false;
+    bool unfused    = false; // time the epilogue as separate calls after the GEMM
 
     bool fortran    = false;
-    bool inplace    = false; // only for trmm
+    bool inplace    = false; // trmm, and the gemm_ex epilogues writing C instead of D
     bool with_flags = false;
 
     int      norm_check = 0;
@@ -143,6 +151,19 @@ struct Arguments
     int      timing     = 0;
     int      iters      = 10;
     int      cold_iters = 2;
+
+    // time each hot iteration on the GPU, in a second pass of the hot loop, for the statistics
+    bool iteration_stats = false;
+
+    // reject hot iterations further than this many median absolute deviations from the median
+    // from the timing statistics, 0 to keep them all
+    double outlier_threshold = 0;
+
+    // run the hot iterations on flush_batch_count copies of the operands in turn, or on enough
+    // copies to exceed flush_memory_size bytes, so that they start with cold caches
+    int64_t flush_batch_count = 1;
+    size_t  flush_memory_size = 0;
+
     uint32_t algo;
     int32_t  solution_index;
     uint32_t flags;
@@ -152,69 +173,82 @@ struct Arguments
 
     int atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
 
+    // size in bytes of a device workspace allocated by the client, 0 to let the library manage it
+    size_t user_allocated_workspace = 0;
+
     hipblas_initialization initialization = hipblas_initialization::rand_int;
 
     // clang-format off
 
 // Generic macro which operates over the list of arguments in order of declaration
-#define FOR_EACH_ARGUMENT(OPER, SEP) \
-    OPER(M) SEP                      \
-    OPER(N) SEP                      \
-    OPER(K) SEP                      \
-    OPER(KL) SEP                     \
-    OPER(KU) SEP                     \
-    OPER(rows) SEP                   \
-    OPER(cols) SEP                   \
-    OPER(lda) SEP                    \
-    OPER(ldb) SEP                    \
-    OPER(ldc) SEP                    \
-    OPER(ldd) SEP                    \
-    OPER(a_type) SEP                 \
-    OPER(b_type) SEP                 \
-    OPER(c_type) SEP                 \
-    OPER(d_type) SEP                 \
-    OPER(compute_type) SEP           \
-    OPER(compute_type_gemm) SEP      \
-    OPER(incx) SEP                   \
-    OPER(incy) SEP                   \
-    OPER(incd) SEP                   \
-    OPER(incb) SEP                   \
-    OPER(stride_scale) SEP           \
-    OPER(stride_a) SEP               \
-    OPER(stride_b) SEP               \
-    OPER(stride_c) SEP               \
-    OPER(stride_d) SEP               \
-    OPER(stride_x) SEP               \
-    OPER(stride_y) SEP               \
-    OPER(start) SEP                  \
-    OPER(end) SEP                    \
-    OPER(step) SEP                   \
-    OPER(alpha) SEP                  \
-    OPER(alphai) SEP                 \
-    OPER(beta) SEP                   \
-    OPER(betai) SEP                  \
-    OPER(transA) SEP                 \
-    OPER(transB) SEP                 \
-    OPER(side) SEP                   \
-    OPER(uplo) SEP                   \
-    OPER(diag) SEP                   \
-    OPER(apiCallCount) SEP           \
-    OPER(batch_count) SEP            \
-    OPER(fortran) SEP                \
-    OPER(inplace) SEP                \
-    OPER(with_flags) SEP             \
-    OPER(norm_check) SEP             \
-    OPER(unit_check) SEP             \
-    OPER(timing) SEP                 \
-    OPER(iters) SEP                  \
-    OPER(cold_iters) SEP             \
-    OPER(algo) SEP                   \
-    OPER(solution_index) SEP         \
-    OPER(flags) SEP                  \
-    OPER(function) SEP               \
-    OPER(name) SEP                   \
-    OPER(category) SEP               \
-    OPER(atomics_mode) SEP           \
+#define FOR_EACH_ARGUMENT(OPER, SEP)   \
+    OPER(M) SEP                        \
+    OPER(N) SEP                        \
+    OPER(K) SEP                        \
+    OPER(KL) SEP                       \
+    OPER(KU) SEP                       \
+    OPER(rows) SEP                     \
+    OPER(cols) SEP                     \
+    OPER(lda) SEP                      \
+    OPER(ldb) SEP                      \
+    OPER(ldc) SEP                      \
+    OPER(ldd) SEP                      \
+    OPER(a_type) SEP                   \
+    OPER(b_type) SEP                   \
+    OPER(c_type) SEP                   \
+    OPER(d_type) SEP                   \
+    OPER(compute_type) SEP             \
+    OPER(compute_type_gemm) SEP        \
+    OPER(incx) SEP                     \
+    OPER(incy) SEP                     \
+    OPER(incd) SEP                     \
+    OPER(incb) SEP                     \
+    OPER(stride_scale) SEP             \
+    OPER(stride_a) SEP                 \
+    OPER(stride_b) SEP                 \
+    OPER(stride_c) SEP                 \
+    OPER(stride_d) SEP                 \
+    OPER(stride_x) SEP                 \
+    OPER(stride_y) SEP                 \
+    OPER(start) SEP                    \
+    OPER(end) SEP                      \
+    OPER(step) SEP                     \
+    OPER(alpha) SEP                    \
+    OPER(alphai) SEP                   \
+    OPER(beta) SEP                     \
+    OPER(betai) SEP                    \
+    OPER(transA) SEP                   \
+    OPER(transB) SEP                   \
+    OPER(side) SEP                     \
+    OPER(uplo) SEP                     \
+    OPER(diag) SEP                     \
+    OPER(apiCallCount) SEP             \
+    OPER(batch_count) SEP              \
+    OPER(group_count) SEP              \
+    OPER(activation) SEP               \
+    OPER(scale_mode) SEP               \
+    OPER(bias) SEP                     \
+    OPER(unfused) SEP                  \
+    OPER(fortran) SEP                  \
+    OPER(inplace) SEP                  \
+    OPER(with_flags) SEP               \
+    OPER(norm_check) SEP               \
+    OPER(unit_check) SEP               \
+    OPER(timing) SEP                   \
+    OPER(iters) SEP                    \
+    OPER(cold_iters) SEP               \
+    OPER(iteration_stats) SEP          \
+    OPER(outlier_threshold) SEP        \
+    OPER(flush_batch_count) SEP        \
+    OPER(flush_memory_size) SEP        \
+    OPER(algo) SEP                     \
+    OPER(solution_index) SEP           \
+    OPER(flags) SEP                    \
+    OPER(function) SEP                 \
+    OPER(name) SEP                     \
+    OPER(category) SEP                 \
+    OPER(atomics_mode) SEP             \
+    OPER(user_allocated_workspace) SEP \
     OPER(initialization)
 
     // clang-format on
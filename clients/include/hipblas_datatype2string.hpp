@@ -28,6 +28,7 @@
 #include "hipblas.hpp"
 #include <ostream>
 #include <string>
+#include <type_traits>
 
 enum hipblas_initialization
 {
@@ -178,4 +179,40 @@ inline constexpr auto hipblas_computetype2string(hipblasComputeType_t type)
     return "invalid";
 }
 
+// hipDataType and hipblasComputeType_t of a client type, for the functions that always take them
+// whatever HIPBLAS_V2, such as hipblasGemmGroupedBatchedEx and the GEMM epilogues
+template <typename T>
+constexpr hipDataType hipblas_type2datatype()
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return HIP_R_16F;
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return HIP_R_16BF;
+    else if constexpr(std::is_same_v<T, float>)
+        return HIP_R_32F;
+    else if constexpr(std::is_same_v<T, double>)
+        return HIP_R_64F;
+    else if constexpr(std::is_same_v<T, int8_t>)
+        return HIP_R_8I;
+    else if constexpr(std::is_same_v<T, int32_t>)
+        return HIP_R_32I;
+    else if constexpr(std::is_same_v<T, hipblasComplex>)
+        return HIP_C_32F;
+    else
+        return HIP_C_64F;
+}
+
+template <typename Tex>
+constexpr hipblasComputeType_t hipblas_type2computetype()
+{
+    if constexpr(std::is_same_v<Tex, hipblasHalf>)
+        return HIPBLAS_COMPUTE_16F;
+    else if constexpr(std::is_same_v<Tex, double> || std::is_same_v<Tex, hipblasDoubleComplex>)
+        return HIPBLAS_COMPUTE_64F;
+    else if constexpr(std::is_same_v<Tex, int32_t>)
+        return HIPBLAS_COMPUTE_32I;
+    else
+        return HIPBLAS_COMPUTE_32F;
+}
+
 #endif
@@ -7002,6 +7002,121 @@ hipblasStatus_t hipblasZgetrfStridedBatchedFortran(hipblasHandle_t       handle,
                                                    int*                  info,
                                                    const int             batch_count);
 
+// getrf_rect
+hipblasStatus_t hipblasSgetrfRectFortran(hipblasHandle_t handle,
+                                         const int       m,
+                                         const int       n,
+                                         float*          A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         int*            info);
+
+hipblasStatus_t hipblasDgetrfRectFortran(hipblasHandle_t handle,
+                                         const int       m,
+                                         const int       n,
+                                         double*         A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         int*            info);
+
+hipblasStatus_t hipblasCgetrfRectFortran(hipblasHandle_t handle,
+                                         const int       m,
+                                         const int       n,
+                                         hipblasComplex* A,
+                                         const int       lda,
+                                         int*            ipiv,
+                                         int*            info);
+
+hipblasStatus_t hipblasZgetrfRectFortran(hipblasHandle_t       handle,
+                                         const int             m,
+                                         const int             n,
+                                         hipblasDoubleComplex* A,
+                                         const int             lda,
+                                         int*                  ipiv,
+                                         int*                  info);
+
+// getrf_rect_batched
+hipblasStatus_t hipblasSgetrfRectBatchedFortran(hipblasHandle_t handle,
+                                                const int       m,
+                                                const int       n,
+                                                float* const    A[],
+                                                const int       lda,
+                                                int*            ipiv,
+                                                int*            info,
+                                                const int       batchCount);
+
+hipblasStatus_t hipblasDgetrfRectBatchedFortran(hipblasHandle_t handle,
+                                                const int       m,
+                                                const int       n,
+                                                double* const   A[],
+                                                const int       lda,
+                                                int*            ipiv,
+                                                int*            info,
+                                                const int       batchCount);
+
+hipblasStatus_t hipblasCgetrfRectBatchedFortran(hipblasHandle_t       handle,
+                                                const int             m,
+                                                const int             n,
+                                                hipblasComplex* const A[],
+                                                const int             lda,
+                                                int*                  ipiv,
+                                                int*                  info,
+                                                const int             batchCount);
+
+hipblasStatus_t hipblasZgetrfRectBatchedFortran(hipblasHandle_t             handle,
+                                                const int                   m,
+                                                const int                   n,
+                                                hipblasDoubleComplex* const A[],
+                                                const int                   lda,
+                                                int*                        ipiv,
+                                                int*                        info,
+                                                const int                   batchCount);
+
+// getrf_rect_strided_batched
+hipblasStatus_t hipblasSgetrfRectStridedBatchedFortran(hipblasHandle_t     handle,
+                                                       const int           m,
+                                                       const int           n,
+                                                       float*              A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
+                                                       int*                info,
+                                                       const int           batchCount);
+
+hipblasStatus_t hipblasDgetrfRectStridedBatchedFortran(hipblasHandle_t     handle,
+                                                       const int           m,
+                                                       const int           n,
+                                                       double*             A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
+                                                       int*                info,
+                                                       const int           batchCount);
+
+hipblasStatus_t hipblasCgetrfRectStridedBatchedFortran(hipblasHandle_t     handle,
+                                                       const int           m,
+                                                       const int           n,
+                                                       hipblasComplex*     A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       int*                ipiv,
+                                                       const hipblasStride strideP,
+                                                       int*                info,
+                                                       const int           batchCount);
+
+hipblasStatus_t hipblasZgetrfRectStridedBatchedFortran(hipblasHandle_t       handle,
+                                                       const int             m,
+                                                       const int             n,
+                                                       hipblasDoubleComplex* A,
+                                                       const int             lda,
+                                                       const hipblasStride   strideA,
+                                                       int*                  ipiv,
+                                                       const hipblasStride   strideP,
+                                                       int*                  info,
+                                                       const int             batchCount);
+
 // getrs
 hipblasStatus_t hipblasSgetrsFortran(hipblasHandle_t          handle,
                                      const hipblasOperation_t trans,
@@ -7157,6 +7272,43 @@ hipblasStatus_t hipblasZgetrsStridedBatchedFortran(hipblasHandle_t          hand
                                                    int*                     info,
                                                    const int                batch_count);
 
+// getri
+hipblasStatus_t hipblasSgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     float*          A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     float*          C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasDgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     double*         A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double*         C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasCgetriFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     hipblasComplex* A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     hipblasComplex* C,
+                                     const int       ldc,
+                                     int*            info);
+
+hipblasStatus_t hipblasZgetriFortran(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasDoubleComplex* A,
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     hipblasDoubleComplex* C,
+                                     const int             ldc,
+                                     int*                  info);
+
 // getri_batched
 hipblasStatus_t hipblasSgetriBatchedFortran(hipblasHandle_t handle,
                                             const int       n,
@@ -7198,6 +7350,59 @@ hipblasStatus_t hipblasZgetriBatchedFortran(hipblasHandle_t             handle,
                                             int*                        info,
                                             const int                   batch_count);
 
+// getri_strided_batched
+hipblasStatus_t hipblasSgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   float*              A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   float*              C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batchCount);
+
+hipblasStatus_t hipblasDgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   double*             C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batchCount);
+
+hipblasStatus_t hipblasCgetriStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   hipblasComplex*     A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   hipblasComplex*     C,
+                                                   const int           ldc,
+                                                   const hipblasStride strideC,
+                                                   int*                info,
+                                                   const int           batchCount);
+
+hipblasStatus_t hipblasZgetriStridedBatchedFortran(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   const hipblasStride   strideA,
+                                                   int*                  ipiv,
+                                                   const hipblasStride   strideP,
+                                                   hipblasDoubleComplex* C,
+                                                   const int             ldc,
+                                                   const hipblasStride   strideC,
+                                                   int*                  info,
+                                                   const int             batchCount);
+
 // geqrf
 hipblasStatus_t hipblasSgeqrfFortran(hipblasHandle_t handle,
                                      const int       m,
@@ -7475,6 +7680,343 @@ hipblasStatus_t hipblasZgelsStridedBatchedFortran(hipblasHandle_t       handle,
                                                   int*                  info,
                                                   int*                  deviceInfo,
                                                   const int             batchCount);
+
+// potrf
+hipblasStatus_t hipblasSpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     float*                  A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrfFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     int*                    info);
+
+// potrf_batched
+hipblasStatus_t hipblasSpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            float* const            A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrf_strided_batched
+hipblasStatus_t hipblasSpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrfStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// potrs
+hipblasStatus_t hipblasSpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     float*                  A,
+                                     const int               lda,
+                                     float*                  B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasDpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasCpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasComplex*         A,
+                                     const int               lda,
+                                     hipblasComplex*         B,
+                                     const int               ldb,
+                                     int*                    info);
+
+hipblasStatus_t hipblasZpotrsFortran(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     hipblasDoubleComplex*   A,
+                                     const int               lda,
+                                     hipblasDoubleComplex*   B,
+                                     const int               ldb,
+                                     int*                    info);
+
+// potrs_batched
+hipblasStatus_t hipblasSpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            float* const            A[],
+                                            const int               lda,
+                                            float* const            B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsBatchedFortran(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            hipblasComplex* const   A[],
+                                            const int               lda,
+                                            hipblasComplex* const   B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsBatchedFortran(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            hipblasDoubleComplex* const B[],
+                                            const int                   ldb,
+                                            int*                        info,
+                                            const int                   batchCount);
+
+// potrs_strided_batched
+hipblasStatus_t hipblasSpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   float*                  A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   float*                  B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasDpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasCpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasComplex*         A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasComplex*         B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+hipblasStatus_t hipblasZpotrsStridedBatchedFortran(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   const hipblasStride     strideA,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   const hipblasStride     strideB,
+                                                   int*                    info,
+                                                   const int               batchCount);
+
+// XXgesv
+hipblasStatus_t hipblasDSgesvFortran(hipblasHandle_t handle,
+                                     const int       n,
+                                     const int       nrhs,
+                                     double*         A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     double*         B,
+                                     const int       ldb,
+                                     double*         X,
+                                     const int       ldx,
+                                     int*            iter,
+                                     int*            info,
+                                     int*            deviceInfo);
+
+hipblasStatus_t hipblasZCgesvFortran(hipblasHandle_t       handle,
+                                     const int             n,
+                                     const int             nrhs,
+                                     hipblasDoubleComplex* A,
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     hipblasDoubleComplex* B,
+                                     const int             ldb,
+                                     hipblasDoubleComplex* X,
+                                     const int             ldx,
+                                     int*                  iter,
+                                     int*                  info,
+                                     int*                  deviceInfo);
+
+// XXgesvBatched
+hipblasStatus_t hipblasDSgesvBatchedFortran(hipblasHandle_t handle,
+                                            const int       n,
+                                            const int       nrhs,
+                                            double* const   A[],
+                                            const int       lda,
+                                            int*            ipiv,
+                                            double* const   B[],
+                                            const int       ldb,
+                                            double* const   X[],
+                                            const int       ldx,
+                                            int*            iter,
+                                            int*            info,
+                                            int*            deviceInfo,
+                                            const int       batchCount);
+
+hipblasStatus_t hipblasZCgesvBatchedFortran(hipblasHandle_t             handle,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex* const A[],
+                                            const int                   lda,
+                                            int*                        ipiv,
+                                            hipblasDoubleComplex* const B[],
+                                            const int                   ldb,
+                                            hipblasDoubleComplex* const X[],
+                                            const int                   ldx,
+                                            int*                        iter,
+                                            int*                        info,
+                                            int*                        deviceInfo,
+                                            const int                   batchCount);
+
+// XXgesvStridedBatched
+hipblasStatus_t hipblasDSgesvStridedBatchedFortran(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   const int           nrhs,
+                                                   double*             A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   double*             B,
+                                                   const int           ldb,
+                                                   const hipblasStride strideB,
+                                                   double*             X,
+                                                   const int           ldx,
+                                                   const hipblasStride strideX,
+                                                   int*                iter,
+                                                   int*                info,
+                                                   int*                deviceInfo,
+                                                   const int           batchCount);
+
+hipblasStatus_t hipblasZCgesvStridedBatchedFortran(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   const hipblasStride   strideA,
+                                                   int*                  ipiv,
+                                                   const hipblasStride   strideP,
+                                                   hipblasDoubleComplex* B,
+                                                   const int             ldb,
+                                                   const hipblasStride   strideB,
+                                                   hipblasDoubleComplex* X,
+                                                   const int             ldx,
+                                                   const hipblasStride   strideX,
+                                                   int*                  iter,
+                                                   int*                  info,
+                                                   int*                  deviceInfo,
+                                                   const int             batchCount);
 }
 
 #ifdef HIPBLAS_V2
@@ -244,6 +244,253 @@ function hipblasZgetrfStridedBatchedFortran(handle, n, A, lda, stride_A, &
                                     ipiv, stride_P, info, batch_count)
 end function hipblasZgetrfStridedBatchedFortran
 
+! getrf_rect
+function hipblasSgetrfRectFortran(handle, m, n, A, lda, ipiv, &
+                                  info) &
+    bind(c, name='hipblasSgetrfRectFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRectFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasSgetrfRectFortran = &
+        hipblasSgetrfRect(handle, m, n, A, lda, ipiv, &
+                          info)
+end function hipblasSgetrfRectFortran
+
+function hipblasDgetrfRectFortran(handle, m, n, A, lda, ipiv, &
+                                  info) &
+    bind(c, name='hipblasDgetrfRectFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRectFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasDgetrfRectFortran = &
+        hipblasDgetrfRect(handle, m, n, A, lda, ipiv, &
+                          info)
+end function hipblasDgetrfRectFortran
+
+function hipblasCgetrfRectFortran(handle, m, n, A, lda, ipiv, &
+                                  info) &
+    bind(c, name='hipblasCgetrfRectFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRectFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasCgetrfRectFortran = &
+        hipblasCgetrfRect(handle, m, n, A, lda, ipiv, &
+                          info)
+end function hipblasCgetrfRectFortran
+
+function hipblasZgetrfRectFortran(handle, m, n, A, lda, ipiv, &
+                                  info) &
+    bind(c, name='hipblasZgetrfRectFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRectFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    hipblasZgetrfRectFortran = &
+        hipblasZgetrfRect(handle, m, n, A, lda, ipiv, &
+                          info)
+end function hipblasZgetrfRectFortran
+
+! getrf_rect_batched
+function hipblasSgetrfRectBatchedFortran(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+    bind(c, name='hipblasSgetrfRectBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRectBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgetrfRectBatchedFortran = &
+        hipblasSgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                 info, batch_count)
+end function hipblasSgetrfRectBatchedFortran
+
+function hipblasDgetrfRectBatchedFortran(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+    bind(c, name='hipblasDgetrfRectBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRectBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgetrfRectBatchedFortran = &
+        hipblasDgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                 info, batch_count)
+end function hipblasDgetrfRectBatchedFortran
+
+function hipblasCgetrfRectBatchedFortran(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+    bind(c, name='hipblasCgetrfRectBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRectBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgetrfRectBatchedFortran = &
+        hipblasCgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                 info, batch_count)
+end function hipblasCgetrfRectBatchedFortran
+
+function hipblasZgetrfRectBatchedFortran(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+    bind(c, name='hipblasZgetrfRectBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRectBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgetrfRectBatchedFortran = &
+        hipblasZgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                 info, batch_count)
+end function hipblasZgetrfRectBatchedFortran
+
+! getrf_rect_strided_batched
+function hipblasSgetrfRectStridedBatchedFortran(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+    bind(c, name='hipblasSgetrfRectStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRectStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgetrfRectStridedBatchedFortran = &
+        hipblasSgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                        ipiv, strideP, info, batch_count)
+end function hipblasSgetrfRectStridedBatchedFortran
+
+function hipblasDgetrfRectStridedBatchedFortran(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+    bind(c, name='hipblasDgetrfRectStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRectStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgetrfRectStridedBatchedFortran = &
+        hipblasDgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                        ipiv, strideP, info, batch_count)
+end function hipblasDgetrfRectStridedBatchedFortran
+
+function hipblasCgetrfRectStridedBatchedFortran(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+    bind(c, name='hipblasCgetrfRectStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRectStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgetrfRectStridedBatchedFortran = &
+        hipblasCgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                        ipiv, strideP, info, batch_count)
+end function hipblasCgetrfRectStridedBatchedFortran
+
+function hipblasZgetrfRectStridedBatchedFortran(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+    bind(c, name='hipblasZgetrfRectStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRectStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: m
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgetrfRectStridedBatchedFortran = &
+        hipblasZgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                        ipiv, strideP, info, batch_count)
+end function hipblasZgetrfRectStridedBatchedFortran
+
 ! getrs
 function hipblasSgetrsFortran(handle, trans, n, nrhs, A, lda, ipiv, &
                                 B, ldb, info) &
@@ -531,6 +778,87 @@ function hipblasZgetrsStridedBatchedFortran(handle, trans, n, nrhs, A, lda, stri
                                     ipiv, stride_P, B, ldb, stride_B, info, batch_count)
 end function hipblasZgetrsStridedBatchedFortran
 
+! getri
+function hipblasSgetriFortran(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+    bind(c, name='hipblasSgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasSgetriFortran = &
+        hipblasSgetri(handle, n, A, lda, ipiv, C, &
+                      ldc, info)
+end function hipblasSgetriFortran
+
+function hipblasDgetriFortran(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+    bind(c, name='hipblasDgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasDgetriFortran = &
+        hipblasDgetri(handle, n, A, lda, ipiv, C, &
+                      ldc, info)
+end function hipblasDgetriFortran
+
+function hipblasCgetriFortran(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+    bind(c, name='hipblasCgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasCgetriFortran = &
+        hipblasCgetri(handle, n, A, lda, ipiv, C, &
+                      ldc, info)
+end function hipblasCgetriFortran
+
+function hipblasZgetriFortran(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+    bind(c, name='hipblasZgetriFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    type(c_ptr), value :: info
+    hipblasZgetriFortran = &
+        hipblasZgetri(handle, n, A, lda, ipiv, C, &
+                      ldc, info)
+end function hipblasZgetriFortran
+
 ! getri_batched
 function hipblasSgetriBatchedFortran(handle, n, A, lda, ipiv, C, ldc, info, batch_count) &
     bind(c, name='hipblasSgetriBatchedFortran')
@@ -608,6 +936,103 @@ function hipblasZgetriBatchedFortran(handle, n, A, lda, ipiv, C, ldc, info, batc
         hipblasZgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count)
 end function hipblasZgetriBatchedFortran
 
+! getri_strided_batched
+function hipblasSgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasSgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasSgetriStridedBatchedFortran = &
+        hipblasSgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                    strideP, C, ldc, strideC, info, batch_count)
+end function hipblasSgetriStridedBatchedFortran
+
+function hipblasDgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasDgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasDgetriStridedBatchedFortran = &
+        hipblasDgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                    strideP, C, ldc, strideC, info, batch_count)
+end function hipblasDgetriStridedBatchedFortran
+
+function hipblasCgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasCgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasCgetriStridedBatchedFortran = &
+        hipblasCgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                    strideP, C, ldc, strideC, info, batch_count)
+end function hipblasCgetriStridedBatchedFortran
+
+function hipblasZgetriStridedBatchedFortran(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+    bind(c, name='hipblasZgetriStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: C
+    integer(c_int), value :: ldc
+    integer(c_int64_t), value :: strideC
+    type(c_ptr), value :: info
+    integer(c_int), value :: batch_count
+    hipblasZgetriStridedBatchedFortran = &
+        hipblasZgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                    strideP, C, ldc, strideC, info, batch_count)
+end function hipblasZgetriStridedBatchedFortran
+
 ! geqrf
 function hipblasSgeqrfFortran(handle, m, n, A, lda, tau, info) &
     bind(c, name='hipblasSgeqrfFortran')
@@ -1121,3 +1546,674 @@ function hipblasZgelsStridedBatchedFortran(handle, trans, m, n, nrhs, A, &
         hipblasZgelsStridedBatched(handle, trans, m, n, nrhs, A, lda, strideA, &
     B, ldb, strideB, info, deviceInfo, batchCount)
 end function hipblasZgelsStridedBatchedFortran
+
+! potrf
+function hipblasSpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasSpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasSpotrfFortran = &
+        hipblasSpotrf(handle, uplo, n, A, lda, info)
+end function hipblasSpotrfFortran
+
+function hipblasDpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasDpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasDpotrfFortran = &
+        hipblasDpotrf(handle, uplo, n, A, lda, info)
+end function hipblasDpotrfFortran
+
+function hipblasCpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasCpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasCpotrfFortran = &
+        hipblasCpotrf(handle, uplo, n, A, lda, info)
+end function hipblasCpotrfFortran
+
+function hipblasZpotrfFortran(handle, uplo, n, A, lda, info) &
+    bind(c, name='hipblasZpotrfFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    hipblasZpotrfFortran = &
+        hipblasZpotrf(handle, uplo, n, A, lda, info)
+end function hipblasZpotrfFortran
+
+! potrf_batched
+function hipblasSpotrfBatchedFortran(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+    bind(c, name='hipblasSpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfBatchedFortran = &
+        hipblasSpotrfBatched(handle, uplo, n, A, lda, info, &
+                             batchCount)
+end function hipblasSpotrfBatchedFortran
+
+function hipblasDpotrfBatchedFortran(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+    bind(c, name='hipblasDpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfBatchedFortran = &
+        hipblasDpotrfBatched(handle, uplo, n, A, lda, info, &
+                             batchCount)
+end function hipblasDpotrfBatchedFortran
+
+function hipblasCpotrfBatchedFortran(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+    bind(c, name='hipblasCpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfBatchedFortran = &
+        hipblasCpotrfBatched(handle, uplo, n, A, lda, info, &
+                             batchCount)
+end function hipblasCpotrfBatchedFortran
+
+function hipblasZpotrfBatchedFortran(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+    bind(c, name='hipblasZpotrfBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfBatchedFortran = &
+        hipblasZpotrfBatched(handle, uplo, n, A, lda, info, &
+                             batchCount)
+end function hipblasZpotrfBatchedFortran
+
+! potrf_strided_batched
+function hipblasSpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+    bind(c, name='hipblasSpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrfStridedBatchedFortran = &
+        hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                    info, batchCount)
+end function hipblasSpotrfStridedBatchedFortran
+
+function hipblasDpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+    bind(c, name='hipblasDpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrfStridedBatchedFortran = &
+        hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                    info, batchCount)
+end function hipblasDpotrfStridedBatchedFortran
+
+function hipblasCpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+    bind(c, name='hipblasCpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrfStridedBatchedFortran = &
+        hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                    info, batchCount)
+end function hipblasCpotrfStridedBatchedFortran
+
+function hipblasZpotrfStridedBatchedFortran(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+    bind(c, name='hipblasZpotrfStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrfStridedBatchedFortran = &
+        hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                    info, batchCount)
+end function hipblasZpotrfStridedBatchedFortran
+
+! potrs
+function hipblasSpotrsFortran(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+    bind(c, name='hipblasSpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasSpotrsFortran = &
+        hipblasSpotrs(handle, uplo, n, nrhs, A, lda, &
+                      B, ldb, info)
+end function hipblasSpotrsFortran
+
+function hipblasDpotrsFortran(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+    bind(c, name='hipblasDpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasDpotrsFortran = &
+        hipblasDpotrs(handle, uplo, n, nrhs, A, lda, &
+                      B, ldb, info)
+end function hipblasDpotrsFortran
+
+function hipblasCpotrsFortran(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+    bind(c, name='hipblasCpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasCpotrsFortran = &
+        hipblasCpotrs(handle, uplo, n, nrhs, A, lda, &
+                      B, ldb, info)
+end function hipblasCpotrsFortran
+
+function hipblasZpotrsFortran(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+    bind(c, name='hipblasZpotrsFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    hipblasZpotrsFortran = &
+        hipblasZpotrs(handle, uplo, n, nrhs, A, lda, &
+                      B, ldb, info)
+end function hipblasZpotrsFortran
+
+! potrs_batched
+function hipblasSpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+    bind(c, name='hipblasSpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsBatchedFortran = &
+        hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                             B, ldb, info, batchCount)
+end function hipblasSpotrsBatchedFortran
+
+function hipblasDpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+    bind(c, name='hipblasDpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsBatchedFortran = &
+        hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                             B, ldb, info, batchCount)
+end function hipblasDpotrsBatchedFortran
+
+function hipblasCpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+    bind(c, name='hipblasCpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsBatchedFortran = &
+        hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                             B, ldb, info, batchCount)
+end function hipblasCpotrsBatchedFortran
+
+function hipblasZpotrsBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+    bind(c, name='hipblasZpotrsBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsBatchedFortran = &
+        hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                             B, ldb, info, batchCount)
+end function hipblasZpotrsBatchedFortran
+
+! potrs_strided_batched
+function hipblasSpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasSpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasSpotrsStridedBatchedFortran = &
+        hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasSpotrsStridedBatchedFortran
+
+function hipblasDpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasDpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasDpotrsStridedBatchedFortran = &
+        hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasDpotrsStridedBatchedFortran
+
+function hipblasCpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasCpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasCpotrsStridedBatchedFortran = &
+        hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasCpotrsStridedBatchedFortran
+
+function hipblasZpotrsStridedBatchedFortran(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+    bind(c, name='hipblasZpotrsStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: info
+    integer(c_int), value :: batchCount
+    hipblasZpotrsStridedBatchedFortran = &
+        hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                    strideA, B, ldb, strideB, info, batchCount)
+end function hipblasZpotrsStridedBatchedFortran
+
+! XXgesv
+function hipblasDSgesvFortran(handle, n, nrhs, A, lda, ipiv, &
+                              B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+    bind(c, name='hipblasDSgesvFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasDSgesvFortran = &
+        hipblasDSgesv(handle, n, nrhs, A, lda, ipiv, &
+                      B, ldb, X, ldx, iter, info, &
+                      deviceInfo)
+end function hipblasDSgesvFortran
+
+function hipblasZCgesvFortran(handle, n, nrhs, A, lda, ipiv, &
+                              B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+    bind(c, name='hipblasZCgesvFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    hipblasZCgesvFortran = &
+        hipblasZCgesv(handle, n, nrhs, A, lda, ipiv, &
+                      B, ldb, X, ldx, iter, info, &
+                      deviceInfo)
+end function hipblasZCgesvFortran
+
+! XXgesvBatched
+function hipblasDSgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+                                     B, ldb, X, ldx, iter, info, &
+                                     deviceInfo, batchCount) &
+    bind(c, name='hipblasDSgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batchCount
+    hipblasDSgesvBatchedFortran = &
+        hipblasDSgesvBatched(handle, n, nrhs, A, lda, ipiv, &
+                             B, ldb, X, ldx, iter, info, &
+                             deviceInfo, batchCount)
+end function hipblasDSgesvBatchedFortran
+
+function hipblasZCgesvBatchedFortran(handle, n, nrhs, A, lda, ipiv, &
+                                     B, ldb, X, ldx, iter, info, &
+                                     deviceInfo, batchCount) &
+    bind(c, name='hipblasZCgesvBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    type(c_ptr), value :: ipiv
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batchCount
+    hipblasZCgesvBatchedFortran = &
+        hipblasZCgesvBatched(handle, n, nrhs, A, lda, ipiv, &
+                             B, ldb, X, ldx, iter, info, &
+                             deviceInfo, batchCount)
+end function hipblasZCgesvBatchedFortran
+
+! XXgesvStridedBatched
+function hipblasDSgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+                                            ipiv, strideP, B, ldb, strideB, X, &
+                                            ldx, strideX, iter, info, deviceInfo, batchCount) &
+    bind(c, name='hipblasDSgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    integer(c_int64_t), value :: strideX
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batchCount
+    hipblasDSgesvStridedBatchedFortran = &
+        hipblasDSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+                                    ipiv, strideP, B, ldb, strideB, X, &
+                                    ldx, strideX, iter, info, deviceInfo, batchCount)
+end function hipblasDSgesvStridedBatchedFortran
+
+function hipblasZCgesvStridedBatchedFortran(handle, n, nrhs, A, lda, strideA, &
+                                            ipiv, strideP, B, ldb, strideB, X, &
+                                            ldx, strideX, iter, info, deviceInfo, batchCount) &
+    bind(c, name='hipblasZCgesvStridedBatchedFortran')
+    use iso_c_binding
+    use hipblas_enums
+    implicit none
+    integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvStridedBatchedFortran
+    type(c_ptr), value :: handle
+    integer(c_int), value :: n
+    integer(c_int), value :: nrhs
+    type(c_ptr), value :: A
+    integer(c_int), value :: lda
+    integer(c_int64_t), value :: strideA
+    type(c_ptr), value :: ipiv
+    integer(c_int64_t), value :: strideP
+    type(c_ptr), value :: B
+    integer(c_int), value :: ldb
+    integer(c_int64_t), value :: strideB
+    type(c_ptr), value :: X
+    integer(c_int), value :: ldx
+    integer(c_int64_t), value :: strideX
+    type(c_ptr), value :: iter
+    type(c_ptr), value :: info
+    type(c_ptr), value :: deviceInfo
+    integer(c_int), value :: batchCount
+    hipblasZCgesvStridedBatchedFortran = &
+        hipblasZCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+                                    ipiv, strideP, B, ldb, strideB, X, &
+                                    ldx, strideX, iter, info, deviceInfo, batchCount)
+end function hipblasZCgesvStridedBatchedFortran
@@ -647,6 +647,18 @@
 #define hipblasDgetrfStridedBatchedFortran hipblasDgetrfStridedBatched
 #define hipblasCgetrfStridedBatchedFortran hipblasCgetrfStridedBatched
 #define hipblasZgetrfStridedBatchedFortran hipblasZgetrfStridedBatched
+#define hipblasSgetrfRectFortran hipblasSgetrfRect
+#define hipblasDgetrfRectFortran hipblasDgetrfRect
+#define hipblasCgetrfRectFortran hipblasCgetrfRect
+#define hipblasZgetrfRectFortran hipblasZgetrfRect
+#define hipblasSgetrfRectBatchedFortran hipblasSgetrfRectBatched
+#define hipblasDgetrfRectBatchedFortran hipblasDgetrfRectBatched
+#define hipblasCgetrfRectBatchedFortran hipblasCgetrfRectBatched
+#define hipblasZgetrfRectBatchedFortran hipblasZgetrfRectBatched
+#define hipblasSgetrfRectStridedBatchedFortran hipblasSgetrfRectStridedBatched
+#define hipblasDgetrfRectStridedBatchedFortran hipblasDgetrfRectStridedBatched
+#define hipblasCgetrfRectStridedBatchedFortran hipblasCgetrfRectStridedBatched
+#define hipblasZgetrfRectStridedBatchedFortran hipblasZgetrfRectStridedBatched
 #define hipblasSgetrsFortran hipblasSgetrs
 #define hipblasDgetrsFortran hipblasDgetrs
 #define hipblasCgetrsFortran hipblasCgetrs
@@ -695,5 +707,35 @@
 #define hipblasDgeqrfStridedBatchedFortran hipblasDgeqrfStridedBatched
 #define hipblasCgeqrfStridedBatchedFortran hipblasCgeqrfStridedBatched
 #define hipblasZgeqrfStridedBatchedFortran hipblasZgeqrfStridedBatched
+#define hipblasSpotrfFortran hipblasSpotrf
+#define hipblasDpotrfFortran hipblasDpotrf
+#define hipblasCpotrfFortran hipblasCpotrf
+#define hipblasZpotrfFortran hipblasZpotrf
+#define hipblasSpotrfBatchedFortran hipblasSpotrfBatched
+#define hipblasDpotrfBatchedFortran hipblasDpotrfBatched
+#define hipblasCpotrfBatchedFortran hipblasCpotrfBatched
+#define hipblasZpotrfBatchedFortran hipblasZpotrfBatched
+#define hipblasSpotrfStridedBatchedFortran hipblasSpotrfStridedBatched
+#define hipblasDpotrfStridedBatchedFortran hipblasDpotrfStridedBatched
+#define hipblasCpotrfStridedBatchedFortran hipblasCpotrfStridedBatched
+#define hipblasZpotrfStridedBatchedFortran hipblasZpotrfStridedBatched
+#define hipblasSpotrsFortran hipblasSpotrs
+#define hipblasDpotrsFortran hipblasDpotrs
+#define hipblasCpotrsFortran hipblasCpotrs
+#define hipblasZpotrsFortran hipblasZpotrs
+#define hipblasSpotrsBatchedFortran hipblasSpotrsBatched
+#define hipblasDpotrsBatchedFortran hipblasDpotrsBatched
+#define hipblasCpotrsBatchedFortran hipblasCpotrsBatched
+#define hipblasZpotrsBatchedFortran hipblasZpotrsBatched
+#define hipblasSpotrsStridedBatchedFortran hipblasSpotrsStridedBatched
+#define hipblasDpotrsStridedBatchedFortran hipblasDpotrsStridedBatched
+#define hipblasCpotrsStridedBatchedFortran hipblasCpotrsStridedBatched
+#define hipblasZpotrsStridedBatchedFortran hipblasZpotrsStridedBatched
+#define hipblasDSgesvFortran hipblasDSgesv
+#define hipblasZCgesvFortran hipblasZCgesv
+#define hipblasDSgesvBatchedFortran hipblasDSgesvBatched
+#define hipblasZCgesvBatchedFortran hipblasZCgesvBatched
+#define hipblasDSgesvStridedBatchedFortran hipblasDSgesvStridedBatched
+#define hipblasZCgesvStridedBatchedFortran hipblasZCgesvStridedBatched
 
 #endif
@@ -93,6 +93,41 @@ private:
     T* data;
 };
 
+//!
+//! @brief  Copies of a device operand that the hot loop of a benchmark rotates through, so that
+//!         its iterations do not find the operand in the device caches. Copy 0 is the operand.
+//!
+template <typename T>
+class rotating_device_vector
+{
+public:
+    rotating_device_vector(T* operand, size_t size, size_t copies)
+        : m_operand(operand)
+        , m_size(size)
+        , m_copies(copies ? copies : 1)
+        , m_rotated(size * (m_copies - 1))
+    {
+        for(size_t copy = 1; copy < m_copies; copy++)
+            CHECK_HIP_ERROR(hipMemcpy(
+                m_rotated + (copy - 1) * size, operand, sizeof(T) * size, hipMemcpyDeviceToDevice));
+    }
+
+    //!
+    //! @brief Copy of the operand for hot iteration iter
+    //!
+    T* operator[](size_t iter)
+    {
+        size_t copy = iter % m_copies;
+        return copy ? m_rotated + (copy - 1) * m_size : m_operand;
+    }
+
+private:
+    T*               m_operand;
+    size_t           m_size;
+    size_t           m_copies;
+    device_vector<T> m_rotated;
+};
+
 //!
 //! @brief  Pseudo-vector subclass which uses host memory.
 //!
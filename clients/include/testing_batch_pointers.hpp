@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_batch_pointers(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_batch_pointers(const Arguments& arg)
+{
+    const int           batch_count = 1000;
+    const hipblasStride stride      = 37;
+
+    hipblasLocalHandle    handle(arg);
+    device_vector<float>  dA(size_t(stride) * batch_count);
+    device_vector<float*> dArray(batch_count);
+    device_vector<int>    dIndices(batch_count);
+    host_vector<float*>   hArray(batch_count);
+    host_vector<int>      hIndices(batch_count);
+    void**                array = reinterpret_cast<void**>(static_cast<float**>(dArray));
+
+    EXPECT_HIPBLAS_STATUS(hipblasBuildBatchPointers(handle, dA, 0, stride, batch_count, array),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasBuildBatchPointers(handle, dA, sizeof(float), stride, -1, array),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasBuildBatchPointers(handle, dA, sizeof(float), stride, batch_count, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGatherBatchPointers(handle, dA, sizeof(float), stride, nullptr, batch_count, array),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(
+        hipblasBuildBatchPointers(handle, nullptr, sizeof(float), stride, 0, nullptr),
+        HIPBLAS_STATUS_SUCCESS);
+
+    hipblasStatus_t status
+        = hipblasBuildBatchPointers(handle, dA, sizeof(float), stride, batch_count, array);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    CHECK_HIP_ERROR(
+        hipMemcpy(hArray, dArray, sizeof(float*) * batch_count, hipMemcpyDeviceToHost));
+    for(int b = 0; b < batch_count; b++)
+        EXPECT_EQ(hArray[b], (float*)dA + b * stride);
+
+    // Entries in reverse order, with every third one repeated
+    for(int b = 0; b < batch_count; b++)
+        hIndices[b] = b % 3 ? batch_count - 1 - b : 0;
+    CHECK_HIP_ERROR(
+        hipMemcpy(dIndices, hIndices, sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIPBLAS_ERROR(hipblasGatherBatchPointers(
+        handle, dA, sizeof(float), stride, dIndices, batch_count, array));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hArray, dArray, sizeof(float*) * batch_count, hipMemcpyDeviceToHost));
+    for(int b = 0; b < batch_count; b++)
+        EXPECT_EQ(hArray[b], (float*)dA + hIndices[b] * stride);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
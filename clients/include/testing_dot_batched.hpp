@@ -166,12 +166,9 @@ inline hipblasStatus_t testing_dot_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR((hipblasDotBatchedFn)(handle,
                                                       N,
                                                       dx.ptr_on_device(),
@@ -181,7 +178,7 @@ inline hipblasStatus_t testing_dot_batched(const Arguments& arg)
                                                       batch_count,
                                                       d_hipblas_result));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasDotBatchedModel{}.log_args<T>(std::cout,
                                              arg,
@@ -305,12 +305,9 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasGelsBatchedFn(handle,
                                                      trans,
                                                      M,
@@ -324,7 +321,7 @@ inline hipblasStatus_t testing_gels_batched(const Arguments& arg)
                                                      dInfo,
                                                      batchCount));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGelsBatchedModel{}.log_args<T>(std::cout,
                                               arg,
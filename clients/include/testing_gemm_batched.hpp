@@ -253,12 +253,9 @@ inline hipblasStatus_t testing_gemm_batched(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasGemmBatchedFn(handle,
                                                      transA,
                                                      transB,
@@ -276,7 +273,7 @@ inline hipblasStatus_t testing_gemm_batched(const Arguments& arg)
                                                      batch_count));
         }
 
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGemmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
@@ -140,6 +140,39 @@ inline hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
 
+    // A solution set on the handle by hipblas-bench --tune may not apply to this problem
+    if(arg.solution_index)
+    {
+        hipblasStatus_t status
+            = hipblasGemmBatchedExWithFlagsFn(handle,
+                                              transA,
+                                              transB,
+                                              M,
+                                              N,
+                                              K,
+                                              &h_alpha_Tex,
+                                              (const void**)(Ta**)dA.ptr_on_device(),
+                                              a_type,
+                                              lda,
+                                              (const void**)(Tb**)dB.ptr_on_device(),
+                                              b_type,
+                                              ldb,
+                                              &h_beta_Tex,
+                                              (void**)(Tc**)dC.ptr_on_device(),
+                                              c_type,
+                                              ldc,
+                                              batch_count,
+#ifdef HIPBLAS_V2
+                                              compute_type_gemm,
+#else
+                                              compute_type,
+#endif
+                                              algo,
+                                              HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
     if(unit_check || norm_check)
     {
         // hipBLAS
@@ -316,12 +349,9 @@ inline hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             if(!arg.with_flags)
             {
                 CHECK_HIPBLAS_ERROR(hipblasGemmBatchedExFn(handle,
@@ -379,7 +409,7 @@ inline hipblasStatus_t testing_gemm_batched_ex_template(const Arguments& arg)
                                                     flags));
             }
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGemmBatchedExModel{}.log_args<Tc>(std::cout,
                                                  arg,
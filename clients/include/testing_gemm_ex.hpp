@@ -124,6 +124,37 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
     CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
 
+    // A solution set on the handle by hipblas-bench --tune may not apply to this problem
+    if(arg.solution_index)
+    {
+        hipblasStatus_t status = hipblasGemmExWithFlagsFn(handle,
+                                                          transA,
+                                                          transB,
+                                                          M,
+                                                          N,
+                                                          K,
+                                                          &h_alpha_Tex,
+                                                          dA,
+                                                          a_type,
+                                                          lda,
+                                                          dB,
+                                                          b_type,
+                                                          ldb,
+                                                          &h_beta_Tex,
+                                                          dC,
+                                                          c_type,
+                                                          ldc,
+#ifdef HIPBLAS_V2
+                                                          compute_type_gemm,
+#else
+                                                          compute_type,
+#endif
+                                                          algo,
+                                                          HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
     if(unit_check || norm_check)
     {
         // hipBLAS
@@ -289,12 +320,17 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+        // Copies of the operands that the hot iterations rotate through with
+        // --flush_batch_count or --flush_memory_size, so that they start with cold caches
+        size_t flush = hipblas_flush_copies(
+            arg, sizeof(Ta) * size_A + sizeof(Tb) * size_B + sizeof(Tc) * size_C);
+        rotating_device_vector<Ta> dA_flush(dA, size_A, flush);
+        rotating_device_vector<Tb> dB_flush(dB, size_B, flush);
+        rotating_device_vector<Tc> dC_flush(dC, size_C, flush);
 
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
+        {
             if(!arg.with_flags)
             {
                 CHECK_HIPBLAS_ERROR(hipblasGemmExFn(handle,
@@ -304,14 +340,14 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
                                                     N,
                                                     K,
                                                     &h_alpha_Tex,
-                                                    dA,
+                                                    dA_flush[iter],
                                                     a_type,
                                                     lda,
-                                                    dB,
+                                                    dB_flush[iter],
                                                     b_type,
                                                     ldb,
                                                     &h_beta_Tex,
-                                                    dC,
+                                                    dC_flush[iter],
                                                     c_type,
                                                     ldc,
 #ifdef HIPBLAS_V2
@@ -330,14 +366,14 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
                                                              N,
                                                              K,
                                                              &h_alpha_Tex,
-                                                             dA,
+                                                             dA_flush[iter],
                                                              a_type,
                                                              lda,
-                                                             dB,
+                                                             dB_flush[iter],
                                                              b_type,
                                                              ldb,
                                                              &h_beta_Tex,
-                                                             dC,
+                                                             dC_flush[iter],
                                                              c_type,
                                                              ldc,
 #ifdef HIPBLAS_V2
@@ -349,7 +385,7 @@ inline hipblasStatus_t testing_gemm_ex_template(const Arguments& arg)
                                                              flags));
             }
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGemmExModel{}.log_args<Tc>(std::cout,
                                           arg,
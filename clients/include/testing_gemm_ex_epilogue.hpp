@@ -0,0 +1,595 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExWithEpilogueModel = ArgumentModel<e_transA,
+                                                     e_transB,
+                                                     e_M,
+                                                     e_N,
+                                                     e_K,
+                                                     e_alpha,
+                                                     e_lda,
+                                                     e_ldb,
+                                                     e_beta,
+                                                     e_ldc,
+                                                     e_ldd,
+                                                     e_activation,
+                                                     e_scale_mode,
+                                                     e_bias,
+                                                     e_inplace,
+                                                     e_unfused>;
+
+using hipblasGemmStridedBatchedExWithEpilogueModel = ArgumentModel<e_transA,
+                                                                   e_transB,
+                                                                   e_M,
+                                                                   e_N,
+                                                                   e_K,
+                                                                   e_alpha,
+                                                                   e_lda,
+                                                                   e_ldb,
+                                                                   e_beta,
+                                                                   e_ldc,
+                                                                   e_ldd,
+                                                                   e_batch_count,
+                                                                   e_activation,
+                                                                   e_scale_mode,
+                                                                   e_bias,
+                                                                   e_inplace,
+                                                                   e_unfused>;
+// strides not logged
+
+inline void testname_gemm_ex_with_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExWithEpilogueModel{}.test_name(arg, name);
+}
+
+inline void testname_gemm_strided_batched_ex_with_epilogue(const Arguments& arg, std::string& name)
+{
+    hipblasGemmStridedBatchedExWithEpilogueModel{}.test_name(arg, name);
+}
+
+// Values of the real types an epilogue reads and writes, in double precision
+inline double epilogue_to_double(hipblasHalf x)
+{
+    return half_to_float(x);
+}
+
+inline double epilogue_to_double(hipblasBfloat16 x)
+{
+    return bfloat16_to_float(x);
+}
+
+inline double epilogue_to_double(float x)
+{
+    return x;
+}
+
+inline double epilogue_to_double(double x)
+{
+    return x;
+}
+
+// Error allowed relative to the largest result. The device may round the product to C before
+// the epilogue or fuse the two, and evaluates the activation in single precision for 16-bit and
+// single precision results.
+template <typename T>
+constexpr double epilogue_relative_tolerance()
+{
+    if constexpr(std::is_same_v<T, hipblasHalf>)
+        return 1 / 256.0;
+    else if constexpr(std::is_same_v<T, hipblasBfloat16>)
+        return 1 / 32.0;
+    else if constexpr(std::is_same_v<T, float>)
+        return 1e-5;
+    else
+        return 1e-12;
+}
+
+// D = activation(scale * C + bias) on the host, for each of batch_count problems
+template <typename Tc, typename Td>
+void cpu_gemm_epilogue(char          activation,
+                       char          scale_mode,
+                       bool          bias,
+                       int           M,
+                       int           N,
+                       const Tc*     C,
+                       int           ldc,
+                       hipblasStride stride_C,
+                       const Tc*     scale,
+                       hipblasStride stride_scale,
+                       const Tc*     bias_vector,
+                       hipblasStride stride_bias,
+                       Td*           D,
+                       int           ldd,
+                       hipblasStride stride_D,
+                       int           batch_count)
+{
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+            {
+                double x = epilogue_to_double(C[b * stride_C + i + size_t(j) * ldc]);
+                if(scale_mode == 'R')
+                    x *= epilogue_to_double(scale[b * stride_scale + i]);
+                else if(scale_mode == 'C')
+                    x *= epilogue_to_double(scale[b * stride_scale + j]);
+                if(bias)
+                    x += epilogue_to_double(bias_vector[b * stride_bias + i]);
+                if(activation == 'R')
+                    x = x > 0 ? x : 0;
+                else if(activation == 'G')
+                    x = 0.5 * x * (1 + std::tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+                D[b * stride_D + i + size_t(j) * ldd] = convert_alpha_beta<Td>(x, 0);
+            }
+}
+
+inline hipblasActivation_t char2hipblas_activation(char value)
+{
+    return value == 'R' ? HIPBLAS_ACTIVATION_RELU
+           : value == 'G' ? HIPBLAS_ACTIVATION_GELU
+                          : HIPBLAS_ACTIVATION_NONE;
+}
+
+inline hipblasEpilogueScale_t char2hipblas_epilogue_scale(char value)
+{
+    return value == 'R'   ? HIPBLAS_EPILOGUE_SCALE_ROW
+           : value == 'C' ? HIPBLAS_EPILOGUE_SCALE_COLUMN
+                          : HIPBLAS_EPILOGUE_SCALE_NONE;
+}
+
+// Tests hipblasGemmExWithEpilogue, or hipblasGemmStridedBatchedExWithEpilogue if STRIDED.
+// With arg.inplace the result is written to C, otherwise to D of type Td.
+// With arg.unfused the timing runs the GEMM and then each step of the epilogue as its own
+// k = 0 call, to compare against the fused epilogue.
+template <bool STRIDED, typename Ta, typename Tb, typename Tc, typename Tex, typename Td>
+inline hipblasStatus_t testing_gemm_ex_epilogue_template(const Arguments& arg)
+{
+    hipblasGemmAlgo_t algo = HIPBLAS_GEMM_DEFAULT;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+    int                ldd    = arg.inplace ? arg.ldc : arg.ldd;
+
+    hipDataType          a_type       = hipblas_type2datatype<Ta>();
+    hipDataType          b_type       = hipblas_type2datatype<Tb>();
+    hipDataType          c_type       = hipblas_type2datatype<Tc>();
+    hipDataType          d_type       = hipblas_type2datatype<Td>();
+    hipblasComputeType_t compute_type = hipblas_type2computetype<Tex>();
+    hipblasGemmFlags_t   flags
+        = arg.with_flags ? hipblasGemmFlags_t(arg.flags) : HIPBLAS_GEMM_FLAGS_NONE;
+
+    int batch_count = STRIDED ? arg.batch_count : 1;
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    Tex h_alpha_Tex = arg.get_alpha<Tex>();
+    Tex h_beta_Tex  = arg.get_beta<Tex>();
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || ldd < M
+       || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t stride_A     = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t stride_B     = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t stride_C     = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+    const size_t stride_D     = static_cast<size_t>(ldd) * static_cast<size_t>(N);
+    const size_t stride_scale = arg.scale_mode == 'C' ? N : M;
+    const size_t stride_bias  = M;
+
+    const size_t size_A     = stride_A * batch_count;
+    const size_t size_B     = stride_B * batch_count;
+    const size_t size_C     = stride_C * batch_count;
+    const size_t size_D     = stride_D * batch_count;
+    const size_t size_scale = stride_scale * batch_count;
+    const size_t size_bias  = stride_bias * batch_count;
+
+    device_vector<Ta>  dA(size_A);
+    device_vector<Tb>  dB(size_B);
+    device_vector<Tc>  dC(size_C);
+    device_vector<Td>  dD(size_D);
+    device_vector<Tc>  dScale(size_scale);
+    device_vector<Tc>  dBias(size_bias);
+    device_vector<Tex> d_alpha(1);
+    device_vector<Tex> d_beta(1);
+
+    if(!dA || !dB || !dC || !dD || !dScale || !dBias || !d_alpha || !d_beta)
+    {
+        PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    double             gpu_time_used, hipblas_error_host, hipblas_error_device;
+    hipblasLocalHandle handle(arg);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta> hA(size_A);
+    host_vector<Tb> hB(size_B);
+    host_vector<Tc> hC(size_C);
+    host_vector<Tc> hC_gold(size_C);
+    host_vector<Tc> hScale(size_scale);
+    host_vector<Tc> hBias(size_bias);
+    host_vector<Td> hD_host(size_D);
+    host_vector<Td> hD_device(size_D);
+    host_vector<Td> hD_gold(size_D);
+
+    // Initial Data on CPU
+    hipblas_init_matrix(
+        hA, arg, A_row, A_col, lda, stride_A, batch_count, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_matrix(
+        hB, arg, B_row, B_col, ldb, stride_B, batch_count, hipblas_client_alpha_sets_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, stride_C, batch_count, hipblas_client_beta_sets_nan);
+    hipblas_init_vector(
+        hScale, arg, stride_scale, 1, stride_scale, batch_count, hipblas_client_never_set_nan);
+    hipblas_init_vector(
+        hBias, arg, stride_bias, 1, stride_bias, batch_count, hipblas_client_never_set_nan);
+    hC_gold = hC;
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(Ta) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(Tb) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dScale, hScale, sizeof(Tc) * size_scale, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dBias, hBias, sizeof(Tc) * size_bias, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta_Tex, sizeof(Tex), hipMemcpyHostToDevice));
+
+    hipblasGemmEpilogue_t epilogue = {};
+    epilogue.scaleMode             = char2hipblas_epilogue_scale(arg.scale_mode);
+    epilogue.scale                 = epilogue.scaleMode ? (const Tc*)dScale : nullptr;
+    epilogue.strideScale           = stride_scale;
+    epilogue.bias                  = arg.bias ? (const Tc*)dBias : nullptr;
+    epilogue.strideBias            = stride_bias;
+    epilogue.activation            = char2hipblas_activation(arg.activation);
+    epilogue.D                     = arg.inplace ? nullptr : (Td*)dD;
+    epilogue.dType                 = d_type;
+    epilogue.ldd                   = ldd;
+    epilogue.strideD               = stride_D;
+
+    void* dOut = arg.inplace ? (void*)dC : (void*)dD;
+
+    auto hipblasGemmExWithEpilogueFn = [&](int                          k,
+                                           const void*                  alpha,
+                                           const void*                  beta,
+                                           const hipblasGemmEpilogue_t& e) {
+        if(STRIDED)
+            return hipblasGemmStridedBatchedExWithEpilogue(handle,
+                                                           transA,
+                                                           transB,
+                                                           M,
+                                                           N,
+                                                           k,
+                                                           alpha,
+                                                           dA,
+                                                           a_type,
+                                                           lda,
+                                                           stride_A,
+                                                           dB,
+                                                           b_type,
+                                                           ldb,
+                                                           stride_B,
+                                                           beta,
+                                                           dC,
+                                                           c_type,
+                                                           ldc,
+                                                           stride_C,
+                                                           batch_count,
+                                                           compute_type,
+                                                           algo,
+                                                           flags,
+                                                           &e);
+        return hipblasGemmExWithEpilogue(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         k,
+                                         alpha,
+                                         dA,
+                                         a_type,
+                                         lda,
+                                         dB,
+                                         b_type,
+                                         ldb,
+                                         beta,
+                                         dC,
+                                         c_type,
+                                         ldc,
+                                         compute_type,
+                                         algo,
+                                         flags,
+                                         &e);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExWithEpilogueFn(K, &h_alpha_Tex, &h_beta_Tex, epilogue));
+
+        CHECK_HIP_ERROR(hipMemcpy(hD_host, dOut, sizeof(Td) * size_D, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(Tc) * size_C, hipMemcpyHostToDevice));
+
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExWithEpilogueFn(K, d_alpha, d_beta, epilogue));
+
+        CHECK_HIP_ERROR(hipMemcpy(hD_device, dOut, sizeof(Td) * size_D, hipMemcpyDeviceToHost));
+
+        // CPU BLAS
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_gemm<Ta, Tc, Tex>(transA,
+                                    transB,
+                                    M,
+                                    N,
+                                    K,
+                                    h_alpha_Tex,
+                                    hA.data() + b * stride_A,
+                                    lda,
+                                    hB.data() + b * stride_B,
+                                    ldb,
+                                    h_beta_Tex,
+                                    hC_gold.data() + b * stride_C,
+                                    ldc);
+        }
+        cpu_gemm_epilogue<Tc, Td>(arg.activation,
+                                  arg.scale_mode,
+                                  arg.bias,
+                                  M,
+                                  N,
+                                  hC_gold,
+                                  ldc,
+                                  stride_C,
+                                  hScale,
+                                  stride_scale,
+                                  hBias,
+                                  stride_bias,
+                                  hD_gold,
+                                  ldd,
+                                  stride_D,
+                                  batch_count);
+
+        if(unit_check)
+        {
+            double max_abs = 0;
+            for(size_t i = 0; i < size_D; i++)
+                max_abs = std::max(max_abs, std::abs(epilogue_to_double(hD_gold[i])));
+            const double tol = std::max(epilogue_relative_tolerance<Tc>(),
+                                        epilogue_relative_tolerance<Td>())
+                               * max_abs;
+            near_check_general<Td>(M, N, batch_count, ldd, stride_D, hD_gold, hD_host, tol);
+            near_check_general<Td>(M, N, batch_count, ldd, stride_D, hD_gold, hD_device, tol);
+        }
+        if(norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<Td>('F', M, N, ldd, stride_D, hD_gold, hD_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<Td>('F', M, N, ldd, stride_D, hD_gold, hD_device, batch_count);
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        // Unfused, the GEMM writes C and every step of the epilogue reads and writes it again,
+        // the last one storing to D
+        hipblasGemmEpilogue_t              gemm_only = {};
+        std::vector<hipblasGemmEpilogue_t> steps;
+        if(arg.unfused)
+        {
+            hipblasGemmEpilogue_t step = {};
+            if(epilogue.scaleMode)
+            {
+                step.scaleMode   = epilogue.scaleMode;
+                step.scale       = epilogue.scale;
+                step.strideScale = epilogue.strideScale;
+                steps.push_back(step);
+                step = {};
+            }
+            if(epilogue.bias)
+            {
+                step.bias       = epilogue.bias;
+                step.strideBias = epilogue.strideBias;
+                steps.push_back(step);
+                step = {};
+            }
+            if(epilogue.activation)
+            {
+                step.activation = epilogue.activation;
+                steps.push_back(step);
+            }
+            if(epilogue.D && steps.empty())
+                steps.push_back({});
+            if(!steps.empty())
+            {
+                steps.back().D       = epilogue.D;
+                steps.back().dType   = epilogue.dType;
+                steps.back().ldd     = epilogue.ldd;
+                steps.back().strideD = epilogue.strideD;
+            }
+        }
+        Tex h_zero = convert_alpha_beta<Tex>(0, 0);
+        Tex h_one  = convert_alpha_beta<Tex>(1, 0);
+
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
+        {
+            if(!arg.unfused)
+            {
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmExWithEpilogueFn(K, &h_alpha_Tex, &h_beta_Tex, epilogue));
+            }
+            else
+            {
+                CHECK_HIPBLAS_ERROR(
+                    hipblasGemmExWithEpilogueFn(K, &h_alpha_Tex, &h_beta_Tex, gemm_only));
+                for(const hipblasGemmEpilogue_t& step : steps)
+                    CHECK_HIPBLAS_ERROR(hipblasGemmExWithEpilogueFn(0, &h_zero, &h_one, step));
+            }
+        }
+        gpu_time_used = hot_loop.time_us();
+
+        if(STRIDED)
+            hipblasGemmStridedBatchedExWithEpilogueModel{}.log_args<Td>(
+                std::cout,
+                arg,
+                gpu_time_used,
+                gemm_gflop_count<Tex>(M, N, K),
+                gemm_gbyte_count<Tex>(M, N, K),
+                hipblas_error_host,
+                hipblas_error_device);
+        else
+            hipblasGemmExWithEpilogueModel{}.log_args<Td>(std::cout,
+                                                          arg,
+                                                          gpu_time_used,
+                                                          gemm_gflop_count<Tex>(M, N, K),
+                                                          gemm_gbyte_count<Tex>(M, N, K),
+                                                          hipblas_error_host,
+                                                          hipblas_error_device);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// Chooses the type of D from arg.d_type. Epilogues are only defined for real floating point
+// results, so the other types of C are not supported.
+template <bool STRIDED, typename Ta, typename Tb, typename Tc, typename Tex>
+inline hipblasStatus_t testing_gemm_ex_epilogue_d_type(const Arguments& arg)
+{
+    if constexpr(std::is_same_v<Tc, hipblasHalf> || std::is_same_v<Tc, hipblasBfloat16>
+                 || std::is_same_v<Tc, float> || std::is_same_v<Tc, double>)
+    {
+        if(arg.inplace || arg.d_type == arg.c_type)
+            return testing_gemm_ex_epilogue_template<STRIDED, Ta, Tb, Tc, Tex, Tc>(arg);
+
+        switch(arg.d_type)
+        {
+        case HIPBLAS_R_16F:
+            return testing_gemm_ex_epilogue_template<STRIDED, Ta, Tb, Tc, Tex, hipblasHalf>(arg);
+        case HIPBLAS_R_16B:
+            return testing_gemm_ex_epilogue_template<STRIDED, Ta, Tb, Tc, Tex, hipblasBfloat16>(
+                arg);
+        case HIPBLAS_R_32F:
+            return testing_gemm_ex_epilogue_template<STRIDED, Ta, Tb, Tc, Tex, float>(arg);
+        case HIPBLAS_R_64F:
+            return testing_gemm_ex_epilogue_template<STRIDED, Ta, Tb, Tc, Tex, double>(arg);
+        default:
+            break;
+        }
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_ex_with_epilogue_template(const Arguments& arg)
+{
+    return testing_gemm_ex_epilogue_d_type<false, Ta, Tb, Tc, Tex>(arg);
+}
+
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_strided_batched_ex_with_epilogue_template(const Arguments& arg)
+{
+    return testing_gemm_ex_epilogue_d_type<true, Ta, Tb, Tc, Tex>(arg);
+}
+
+// The precisions of the GEMM, as in testing_gemm_ex, for the types an epilogue supports
+template <bool STRIDED>
+inline hipblasStatus_t testing_gemm_ex_epilogue(const Arguments& arg)
+{
+    hipblasDatatype_t a_type = arg.a_type;
+    hipblasDatatype_t b_type = arg.b_type;
+    hipblasDatatype_t c_type = arg.c_type;
+#ifdef HIPBLAS_V2
+    hipblasComputeType_t compute_type = arg.compute_type_gemm;
+    bool                 compute_16f  = compute_type == HIPBLAS_COMPUTE_16F;
+    bool                 compute_32f  = compute_type == HIPBLAS_COMPUTE_32F;
+    bool                 compute_64f  = compute_type == HIPBLAS_COMPUTE_64F;
+#else
+    hipblasDatatype_t compute_type = arg.compute_type;
+    bool              compute_16f  = compute_type == HIPBLAS_R_16F;
+    bool              compute_32f  = compute_type == HIPBLAS_R_32F;
+    bool              compute_64f  = compute_type == HIPBLAS_R_64F;
+#endif
+
+    using half = hipblasHalf;
+    using bf16 = hipblasBfloat16;
+
+    if(a_type != b_type)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(a_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F && compute_16f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, half, half, half, half>(arg);
+    else if(a_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F && compute_32f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, half, half, half, float>(arg);
+    else if(a_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_32F && compute_32f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, half, half, float, float>(arg);
+    else if(a_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B && compute_32f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, bf16, bf16, bf16, float>(arg);
+    else if(a_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_32F && compute_32f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, bf16, bf16, float, float>(arg);
+    else if(a_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F && compute_32f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, float, float, float, float>(arg);
+    else if(a_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F && compute_64f)
+        return testing_gemm_ex_epilogue_d_type<STRIDED, double, double, double, double>(arg);
+
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+inline hipblasStatus_t testing_gemm_ex_with_epilogue(const Arguments& arg)
+{
+    return testing_gemm_ex_epilogue<false>(arg);
+}
+
+inline hipblasStatus_t testing_gemm_strided_batched_ex_with_epilogue(const Arguments& arg)
+{
+    return testing_gemm_ex_epilogue<true>(arg);
+}
@@ -0,0 +1,427 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <typeinfo>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmGroupedBatchedExModel = ArgumentModel<e_transA,
+                                                       e_transB,
+                                                       e_M,
+                                                       e_N,
+                                                       e_K,
+                                                       e_alpha,
+                                                       e_lda,
+                                                       e_ldb,
+                                                       e_beta,
+                                                       e_ldc,
+                                                       e_batch_count,
+                                                       e_group_count>;
+
+inline void testname_gemm_grouped_batched_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmGroupedBatchedExModel{}.test_name(arg, name);
+}
+
+// Group g multiplies batch_count matrices of sizes (M + g, N + g, K + g) with leading dimensions
+// (lda + g, ldb + g, ldc + g) and scalars (alpha + g, beta), so every group has its own shape
+template <typename Ta, typename Tb = Ta, typename Tc = Tb, typename Tex = Tc>
+inline hipblasStatus_t testing_gemm_grouped_batched_ex_template(const Arguments& arg)
+{
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldc = arg.ldc;
+
+    int batch_count = arg.batch_count;
+    int group_count = arg.group_count;
+
+    hipDataType          a_type       = hipblas_type2datatype<Ta>();
+    hipDataType          b_type       = hipblas_type2datatype<Tb>();
+    hipDataType          c_type       = hipblas_type2datatype<Tc>();
+    hipblasComputeType_t compute_type = hipblas_type2computetype<Tex>();
+
+    int norm_check = arg.norm_check;
+    int unit_check = arg.unit_check;
+    int timing     = arg.timing;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0
+       || group_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    std::vector<hipblasOperation_t> transA_array(group_count, transA);
+    std::vector<hipblasOperation_t> transB_array(group_count, transB);
+    std::vector<int>                M_array(group_count), N_array(group_count);
+    std::vector<int>                K_array(group_count), lda_array(group_count);
+    std::vector<int>                ldb_array(group_count), ldc_array(group_count);
+    std::vector<int>                group_size(group_count, batch_count);
+    std::vector<Tex>                h_alpha_array(group_count), h_beta_array(group_count);
+
+    // flop and byte counts of one matrix of each group, the model scales them by batch_count
+    size_t    size_A = 0, size_B = 0, size_C = 0;
+    double    gflops = 0, gbytes = 0;
+    Arguments group_arg = arg;
+    for(int g = 0; g < group_count; g++)
+    {
+        group_arg.alpha = arg.alpha + g;
+
+        M_array[g]       = M + g;
+        N_array[g]       = N + g;
+        K_array[g]       = K + g;
+        lda_array[g]     = lda + g;
+        ldb_array[g]     = ldb + g;
+        ldc_array[g]     = ldc + g;
+        h_alpha_array[g] = group_arg.get_alpha<Tex>();
+        h_beta_array[g]  = arg.get_beta<Tex>();
+
+        int A_col = transA == HIPBLAS_OP_N ? K_array[g] : M_array[g];
+        int B_col = transB == HIPBLAS_OP_N ? N_array[g] : K_array[g];
+        size_A    = std::max(size_A, size_t(lda_array[g]) * A_col);
+        size_B    = std::max(size_B, size_t(ldb_array[g]) * B_col);
+        size_C    = std::max(size_C, size_t(ldc_array[g]) * N_array[g]);
+        gflops += gemm_gflop_count<Tex>(M_array[g], N_array[g], K_array[g]);
+        gbytes += gemm_gbyte_count<Tex>(M_array[g], N_array[g], K_array[g]);
+    }
+
+    // The matrices of all groups are one batch of the largest size; group g uses the
+    // group_size[g] matrices following those of the previous groups
+    int total_count = group_count * batch_count;
+
+    device_batch_vector<Ta> dA(size_A, 1, total_count);
+    device_batch_vector<Tb> dB(size_B, 1, total_count);
+    device_batch_vector<Tc> dC(size_C, 1, total_count);
+
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dB.memcheck());
+    CHECK_HIP_ERROR(dC.memcheck());
+
+    host_batch_vector<Ta> hA(size_A, 1, total_count);
+    host_batch_vector<Tb> hB(size_B, 1, total_count);
+    host_batch_vector<Tc> hC_host(size_C, 1, total_count);
+    host_batch_vector<Tc> hC_gold(size_C, 1, total_count);
+
+    double             gpu_time_used, hipblas_error_host = 0;
+    hipblasLocalHandle handle(arg);
+
+    hipblas_init_vector(hA, arg, hipblas_client_alpha_sets_nan, true);
+    hipblas_init_vector(hB, arg, hipblas_client_alpha_sets_nan);
+    hipblas_init_vector(hC_host, arg, hipblas_client_beta_sets_nan);
+
+    hC_gold.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+
+    auto hipblasGemmGroupedBatchedExFn = [&]() {
+        return hipblasGemmGroupedBatchedEx(handle,
+                                           transA_array.data(),
+                                           transB_array.data(),
+                                           M_array.data(),
+                                           N_array.data(),
+                                           K_array.data(),
+                                           h_alpha_array.data(),
+                                           (const void* const*)(Ta**)dA.ptr_on_device(),
+                                           a_type,
+                                           lda_array.data(),
+                                           (const void* const*)(Tb**)dB.ptr_on_device(),
+                                           b_type,
+                                           ldb_array.data(),
+                                           h_beta_array.data(),
+                                           (void* const*)(Tc**)dC.ptr_on_device(),
+                                           c_type,
+                                           ldc_array.data(),
+                                           group_count,
+                                           group_size.data(),
+                                           compute_type);
+    };
+
+    if(unit_check || norm_check)
+    {
+        // hipBLAS
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedExFn());
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        // CPU BLAS
+        for(int g = 0, first = 0; g < group_count; first += group_size[g++])
+        {
+            for(int b = first; b < first + group_size[g]; b++)
+            {
+                cblas_gemm<Ta, Tc, Tex>(transA,
+                                        transB,
+                                        M_array[g],
+                                        N_array[g],
+                                        K_array[g],
+                                        h_alpha_array[g],
+                                        hA[b],
+                                        lda_array[g],
+                                        hB[b],
+                                        ldb_array[g],
+                                        h_beta_array[g],
+                                        hC_gold[b],
+                                        ldc_array[g]);
+            }
+
+            if(unit_check)
+            {
+                // check for float16/bfloat16 input
+                if((getArchMajor() == 11)
+                   && ((std::is_same<Tex, float>{} && std::is_same<Ta, hipblasBfloat16>{})
+                       || (std::is_same<Tex, float>{} && std::is_same<Ta, hipblasHalf>{})
+                       || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ta, hipblasHalf>{})))
+                {
+                    const double tol = K_array[g] * sum_error_tolerance_for_gfx11<Tex, Ta, Tc>;
+                    near_check_general<Tc>(M_array[g],
+                                           N_array[g],
+                                           group_size[g],
+                                           ldc_array[g],
+                                           (Tc**)hC_gold + first,
+                                           (Tc**)hC_host + first,
+                                           tol);
+                }
+                else
+                {
+                    unit_check_general<Tc>(M_array[g],
+                                           N_array[g],
+                                           group_size[g],
+                                           ldc_array[g],
+                                           (Tc**)hC_gold + first,
+                                           (Tc**)hC_host + first);
+                }
+            }
+
+            if(norm_check)
+            {
+                for(int b = first; b < first + group_size[g]; b++)
+                    hipblas_error_host += norm_check_general<Tc>(
+                        'F', M_array[g], N_array[g], ldc_array[g], hC_gold[b], hC_host[b]);
+            }
+        }
+    }
+
+    if(timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasGemmGroupedBatchedExFn());
+        }
+        gpu_time_used = hot_loop.time_us();
+
+        hipblasGemmGroupedBatchedExModel{}.log_args<Tc>(std::cout,
+                                                        arg,
+                                                        gpu_time_used,
+                                                        gflops,
+                                                        gbytes,
+                                                        hipblas_error_host,
+                                                        ArgumentLogging::NA_value);
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+#ifdef HIPBLAS_V2
+
+inline hipblasStatus_t testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t    a_type            = arg.a_type;
+    hipblasDatatype_t    b_type            = arg.b_type;
+    hipblasDatatype_t    c_type            = arg.c_type;
+    hipblasComputeType_t compute_type_gemm = arg.compute_type_gemm;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_type == HIP_R_16F && b_type == HIP_R_16F && c_type == HIP_R_16F
+       && compute_type_gemm == HIPBLAS_COMPUTE_16F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf>(arg);
+    }
+    else if(a_type == HIP_R_16F && b_type == HIP_R_16F && c_type == HIP_R_16F
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf,
+                                                          hipblasHalf,
+                                                          hipblasHalf,
+                                                          float>(arg);
+    }
+    else if(a_type == HIP_R_16F && b_type == HIP_R_16F && c_type == HIP_R_32F
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status
+            = testing_gemm_grouped_batched_ex_template<hipblasHalf, hipblasHalf, float, float>(arg);
+    }
+    else if(a_type == HIP_R_16BF && b_type == HIP_R_16BF && c_type == HIP_R_16BF
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          float>(arg);
+    }
+    else if(a_type == HIP_R_16BF && b_type == HIP_R_16BF && c_type == HIP_R_32F
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          float,
+                                                          float>(arg);
+    }
+    else if(a_type == HIP_R_32F && b_type == HIP_R_32F && c_type == HIP_R_32F
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<float>(arg);
+    }
+    else if(a_type == HIP_R_64F && b_type == HIP_R_64F && c_type == HIP_R_64F
+            && compute_type_gemm == HIPBLAS_COMPUTE_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<double>(arg);
+    }
+    else if(a_type == HIP_R_8I && b_type == HIP_R_8I && c_type == HIP_R_32I
+            && compute_type_gemm == HIPBLAS_COMPUTE_32I)
+    {
+        status = testing_gemm_grouped_batched_ex_template<int8_t, int8_t, int32_t, int32_t>(arg);
+    }
+    else if(a_type == HIP_C_32F && b_type == HIP_C_32F && c_type == HIP_C_32F
+            && compute_type_gemm == HIPBLAS_COMPUTE_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasComplex>(arg);
+    }
+    else if(a_type == HIP_C_64F && b_type == HIP_C_64F && c_type == HIP_C_64F
+            && compute_type_gemm == HIPBLAS_COMPUTE_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasDoubleComplex>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
+
+#else
+
+inline hipblasStatus_t testing_gemm_grouped_batched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t a_type       = arg.a_type;
+    hipblasDatatype_t b_type       = arg.b_type;
+    hipblasDatatype_t c_type       = arg.c_type;
+    hipblasDatatype_t compute_type = arg.compute_type;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+       && compute_type == HIPBLAS_R_16F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasHalf,
+                                                          hipblasHalf,
+                                                          hipblasHalf,
+                                                          float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status
+            = testing_gemm_grouped_batched_ex_template<hipblasHalf, hipblasHalf, float, float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_16B
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_16B && b_type == HIPBLAS_R_16B && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasBfloat16,
+                                                          hipblasBfloat16,
+                                                          float,
+                                                          float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<float>(arg);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<double>(arg);
+    }
+    else if(a_type == HIPBLAS_C_32F && b_type == HIPBLAS_C_32F && c_type == HIPBLAS_C_32F
+            && compute_type == HIPBLAS_C_32F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_C_64F && b_type == HIPBLAS_C_64F && c_type == HIPBLAS_C_64F
+            && compute_type == HIPBLAS_C_64F)
+    {
+        status = testing_gemm_grouped_batched_ex_template<hipblasDoubleComplex>(arg);
+    }
+    else if(a_type == HIPBLAS_R_8I && b_type == HIPBLAS_R_8I && c_type == HIPBLAS_R_32I
+            && compute_type == HIPBLAS_R_32I)
+    {
+        status = testing_gemm_grouped_batched_ex_template<int8_t, int8_t, int32_t, int32_t>(arg);
+    }
+    else
+    {
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    return status;
+}
+
+#endif
@@ -242,12 +242,16 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
-        {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+        // Copies of the operands that the hot iterations rotate through with
+        // --flush_batch_count or --flush_memory_size, so that they start with cold caches
+        size_t flush = hipblas_flush_copies(arg, sizeof(T) * (A_size + B_size + C_size));
+        rotating_device_vector<T> dA_flush(dA, A_size, flush);
+        rotating_device_vector<T> dB_flush(dB, B_size, flush);
+        rotating_device_vector<T> dC_flush(dC, C_size, flush);
 
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
+        {
             CHECK_HIPBLAS_ERROR(hipblasGemmStridedBatchedFn(handle,
                                                             transA,
                                                             transB,
@@ -255,19 +259,19 @@ inline hipblasStatus_t testing_gemm_strided_batched(const Arguments& arg)
                                                             N,
                                                             K,
                                                             &h_alpha,
-                                                            dA,
+                                                            dA_flush[iter],
                                                             lda,
                                                             stride_A,
-                                                            dB,
+                                                            dB_flush[iter],
                                                             ldb,
                                                             stride_B,
                                                             &h_beta,
-                                                            dC,
+                                                            dC_flush[iter],
                                                             ldc,
                                                             stride_C,
                                                             batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGemmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -432,12 +432,9 @@ inline hipblasStatus_t testing_getrs_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasGetrsStridedBatchedFn(handle,
                                                              op,
                                                              N,
@@ -453,7 +450,7 @@ inline hipblasStatus_t testing_getrs_strided_batched(const Arguments& arg)
                                                              &info,
                                                              batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasGetrsStridedBatchedModel{}.log_args<T>(std::cout,
                                                       arg,
@@ -191,12 +191,9 @@ inline hipblasStatus_t testing_herkx_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasHerkxBatchedFn(handle,
                                                       uplo,
                                                       transA,
@@ -212,7 +209,7 @@ inline hipblasStatus_t testing_herkx_batched(const Arguments& arg)
                                                       ldc,
                                                       batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = hot_loop.time_us(); // in microseconds
 
         hipblasHerkxBatchedModel{}.log_args<T>(std::cout,
                                                arg,
@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_ilp64(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<e_M, e_N, e_K, e_batch_count>{}.test_name(arg, name);
+}
+
+// The _64 variants run the same problem as the 32-bit functions when the sizes fit, so each
+// check runs both and expects identical results. A backend without a 64-bit entry point for a
+// function reports HIPBLAS_STATUS_NOT_SUPPORTED, and that check is skipped.
+
+inline hipblasStatus_t testing_ilp64_axpy(hipblasHandle_t handle, const Arguments& arg)
+{
+    const int64_t N     = arg.N;
+    const float   alpha = 2.0f;
+
+    host_vector<float>   hx(N), hy(N), hy_64(N);
+    device_vector<float> dx(N), dy(N), dy_64(N);
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, N, 1, 0, 1, hipblas_client_never_set_nan, false);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy_64, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+
+    hipblasStatus_t status = hipblasSaxpy_64(handle, N, &alpha, dx, 1, dy_64, 1);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS;
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIPBLAS_ERROR(hipblasSaxpy(handle, N, &alpha, dx, 1, dy, 1));
+
+    CHECK_HIP_ERROR(hy.transfer_from(dy));
+    CHECK_HIP_ERROR(hy_64.transfer_from(dy_64));
+    unit_check_general<float>(1, N, 1, hy, hy_64);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_ilp64_amax(hipblasHandle_t handle, const Arguments& arg)
+{
+    const int64_t N = arg.N;
+
+    host_vector<float>   hx(N);
+    device_vector<float> dx(N);
+    hipblas_init_vector(hx, arg, N, 1, 0, 1, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+
+    int64_t         result_64 = 0;
+    int             result    = 0;
+    hipblasStatus_t status    = hipblasIsamax_64(handle, N, dx, 1, &result_64);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS;
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIPBLAS_ERROR(hipblasIsamax(handle, N, dx, 1, &result));
+
+    EXPECT_EQ(int64_t(result), result_64);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_ilp64_dot_strided_batched(hipblasHandle_t  handle,
+                                                         const Arguments& arg)
+{
+    const int64_t       N           = arg.N;
+    const int64_t       batch_count = arg.batch_count;
+    const hipblasStride stride      = N;
+    const size_t        size        = size_t(N) * batch_count;
+
+    host_vector<float>   hx(size), hy(size), hr(batch_count), hr_64(batch_count);
+    device_vector<float> dx(size), dy(size);
+    hipblas_init_vector(hx, arg, N, 1, stride, batch_count, hipblas_client_never_set_nan, true);
+    hipblas_init_vector(hy, arg, N, 1, stride, batch_count, hipblas_client_never_set_nan, false);
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx, sizeof(float) * hx.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(float) * hy.size(), hipMemcpyHostToDevice));
+
+    hipblasStatus_t status = hipblasSdotStridedBatched_64(
+        handle, N, dx, 1, stride, dy, 1, stride, batch_count, hr_64);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS;
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIPBLAS_ERROR(
+        hipblasSdotStridedBatched(handle, N, dx, 1, stride, dy, 1, stride, batch_count, hr));
+
+    unit_check_general<float>(1, batch_count, 1, hr, hr_64);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_ilp64_gemm(hipblasHandle_t handle, const Arguments& arg)
+{
+    const int64_t M = arg.M, N = arg.N, K = arg.K;
+    const int64_t lda = M, ldb = K, ldc = M;
+    const float   alpha = 1.0f, beta = 0.5f;
+
+    host_vector<float>   hA(lda * K), hB(ldb * N), hC(ldc * N), hC_64(ldc * N);
+    device_vector<float> dA(lda * K), dB(ldb * N), dC(ldc * N), dC_64(ldc * N);
+    hipblas_init_matrix(hA, arg, M, K, lda, 0, 1, hipblas_client_never_set_nan, true);
+    hipblas_init_matrix(hB, arg, K, N, ldb, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hC, arg, M, N, ldc, 0, 1, hipblas_client_never_set_nan);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_64, hC, sizeof(float) * hC.size(), hipMemcpyHostToDevice));
+
+    hipblasStatus_t status = hipblasSgemm_64(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC_64, ldc);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS;
+    CHECK_HIPBLAS_ERROR(status);
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+
+    // gemm_ex with the same float problem as the typed gemm
+    status = hipblasGemmEx_v2_64(handle,
+                                 HIPBLAS_OP_N,
+                                 HIPBLAS_OP_N,
+                                 M,
+                                 N,
+                                 K,
+                                 &alpha,
+                                 dA,
+                                 HIP_R_32F,
+                                 lda,
+                                 dB,
+                                 HIP_R_32F,
+                                 ldb,
+                                 &beta,
+                                 dC_64,
+                                 HIP_R_32F,
+                                 ldc,
+                                 HIPBLAS_COMPUTE_32F,
+                                 HIPBLAS_GEMM_DEFAULT);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIPBLAS_ERROR(hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    }
+
+    CHECK_HIP_ERROR(hC.transfer_from(dC));
+    CHECK_HIP_ERROR(hC_64.transfer_from(dC_64));
+    unit_check_general<float>(M, N, ldc, hC, hC_64);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_ilp64(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    CHECK_HIPBLAS_ERROR(testing_ilp64_axpy(handle, arg));
+    CHECK_HIPBLAS_ERROR(testing_ilp64_amax(handle, arg));
+    CHECK_HIPBLAS_ERROR(testing_ilp64_dot_strided_batched(handle, arg));
+    CHECK_HIPBLAS_ERROR(testing_ilp64_gemm(handle, arg));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
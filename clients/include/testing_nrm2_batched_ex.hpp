@@ -168,12 +168,9 @@ inline hipblasStatus_t testing_nrm2_batched_ex_template(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasNrm2BatchedExFn(handle,
                                                        N,
                                                        dx.ptr_on_device(),
@@ -184,7 +181,7 @@ inline hipblasStatus_t testing_nrm2_batched_ex_template(const Arguments& arg)
                                                        resultType,
                                                        executionType));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasNrm2BatchedExModel{}.log_args<Tx>(std::cout,
                                                  arg,
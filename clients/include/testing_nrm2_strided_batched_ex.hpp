@@ -177,12 +177,9 @@ inline hipblasStatus_t testing_nrm2_strided_batched_ex_template(const Arguments&
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasNrm2StridedBatchedExFn(handle,
                                                               N,
                                                               dx,
@@ -194,7 +191,7 @@ inline hipblasStatus_t testing_nrm2_strided_batched_ex_template(const Arguments&
                                                               resultType,
                                                               executionType));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasNrm2StridedBatchedExModel{}.log_args<Tx>(std::cout,
                                                         arg,
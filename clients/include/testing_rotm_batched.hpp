@@ -153,12 +153,9 @@ inline hipblasStatus_t testing_rotm_batched(const Arguments& arg)
         CHECK_HIP_ERROR(dy.transfer_from(hy));
         CHECK_HIP_ERROR(dparam.transfer_from(hparam));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasRotmBatchedFn(handle,
                                                      N,
                                                      dx.ptr_on_device(),
@@ -168,7 +165,7 @@ inline hipblasStatus_t testing_rotm_batched(const Arguments& arg)
                                                      dparam.ptr_on_device(),
                                                      batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasRotmBatchedModel{}.log_args<T>(std::cout,
                                               arg,
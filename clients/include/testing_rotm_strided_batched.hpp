@@ -181,12 +181,9 @@ inline hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
         CHECK_HIP_ERROR(hipMemcpy(dy, hy, sizeof(T) * size_y, hipMemcpyHostToDevice));
         CHECK_HIP_ERROR(hipMemcpy(dparam, hparam, sizeof(T) * size_param, hipMemcpyHostToDevice));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR((hipblasRotmStridedBatchedFn(handle,
                                                              N,
                                                              dx,
@@ -199,7 +196,7 @@ inline hipblasStatus_t testing_rotm_strided_batched(const Arguments& arg)
                                                              stride_param,
                                                              batch_count)));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasRotmStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -182,12 +182,9 @@ inline hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasRotmgBatchedFn(handle,
                                                       dd1.ptr_on_device(),
                                                       dd2.ptr_on_device(),
@@ -196,7 +193,7 @@ inline hipblasStatus_t testing_rotmg_batched(const Arguments& arg)
                                                       dparams.ptr_on_device(),
                                                       batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasRotmgBatchedModel{}.log_args<T>(std::cout,
                                                arg,
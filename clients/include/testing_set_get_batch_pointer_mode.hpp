@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_batch_pointer_mode(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_set_get_batch_pointer_mode(const Arguments& arg)
+{
+    hipblasLocalHandle        handle(arg);
+    hipblasBatchPointerMode_t mode;
+
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchPointerMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_BATCH_POINTER_MODE_DEVICE, mode);
+    EXPECT_HIPBLAS_STATUS(hipblasGetBatchPointerMode(handle, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasSetBatchPointerMode(handle, hipblasBatchPointerMode_t(2)),
+                          HIPBLAS_STATUS_INVALID_ENUM);
+
+    const int   M = 32, N = 16, K = 24, lda = M, ldb = K, ldc = M, batch_count = 5;
+    const float alpha = 1.5f, beta = 0.0f;
+    size_t      size_A = size_t(lda) * K, size_B = size_t(ldb) * N, size_C = size_t(ldc) * N;
+
+    host_vector<float>   hA(size_A * batch_count);
+    host_vector<float>   hB(size_B * batch_count);
+    host_vector<float>   hC(size_C * batch_count);
+    host_vector<float>   hC_gold(size_C * batch_count);
+    device_vector<float> dA(size_A * batch_count);
+    device_vector<float> dB(size_B * batch_count);
+    device_vector<float> dC(size_C * batch_count);
+    hipblas_init_matrix(hA, arg, M, K * batch_count, lda, 0, 1, hipblas_client_never_set_nan);
+    hipblas_init_matrix(hB, arg, K, N * batch_count, ldb, 0, 1, hipblas_client_never_set_nan);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    std::vector<const float*> A_array(batch_count), B_array(batch_count);
+    std::vector<float*>       C_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        A_array[b] = (const float*)dA + b * size_A;
+        B_array[b] = (const float*)dB + b * size_B;
+        C_array[b] = (float*)dC + b * size_C;
+    }
+
+    // Reference: the arrays of pointers copied to the device by the caller
+    device_vector<const float*> dA_array(batch_count), dB_array(batch_count);
+    device_vector<float*>       dC_array(batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, A_array.data(), sizeof(float*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_array, B_array.data(), sizeof(float*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dC_array, C_array.data(), sizeof(float*) * batch_count, hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasSgemmBatched(handle,
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_N,
+                                            M,
+                                            N,
+                                            K,
+                                            &alpha,
+                                            dA_array,
+                                            lda,
+                                            dB_array,
+                                            ldb,
+                                            &beta,
+                                            dC_array,
+                                            ldc,
+                                            batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(hC_gold, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemset(dC, 0, sizeof(float) * hC.size()));
+
+    // The same call with the host arrays, which may be reused as soon as the call returns
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchPointerMode(handle, HIPBLAS_BATCH_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasGetBatchPointerMode(handle, &mode));
+    EXPECT_EQ(HIPBLAS_BATCH_POINTER_MODE_HOST, mode);
+    CHECK_HIPBLAS_ERROR(hipblasSgemmBatched(handle,
+                                            HIPBLAS_OP_N,
+                                            HIPBLAS_OP_N,
+                                            M,
+                                            N,
+                                            K,
+                                            &alpha,
+                                            A_array.data(),
+                                            lda,
+                                            B_array.data(),
+                                            ldb,
+                                            &beta,
+                                            C_array.data(),
+                                            ldc,
+                                            batch_count));
+    std::fill(A_array.begin(), A_array.end(), nullptr);
+    std::fill(B_array.begin(), B_array.end(), nullptr);
+    std::fill(C_array.begin(), C_array.end(), nullptr);
+
+    CHECK_HIP_ERROR(hipMemcpy(hC, dC, sizeof(float) * hC.size(), hipMemcpyDeviceToHost));
+    unit_check_general<float>(M, N * batch_count, ldc, hC_gold, hC);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetBatchPointerMode(handle, HIPBLAS_BATCH_POINTER_MODE_DEVICE));
+    return HIPBLAS_STATUS_SUCCESS;
+}
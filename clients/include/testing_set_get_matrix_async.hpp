@@ -128,18 +128,15 @@ inline hipblasStatus_t testing_set_get_matrix_async(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasSetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc, stream));
             CHECK_HIPBLAS_ERROR(hipblasGetMatrixAsyncFn(
                 rows, cols, sizeof(T), (void*)dc, ldc, (void*)hb, ldb, stream));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasSetGetMatrixAsyncModel{}.log_args<T>(std::cout,
                                                     arg,
@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_set_get_workspace(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+// Solve with a unit lower triangular A that is zero below the diagonal, so B is left unchanged
+inline hipblasStatus_t testing_set_get_workspace_trsm(hipblasHandle_t handle, const Arguments& arg)
+{
+    const int   M = 256, N = 256, lda = M, ldb = M;
+    const float alpha = 1.0f;
+
+    host_vector<float>   hA(size_t(lda) * M);
+    host_vector<float>   hB(size_t(ldb) * N);
+    host_vector<float>   hB_gold(size_t(ldb) * N);
+    device_vector<float> dA(size_t(lda) * M);
+    device_vector<float> dB(size_t(ldb) * N);
+    hipblas_init_matrix(hB, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+    hB_gold = hB;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_UNIT,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dA,
+                                     lda,
+                                     dB,
+                                     ldb));
+
+    CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(float) * hB.size(), hipMemcpyDeviceToHost));
+    unit_check_general<float>(M, N, ldb, hB_gold, hB);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+inline hipblasStatus_t testing_set_get_workspace(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    size_t             size = 0;
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+
+    // Size the workspace for the calls to be made, where the backend supports the query
+    size_t          workspace_size = 1 << 20;
+    hipblasStatus_t status         = hipblasStartWorkspaceSizeQuery(handle);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        CHECK_HIPBLAS_ERROR(status);
+        CHECK_HIPBLAS_ERROR(testing_set_get_workspace_trsm(handle, arg));
+        CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceSizeQuery(handle, &size));
+        workspace_size = std::max(workspace_size, size);
+    }
+
+    device_vector<char> workspace(workspace_size);
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, workspace, workspace_size));
+    CHECK_HIPBLAS_ERROR(hipblasGetWorkspaceSize(handle, &size));
+    EXPECT_EQ(workspace_size, size);
+
+    CHECK_HIPBLAS_ERROR(testing_set_get_workspace_trsm(handle, arg));
+
+    // Hand workspace management back to the library before the workspace is freed
+    CHECK_HIPBLAS_ERROR(hipblasSetWorkspace(handle, nullptr, 0));
+    CHECK_HIPBLAS_ERROR(testing_set_get_workspace_trsm(handle, arg));
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
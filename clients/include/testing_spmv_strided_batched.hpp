@@ -204,13 +204,9 @@ inline hipblasStatus_t testing_spmv_strided_batched(const Arguments& arg)
         hipStream_t stream;
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-            {
-                gpu_time_used = get_time_us_sync(stream);
-            }
             CHECK_HIPBLAS_ERROR(hipblasSpmvStridedBatchedFn(handle,
                                                             uplo,
                                                             M,
@@ -227,7 +223,7 @@ inline hipblasStatus_t testing_spmv_strided_batched(const Arguments& arg)
                                                             batch_count));
         }
 
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+        gpu_time_used = hot_loop.time_us();
 
         hipblasSpmvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
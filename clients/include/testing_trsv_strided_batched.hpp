@@ -191,12 +191,9 @@ inline hipblasStatus_t testing_trsv_strided_batched(const Arguments& arg)
         CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int iter = 0; hot_loop.next(iter); iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
-
             CHECK_HIPBLAS_ERROR(hipblasTrsvStridedBatchedFn(handle,
                                                             uplo,
                                                             transA,
@@ -210,7 +207,7 @@ inline hipblasStatus_t testing_trsv_strided_batched(const Arguments& arg)
                                                             stridex,
                                                             batch_count));
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+        gpu_time_used = hot_loop.time_us(); // in microseconds
 
         hipblasTrsvStridedBatchedModel{}.log_args<T>(std::cout,
                                                      arg,
@@ -0,0 +1,98 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+inline void testname_workspace_size_query(const Arguments& arg, std::string& name)
+{
+    ArgumentModel<>{}.test_name(arg, name);
+}
+
+inline hipblasStatus_t testing_workspace_size_query(const Arguments& arg)
+{
+    const int   M = 512, N = 512, lda = M, ldb = M;
+    const float alpha = 1.0f;
+
+    hipblasLocalHandle handle(arg);
+
+    hipblasStatus_t status = hipblasStartWorkspaceSizeQuery(handle);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return HIPBLAS_STATUS_SUCCESS; // backend manages its own workspace
+    CHECK_HIPBLAS_ERROR(status);
+
+    // Only one query at a time
+    EXPECT_HIPBLAS_STATUS(hipblasStartWorkspaceSizeQuery(handle), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // A is zero apart from its unit diagonal, so the solve leaves B unchanged
+    host_vector<float>   hA(size_t(lda) * M);
+    host_vector<float>   hB(size_t(ldb) * N);
+    host_vector<float>   hB_gold(size_t(ldb) * N);
+    device_vector<float> dA(size_t(lda) * M);
+    device_vector<float> dB(size_t(ldb) * N);
+    hipblas_init_matrix(hB, arg, M, N, ldb, 0, 1, hipblas_client_never_set_nan);
+    hB_gold = hB;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, sizeof(float) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, sizeof(float) * hB.size(), hipMemcpyHostToDevice));
+
+    // Calls made during the query only record their workspace
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_UNIT,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dA,
+                                     lda,
+                                     dB,
+                                     ldb));
+
+    size_t size = 0;
+    CHECK_HIPBLAS_ERROR(hipblasStopWorkspaceSizeQuery(handle, &size));
+    EXPECT_HIPBLAS_STATUS(hipblasStopWorkspaceSizeQuery(handle, &size),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // The queried shape now runs against the reserved workspace
+    CHECK_HIPBLAS_ERROR(hipblasStrsm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_LOWER,
+                                     HIPBLAS_OP_N,
+                                     HIPBLAS_DIAG_UNIT,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dA,
+                                     lda,
+                                     dB,
+                                     ldb));
+    CHECK_HIP_ERROR(hipMemcpy(hB, dB, sizeof(float) * hB.size(), hipMemcpyDeviceToHost));
+    unit_check_general<float>(M, N, ldb, hB_gold, hB);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
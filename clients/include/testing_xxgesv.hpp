@@ -0,0 +1,262 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasXXgesvModel = ArgumentModel<e_N, e_lda, e_ldb>;
+
+inline void testname_xxgesv(const Arguments& arg, std::string& name)
+{
+    hipblasXXgesvModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline void setup_xxgesv_testing(
+    host_vector<T>& hA, host_vector<T>& hB, host_vector<T>& hX, int N, int lda, int ldb)
+{
+    // Initial hA, hB, hX on CPU, A diagonally dominant so the refinement converges
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hX, N, 1, ldb);
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+        }
+    }
+
+    // Calculate hB = hA*hX;
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    cblas_gemm<T>(op, op, N, 1, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv_bad_arg(const Arguments& arg)
+{
+    auto hipblasXXgesvFn = arg.fortran ? hipblasXXgesv<T, true> : hipblasXXgesv<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N    = 100;
+    const int          nrhs = 1;
+    const int          lda  = 101;
+    const int          ldb  = 102;
+    const int          ldx  = 102;
+
+    const size_t A_size = size_t(lda) * N;
+    const size_t B_size = size_t(ldb) * nrhs;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(B_size);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+    int                iter = 0;
+    int                info = 0;
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, nullptr, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(
+            handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(
+            handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, nullptr, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv(const Arguments& arg)
+{
+    using U              = real_t<T>;
+    bool FORTRAN         = arg.fortran;
+    auto hipblasXXgesvFn = FORTRAN ? hipblasXXgesv<T, true> : hipblasXXgesv<T, false>;
+
+    int N   = arg.N;
+    int lda = arg.lda;
+    int ldb = arg.ldb;
+    int ldx = arg.ldb;
+
+    size_t A_size = size_t(lda) * N;
+    size_t B_size = size_t(ldb) * 1;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX1(B_size);
+    host_vector<int> hIpiv(N);
+    int              iter, info, device_info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(B_size);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_xxgesv_testing<T>(hA, hB, hX, N, lda, ldb);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    // The rocBLAS backend needs device kernels that are only built with the HIP compiler
+    hipblasStatus_t status
+        = hipblasXXgesvFn(handle, N, 1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, B_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&device_info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        cblas_getrf<T>(N, N, hA.data(), lda, hIpiv.data());
+        cblas_getrs<T>('N', N, 1, hA.data(), lda, hIpiv.data(), hB.data(), ldb);
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB.data(), hX1.data());
+
+        // A diagonally dominant system converges without falling back to the full solve
+        if(iter < 0)
+            hipblas_error += 1.0;
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, 1, 1, &zero, &device_info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int iter_min = iter, iter_max = iter;
+
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int run = 0; hot_loop.next(run); run++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasXXgesvFn(
+                handle, N, 1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo));
+
+            iter_min = std::min(iter_min, iter);
+            iter_max = std::max(iter_max, iter);
+        }
+        gpu_time_used = hot_loop.time_us();
+
+        hipblasXXgesvModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         gesv_gflop_count<T>(N, 1),
+                                         ArgumentLogging::NA_value,
+                                         hipblas_error,
+                                         0,
+                                         {{"iter_min", iter_min}, {"iter_max", iter_max}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
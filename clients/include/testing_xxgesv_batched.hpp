@@ -0,0 +1,459 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasXXgesvBatchedModel = ArgumentModel<e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_xxgesv_batched(const Arguments& arg, std::string& name)
+{
+    hipblasXXgesvBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline void setup_xxgesv_batched_testing(host_batch_vector<T>& hA,
+                                         host_batch_vector<T>& hB,
+                                         host_batch_vector<T>& hX,
+                                         int                   N,
+                                         int                   lda,
+                                         int                   ldb,
+                                         int                   batch_count)
+{
+    // Initial hA, hB, hX on CPU, A diagonally dominant so the refinement converges
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipblas_init<T>(hA[b], N, N, lda);
+        hipblas_init<T>(hX[b], N, 1, ldb);
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hA[b], lda, hX[b], ldb, (T)0, hB[b], ldb);
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasXXgesvBatchedFn
+        = arg.fortran ? hipblasXXgesvBatched<T, true> : hipblasXXgesvBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          ldx         = 102;
+    const int          batch_count = 2;
+
+    const size_t A_size = size_t(lda) * N;
+    const size_t B_size = size_t(ldb) * nrhs;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+    device_batch_vector<T> dX(B_size, 1, batch_count);
+    device_vector<int>     dIpiv(size_t(N) * batch_count);
+    device_vector<int>     dInfo(batch_count);
+    host_vector<int>       hIter(batch_count);
+    int                    info = 0;
+
+    T* const* dAp = dA.ptr_on_device();
+    T* const* dBp = dB.ptr_on_device();
+    T* const* dXp = dX.ptr_on_device();
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 nullptr,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 -1,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvBatchedFn(
+            handle, N, -1, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, &info, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 nullptr,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 N - 1,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 nullptr,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-5, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 nullptr,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 N - 1,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-7, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 nullptr,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 N - 1,
+                                                 hIter,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 nullptr,
+                                                 &info,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-10, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvBatchedFn(handle,
+                                                 N,
+                                                 nrhs,
+                                                 dAp,
+                                                 lda,
+                                                 dIpiv,
+                                                 dBp,
+                                                 ldb,
+                                                 dXp,
+                                                 ldx,
+                                                 hIter,
+                                                 &info,
+                                                 nullptr,
+                                                 batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvBatchedFn(
+            handle, N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, &info, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-13, info);
+
+    // If batch_count == 0, iter and deviceInfo can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasXXgesvBatchedFn(
+            handle, N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, nullptr, &info, nullptr, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv_batched(const Arguments& arg)
+{
+    using U      = real_t<T>;
+    bool FORTRAN = arg.fortran;
+    auto hipblasXXgesvBatchedFn
+        = FORTRAN ? hipblasXXgesvBatched<T, true> : hipblasXXgesvBatched<T, false>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldx         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    size_t A_size    = size_t(lda) * N;
+    size_t B_size    = size_t(ldb) * 1;
+    size_t Ipiv_size = size_t(N) * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_vector<T> hA(A_size, 1, batch_count);
+    host_batch_vector<T> hX(B_size, 1, batch_count);
+    host_batch_vector<T> hB(B_size, 1, batch_count);
+    host_batch_vector<T> hX1(B_size, 1, batch_count);
+    host_vector<int>     hIpiv(Ipiv_size);
+    host_vector<int>     hIter(batch_count);
+    host_vector<int>     hInfo(batch_count);
+    int                  info;
+
+    device_batch_vector<T> dA(A_size, 1, batch_count);
+    device_batch_vector<T> dB(B_size, 1, batch_count);
+    device_batch_vector<T> dX(B_size, 1, batch_count);
+    device_vector<int>     dIpiv(Ipiv_size);
+    device_vector<int>     dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_xxgesv_batched_testing<T>(hA, hB, hX, N, lda, ldb, batch_count);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    // The rocBLAS backend needs device kernels that are only built with the HIP compiler
+    hipblasStatus_t status = hipblasXXgesvBatchedFn(handle,
+                                                    N,
+                                                    1,
+                                                    dA.ptr_on_device(),
+                                                    lda,
+                                                    dIpiv,
+                                                    dB.ptr_on_device(),
+                                                    ldb,
+                                                    dX.ptr_on_device(),
+                                                    ldx,
+                                                    hIter,
+                                                    &info,
+                                                    dInfo,
+                                                    batch_count);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hX1.transfer_from(dX));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_getrf<T>(N, N, hA[b], lda, hIpiv.data() + b * N);
+            cblas_getrs<T>('N', N, 1, hA[b], lda, hIpiv.data() + b * N, hB[b], ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, hB, hX1, batch_count);
+
+        // A diagonally dominant system converges without falling back to the full solve
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(hIter[b] < 0 || hInfo[b] != 0)
+                hipblas_error += 1.0;
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int iter_min = *std::min_element(hIter.begin(), hIter.end());
+        int iter_max = *std::max_element(hIter.begin(), hIter.end());
+
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int run = 0; hot_loop.next(run); run++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasXXgesvBatchedFn(handle,
+                                                       N,
+                                                       1,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dIpiv,
+                                                       dB.ptr_on_device(),
+                                                       ldb,
+                                                       dX.ptr_on_device(),
+                                                       ldx,
+                                                       hIter,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count));
+
+            iter_min = std::min(iter_min, *std::min_element(hIter.begin(), hIter.end()));
+            iter_max = std::max(iter_max, *std::max_element(hIter.begin(), hIter.end()));
+        }
+        gpu_time_used = hot_loop.time_us();
+
+        hipblasXXgesvBatchedModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gesv_gflop_count<T>(N, 1),
+                                                ArgumentLogging::NA_value,
+                                                hipblas_error,
+                                                0,
+                                                {{"iter_min", iter_min}, {"iter_max", iter_max}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
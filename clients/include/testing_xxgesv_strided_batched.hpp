@@ -0,0 +1,552 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "gtest/gtest.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasXXgesvStridedBatchedModel
+    = ArgumentModel<e_N, e_lda, e_ldb, e_stride_scale, e_batch_count>;
+
+inline void testname_xxgesv_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasXXgesvStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+inline void setup_xxgesv_strided_batched_testing(host_vector<T>& hA,
+                                                 host_vector<T>& hB,
+                                                 host_vector<T>& hX,
+                                                 int             N,
+                                                 int             lda,
+                                                 int             ldb,
+                                                 hipblasStride   strideA,
+                                                 hipblasStride   strideB,
+                                                 int             batch_count)
+{
+    // Initial hA, hB, hX on CPU, A diagonally dominant so the refinement converges
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, 1, ldb);
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] += 400;
+                else
+                    hAb[i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, (T)1, hAb, lda, hXb, ldb, (T)0, hBb, ldb);
+    }
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasXXgesvStridedBatchedFn = arg.fortran ? hipblasXXgesvStridedBatched<T, true>
+                                                     : hipblasXXgesvStridedBatched<T, false>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 1;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          ldx         = 102;
+    const int          batch_count = 2;
+    hipblasStride      strideA     = size_t(lda) * N;
+    hipblasStride      strideB     = size_t(ldb) * nrhs;
+    hipblasStride      strideX     = size_t(ldx) * nrhs;
+    hipblasStride      strideP     = size_t(N);
+
+    device_vector<T>   dA(strideA * batch_count);
+    device_vector<T>   dB(strideB * batch_count);
+    device_vector<T>   dX(strideX * batch_count);
+    device_vector<int> dIpiv(strideP * batch_count);
+    device_vector<int> dInfo(batch_count);
+    host_vector<int>   hIter(batch_count);
+    int                info = 0;
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        nullptr,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        -1,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-1, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        -1,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-2, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        nullptr,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-3, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        N - 1,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-4, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        nullptr,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-6, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        nullptr,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-8, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        N - 1,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-9, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        nullptr,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-11, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        N - 1,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-12, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        nullptr,
+                                                        &info,
+                                                        dInfo,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-14, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        nullptr,
+                                                        batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-16, info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasXXgesvStridedBatchedFn(handle,
+                                                        N,
+                                                        nrhs,
+                                                        dA,
+                                                        lda,
+                                                        strideA,
+                                                        dIpiv,
+                                                        strideP,
+                                                        dB,
+                                                        ldb,
+                                                        strideB,
+                                                        dX,
+                                                        ldx,
+                                                        strideX,
+                                                        hIter,
+                                                        &info,
+                                                        dInfo,
+                                                        -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(-17, info);
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+inline hipblasStatus_t testing_xxgesv_strided_batched(const Arguments& arg)
+{
+    using U                            = real_t<T>;
+    bool FORTRAN                       = arg.fortran;
+    auto hipblasXXgesvStridedBatchedFn = FORTRAN ? hipblasXXgesvStridedBatched<T, true>
+                                                 : hipblasXXgesvStridedBatched<T, false>;
+
+    int    N            = arg.N;
+    int    lda          = arg.lda;
+    int    ldb          = arg.ldb;
+    int    ldx          = arg.ldb;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+
+    hipblasStride strideA   = size_t(lda) * N * stride_scale;
+    hipblasStride strideB   = size_t(ldb) * 1 * stride_scale;
+    hipblasStride strideX   = size_t(ldx) * 1 * stride_scale;
+    hipblasStride strideP   = size_t(N) * stride_scale;
+    size_t        A_size    = strideA * batch_count;
+    size_t        B_size    = strideB * batch_count;
+    size_t        X_size    = strideX * batch_count;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(X_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX1(X_size);
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hIter(batch_count);
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dX(X_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_xxgesv_strided_batched_testing<T>(hA, hB, hX, N, lda, ldb, strideA, strideB, batch_count);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA, A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB, B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    // The rocBLAS backend needs device kernels that are only built with the HIP compiler
+    hipblasStatus_t status = hipblasXXgesvStridedBatchedFn(handle,
+                                                           N,
+                                                           1,
+                                                           dA,
+                                                           lda,
+                                                           strideA,
+                                                           dIpiv,
+                                                           strideP,
+                                                           dB,
+                                                           ldb,
+                                                           strideB,
+                                                           dX,
+                                                           ldx,
+                                                           strideX,
+                                                           hIter,
+                                                           &info,
+                                                           dInfo,
+                                                           batch_count);
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+    CHECK_HIPBLAS_ERROR(status);
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hipMemcpy(hX1, dX, X_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_getrf<T>(N, N, hA.data() + b * strideA, lda, hIpiv.data() + b * strideP);
+            cblas_getrs<T>('N',
+                           N,
+                           1,
+                           hA.data() + b * strideA,
+                           lda,
+                           hIpiv.data() + b * strideP,
+                           hB.data() + b * strideB,
+                           ldb);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, 1, ldb, strideB, hB, hX1, batch_count);
+
+        // A diagonally dominant system converges without falling back to the full solve
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(hIter[b] < 0 || hInfo[b] != 0)
+                hipblas_error += 1.0;
+        }
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int iter_min = *std::min_element(hIter.begin(), hIter.end());
+        int iter_max = *std::max_element(hIter.begin(), hIter.end());
+
+        hipblas_hot_loop hot_loop(arg, stream);
+        for(int run = 0; hot_loop.next(run); run++)
+        {
+            CHECK_HIPBLAS_ERROR(hipblasXXgesvStridedBatchedFn(handle,
+                                                              N,
+                                                              1,
+                                                              dA,
+                                                              lda,
+                                                              strideA,
+                                                              dIpiv,
+                                                              strideP,
+                                                              dB,
+                                                              ldb,
+                                                              strideB,
+                                                              dX,
+                                                              ldx,
+                                                              strideX,
+                                                              hIter,
+                                                              &info,
+                                                              dInfo,
+                                                              batch_count));
+
+            iter_min = std::min(iter_min, *std::min_element(hIter.begin(), hIter.end()));
+            iter_max = std::max(iter_max, *std::max_element(hIter.begin(), hIter.end()));
+        }
+        gpu_time_used = hot_loop.time_us();
+
+        hipblasXXgesvStridedBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            gesv_gflop_count<T>(N, 1),
+            ArgumentLogging::NA_value,
+            hipblas_error,
+            0,
+            {{"iter_min", iter_min}, {"iter_max", iter_max}});
+    }
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
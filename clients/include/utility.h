@@ -79,6 +79,7 @@
                     hipblasStatusToString(status__), \
                     __FILE__,                        \
                     __LINE__);                       \
+            hipblas_graph_abort();                   \
             return (status__);                       \
         }                                            \
     } while(0)
@@ -684,6 +685,25 @@ void hipblas_init_hermitian(std::vector<T>& A, int N, int lda)
                 A[j + i * lda] = A[i + j * lda] = random_generator<T>();
 }
 
+/*! \brief  hermitian positive definite matrix initialization: */
+// A = M * M^H with the diagonal raised so A is strictly diagonally dominant
+template <typename T>
+void hipblas_init_hpd(T* A, int N, int lda)
+{
+    std::vector<T> M(size_t(N) * lda);
+    hipblas_init<T>(M.data(), N, N, lda);
+    cblas_gemm<T>(
+        HIPBLAS_OP_N, HIPBLAS_OP_C, N, N, N, T(1), M.data(), lda, M.data(), lda, T(0), A, lda);
+
+    for(int i = 0; i < N; i++)
+    {
+        real_t<T> t = 0;
+        for(int j = 0; j < N; j++)
+            t += std::abs(A[i + j * lda]);
+        A[i + i * lda] = T(t);
+    }
+}
+
 /* ============================================================================================ */
 /*! \brief  Initialize an array with random data, with NaN where appropriate */
 
@@ -982,6 +1002,141 @@ double get_time_us_sync(hipStream_t stream);
 
 struct Arguments;
 
+// Size in bytes of the device workspace hipblasLocalHandle allocates for tests that do not
+// request one themselves (set by the --workspace option of hipblas-test)
+extern size_t hipblas_client_workspace;
+
+/*! \brief  Timer of the hot loop of a benchmark test, which calls next(iter) before each of its
+            arg.cold_iters + arg.iters iterations and stops when it returns false:
+
+                hipblas_hot_loop hot_loop(arg, stream);
+                for(int iter = 0; hot_loop.next(iter); iter++)
+                    ...
+                gpu_time_used = hot_loop.time_us();
+
+            With arg.iteration_stats, next runs the hot iterations a second time, after the wall
+            time is taken, recording an event before each, for the per-iteration GPU times that
+            hipblas_take_loop_timing returns. It also captures the loop of a hipblas-bench --graph
+            replay and starts the loops of a --streams group together. */
+class hipblas_hot_loop
+{
+public:
+    hipblas_hot_loop(const Arguments& arg, hipStream_t stream);
+    ~hipblas_hot_loop();
+
+    hipblas_hot_loop(const hipblas_hot_loop&) = delete;
+    hipblas_hot_loop& operator=(const hipblas_hot_loop&) = delete;
+
+    bool next(int iter);
+
+    // Wall time in microseconds of the hot iterations
+    double time_us() const
+    {
+        return m_time_us;
+    }
+
+private:
+    void start();
+    void stop();
+
+    hipStream_t m_stream;
+    int         m_cold_iters;
+    int         m_iters;
+    bool        m_stats;
+    bool        m_replay;
+    bool        m_group;
+    bool        m_rerun   = false;
+    double      m_time_us = 0;
+};
+
+/*! \brief  GPU timing of the last hot loop of the calling thread */
+struct hipblas_loop_timing
+{
+    // GPU time in microseconds of the loop of a --streams group or --graph replay, else -1
+    double loop_us = -1;
+
+    // GPU time in microseconds of each hot iteration with arg.iteration_stats, or of each call
+    // of each replay of a --graph replay; empty if the loop did not record them
+    std::vector<double> times_us;
+};
+
+/*! \brief  Take the timing of the last hot loop of the calling thread */
+hipblas_loop_timing hipblas_take_loop_timing();
+
+/*! \brief  Number of copies of its operands, of bytes in all, that the hot loop of a test rotates
+            through to run with cold caches: enough copies to exceed --flush_memory_size bytes,
+            else --flush_batch_count copies, else 1. ArgumentModel::log_perf reports the copies. */
+size_t hipblas_flush_copies(const Arguments& arg, size_t bytes);
+
+/*! \brief  Copies rotated by the hot loop of the last test, 1 if it did not rotate; resets it */
+size_t hipblas_take_flush_copies();
+
+/*! \brief  Device memory pool of the thread: while enabled, the memory a d_vector frees is kept
+            and serves later allocations that fit in it, so that the points of a hipblas-bench
+            --sweep reuse the buffers of its largest point. Disabling it frees the kept memory. */
+void hipblas_device_pool_enable(bool enable);
+
+/*! \brief  Kept device memory of at least bytes, or nullptr if the pool has none */
+void* hipblas_device_pool_take(size_t bytes);
+
+/*! \brief  Keep device memory of bytes freed by a d_vector; false if the pool is disabled */
+bool hipblas_device_pool_keep(void* ptr, size_t bytes);
+
+/*! \brief  Stream on which the handles that hipblasLocalHandle(arg) creates on the calling thread
+            run; null, the default, for the default stream of the handle */
+void hipblas_set_local_stream(hipStream_t stream);
+
+/*! \brief  GPU time span of the hot loop of one stream of a hipblas-bench --streams group, in
+            microseconds from the start of the group, and the work the loop did */
+struct hipblas_stream_span
+{
+    bool   recorded = false; // false if the stream did not complete a timed hot loop
+    double start_us = 0;
+    double end_us   = 0;
+    int    calls    = 0;
+    double gflop    = 0;
+    double gbyte    = 0;
+};
+
+/*! \brief  Start a group of streams threads running tests concurrently on the current device */
+void hipblas_stream_group_begin(int streams);
+
+/*! \brief  Make the calling thread, whose loops run on stream, stream index of the group: its
+            first hot iteration waits for those of the other streams, so that their hot loops
+            overlap. Leaving before a hot loop, as a failing test does, releases the others. */
+void hipblas_stream_group_join(int index, hipStream_t stream);
+void hipblas_stream_group_leave();
+
+/*! \brief  Index in the group of the calling thread, or -1 if it is not in a group */
+int hipblas_stream_group_index();
+
+/*! \brief  Record the work of the last hot loop of the calling thread, for its span */
+void hipblas_stream_group_work(int calls, double gflop, double gbyte);
+
+/*! \brief  End the group, returning the span of each of its streams */
+std::vector<hipblas_stream_span> hipblas_stream_group_end();
+
+/*! \brief  How the hot loops of hipblas-bench --graph run on the calling thread: off without
+            --graph; eager for the row timing the calls as they are issued; replay for the row
+            where hipblas_hot_loop captures the iters hot calls of the loop into a HIP
+            graph, then times replays of it, whose times per call become the iteration times. */
+enum class hipblas_graph_mode
+{
+    off,
+    eager,
+    replay,
+};
+
+void               hipblas_set_graph_mode(hipblas_graph_mode mode, int iters);
+hipblas_graph_mode hipblas_get_graph_mode();
+
+/*! \brief  End a capture left open by a loop that returns on a hipBLAS error while capturing */
+void hipblas_graph_abort();
+
+/*! \brief  hipSuccess if the last loop of a replay was captured and replayed, else the error
+            that made it fail, such as a synchronization or allocation the capture prohibits */
+hipError_t hipblas_take_graph_status();
+
 /* ============================================================================================ */
 /*! \brief  local handle which is automatically created and destroyed  */
 class hipblasLocalHandle
@@ -571,6 +571,13 @@ typedef enum
     HIPBLAS_ATOMICS_ALLOWED = 1 /**< Algorithms will take advantage of atomics where applicable. */
 } hipblasAtomicsMode_t;
 
+/*! \brief Indicates if the arrays of matrix and vector pointers passed to Batched functions are on host or device. */
+typedef enum
+{
+    HIPBLAS_BATCH_POINTER_MODE_DEVICE = 0, /**< Arrays of batch pointers are located on the device. */
+    HIPBLAS_BATCH_POINTER_MODE_HOST = 1 /**< Arrays of batch pointers are located on the host. */
+} hipblasBatchPointerMode_t;
+
 /*! \brief Control flags passed into gemm ex with flags algorithms. Only relevant with rocBLAS backend. See rocBLAS documentation
  *         for more information.*/
 typedef enum
@@ -585,6 +592,56 @@ typedef enum
     = 0x10 /**< enumerator rocblas_gemm_flags_fp16_alt_impl_rnz */
 } hipblasGemmFlags_t;
 
+/*! \brief Activation function applied by the epilogue of hipblasGemmExWithEpilogue. */
+typedef enum
+{
+    HIPBLAS_ACTIVATION_NONE = 0, /**< No activation. */
+    HIPBLAS_ACTIVATION_RELU = 1, /**< max(x, 0). */
+    HIPBLAS_ACTIVATION_GELU
+    = 2 /**< 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3))), the tanh approximation of GELU. */
+} hipblasActivation_t;
+
+/*! \brief Indicates how the epilogue of hipblasGemmExWithEpilogue scales the product. */
+typedef enum
+{
+    HIPBLAS_EPILOGUE_SCALE_NONE = 0, /**< No scaling. */
+    HIPBLAS_EPILOGUE_SCALE_ROW  = 1, /**< Row i is multiplied by scale[i], scale has m elements. */
+    HIPBLAS_EPILOGUE_SCALE_COLUMN
+    = 2 /**< Column j is multiplied by scale[j], scale has n elements. */
+} hipblasEpilogueScale_t;
+
+/*! \brief Operations applied to the result of hipblasGemmExWithEpilogue before it is stored.
+ *
+ *  Every element of alpha*op(A)*op(B) + beta*C becomes
+ *
+ *      D(i, j) = activation(scale * (alpha*op(A)*op(B) + beta*C)(i, j) + bias[i])
+ *
+ *  in at least single precision, rounded to dType. scale, bias and D point to device memory.
+ *  Zero initialize the structure to get a plain GEMM and set only the fields needed. */
+typedef struct
+{
+    /** How the product is scaled. */
+    hipblasEpilogueScale_t scaleMode;
+    /** Device vector of m or n scales of cType, required unless scaleMode is none. */
+    const void* scale;
+    /** Stride between the scale vectors of a strided batch. */
+    hipblasStride strideScale;
+    /** Device vector of m elements of cType added to every column, or NULL. */
+    const void* bias;
+    /** Stride between the bias vectors of a strided batch. */
+    hipblasStride strideBias;
+    /** Activation applied last. */
+    hipblasActivation_t activation;
+    /** Device output matrix, or NULL to write the result to C. */
+    void* D;
+    /** Datatype of D, ignored when D is NULL. */
+    hipDataType dType;
+    /** Leading dimension of D, at least m. */
+    int ldd;
+    /** Stride between the D matrices of a strided batch. */
+    hipblasStride strideD;
+} hipblasGemmEpilogue_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -827,6 +884,259 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Set where the arrays of batch pointers passed to Batched functions are
+
+    \details
+    By default, the arrays of matrix and vector pointers taken by Batched functions are device
+    arrays. With HIPBLAS_BATCH_POINTER_MODE_HOST they are host arrays of device pointers instead:
+    hipBLAS copies them through pinned memory owned by the handle and queues the upload on the
+    stream of the handle, so the call does not wait for the device. The host arrays can be
+    reused or freed as soon as the call returns.
+
+    The pinned memory is reused once its upload has run, so calls in this mode should not be
+    captured in a HIP graph. The mode applies to the Batched gemm, trsm, getrf and getrs
+    functions, gemmBatchedEx and the Level 2 Batched functions; other functions are not
+    affected.
+
+    - Supported in rocBLAS and cuBLAS. The host backend reads host arrays in either mode.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    mode      [hipblasBatchPointerMode_t]
+              where the arrays of batch pointers are located.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetBatchPointerMode(hipblasHandle_t           handle,
+                                                          hipblasBatchPointerMode_t mode);
+
+/*! \brief Get where the arrays of batch pointers passed to Batched functions are */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetBatchPointerMode(hipblasHandle_t            handle,
+                                                          hipblasBatchPointerMode_t* mode);
+
+/*! \brief Start a workspace size query on the handle
+
+    \details
+    Until hipblasStopWorkspaceSizeQuery() is called, hipBLAS functions called with the handle
+    do not compute anything; they only record the device workspace they would need, for each
+    problem shape. This lets an application size the workspace once at startup for all the
+    shapes it will use, so that later calls do not have to grow it.
+
+    - Supported in rocBLAS only.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasStartWorkspaceSizeQuery(hipblasHandle_t handle);
+
+/*! \brief Stop a workspace size query on the handle
+
+    \details
+    Ends the query started by hipblasStartWorkspaceSizeQuery() and grows the device workspace
+    of the handle to the largest size needed by the calls made during the query. The workspace
+    is never shrunk. The size needed by each shape is kept by the handle and reserved again
+    before the shape is run.
+
+    If the application provided the workspace with hipblasSetWorkspace(), it is left as is;
+    the returned size can be used to allocate a large enough workspace to pass to
+    hipblasSetWorkspace().
+
+    - Supported in rocBLAS only.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    size      pointer to the size in bytes of device workspace needed by the queried calls.
+              May be nullptr.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasStopWorkspaceSizeQuery(hipblasHandle_t handle,
+                                                             size_t*         size);
+
+/*! \brief Provide the device workspace used by the handle
+
+    \details
+    Functions called with the handle use the given device memory as their workspace, and
+    hipBLAS no longer allocates workspace for the handle. This keeps device allocations out of
+    the calls themselves, for example so that they can be captured in a HIP graph. A function
+    that needs more workspace than provided returns HIPBLAS_STATUS_ALLOC_FAILED; the size
+    needed for a set of calls can be found with hipblasStartWorkspaceSizeQuery() and
+    hipblasStopWorkspaceSizeQuery().
+
+    The workspace must stay allocated until the handle is destroyed or another workspace is
+    set. Passing nullptr or a size of 0 returns workspace management to the backend library.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    workspace pointer to the device workspace.
+    @param[in]
+    workspaceSizeInBytes [size_t]
+              size in bytes of the workspace.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle,
+                                                   void*           workspace,
+                                                   size_t          workspaceSizeInBytes);
+
+/*! \brief Get the size of the device workspace used by the handle
+
+    \details
+    Reports the size of the workspace set with hipblasSetWorkspace(), or of the workspace
+    currently allocated by the backend library. cuBLAS does not report the size of the
+    workspace it manages itself, so 0 is returned in that case.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[out]
+    workspaceSizeInBytes
+              pointer to the size in bytes of the workspace.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle,
+                                                       size_t*         workspaceSizeInBytes);
+
+/*! \brief Set the solution run by the GemmEx functions
+
+    \details
+    Functions of the hipblasGemmEx, hipblasGemmBatchedEx and hipblasGemmStridedBatchedEx
+    families, including hipblasGemmExWithEpilogue and
+    hipblasGemmStridedBatchedExWithEpilogue, called with the handle and HIPBLAS_GEMM_DEFAULT
+    run the given solution of the backend library instead of the one it would pick. A solution
+    that does not apply to the problem makes the call return HIPBLAS_STATUS_INVALID_VALUE; with
+    HIPBLAS_GEMM_FLAGS_CHECK_SOLUTION_INDEX, the call only checks whether the solution applies.
+    The solutions available for a combination of types are listed by
+    hipblasGemmExGetSolutionsByType().
+
+    Setting 0, the default, restores the choice of the backend library, or of the tuning file
+    named by the HIPBLAS_GEMM_TUNING_FILE environment variable when the handle was created.
+    Such a file is written by hipblas-bench --tune and lists the fastest solution found for
+    each tuned problem shape; the GemmEx calls of that shape then run it automatically.
+
+    - Supported in rocBLAS only.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    solutionIndex
+              index of the solution, as listed by hipblasGemmExGetSolutionsByType(), or 0.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmSolutionIndex(hipblasHandle_t handle,
+                                                           int32_t         solutionIndex);
+
+/*! \brief Get the solution set with hipblasSetGemmSolutionIndex(), or 0 if none is */
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmSolutionIndex(hipblasHandle_t handle,
+                                                           int32_t*        solutionIndex);
+
+/*! \brief List the GemmEx solutions of the backend library for a combination of types
+
+    \details
+    The solutions can be passed to hipblasSetGemmSolutionIndex(). Not all of them apply to
+    every problem shape or transpose combination.
+
+    - Supported in rocBLAS only.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    aType     [hipDataType]
+              datatype of the matrices A and B.
+    @param[in]
+    cType     [hipDataType]
+              datatype of the matrix C.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              computation type, as passed to hipblasGemmEx_v2().
+    @param[out]
+    solutions array of at least count entries receiving the first solutions. May be nullptr
+              to only get their number.
+    @param[inout]
+    count     on entry, the number of entries of solutions; on exit, the number of solutions.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExGetSolutionsByType(hipblasHandle_t      handle,
+                                                               hipDataType          aType,
+                                                               hipDataType          cType,
+                                                               hipblasComputeType_t computeType,
+                                                               int32_t*             solutions,
+                                                               int*                 count);
+
+/*! \brief Build the device array of pointers for a strided batch
+
+    \details
+    hipblasBuildBatchPointers sets dArray[b] = base + b * stride elements, for
+    b = 0, ..., batchCount - 1, so that a strided batch can be passed to the Batched functions.
+    The array is written by a kernel queued on the stream of the handle, so it can be built,
+    used and rebuilt without synchronizing with the host.
+
+    - Supported in rocBLAS when hipBLAS is built with the HIP compiler.
+    - In cuBLAS the array is built on the host and copied on the stream of the handle.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    base      device pointer to the first matrix or vector of the batch.
+    @param[in]
+    elemSize  [int]
+              number of bytes per element.
+    @param[in]
+    stride    [hipblasStride]
+              number of elements between the starts of consecutive matrices or vectors.
+    @param[in]
+    batchCount [int]
+              number of pointers to build.
+    @param[out]
+    dArray    device array of batchCount pointers.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasBuildBatchPointers(hipblasHandle_t handle,
+                                                         void*           base,
+                                                         int             elemSize,
+                                                         hipblasStride   stride,
+                                                         int             batchCount,
+                                                         void**          dArray);
+
+/*! \brief Build the device array of pointers for selected entries of a strided batch
+
+    \details
+    hipblasGatherBatchPointers sets dArray[b] = base + dIndices[b] * stride elements, for
+    b = 0, ..., batchCount - 1. As for hipblasBuildBatchPointers(), the array is written by a
+    kernel queued on the stream of the handle; dIndices may be produced by earlier work on the
+    same stream.
+
+    - Supported in rocBLAS when hipBLAS is built with the HIP compiler.
+    - In cuBLAS the indices are copied to the host, which synchronizes the stream of the handle.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    base      device pointer to the first matrix or vector of the strided batch.
+    @param[in]
+    elemSize  [int]
+              number of bytes per element.
+    @param[in]
+    stride    [hipblasStride]
+              number of elements between the starts of consecutive matrices or vectors.
+    @param[in]
+    dIndices  device array of batchCount indices into the strided batch.
+    @param[in]
+    batchCount [int]
+              number of pointers to build.
+    @param[out]
+    dArray    device array of batchCount pointers.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGatherBatchPointers(hipblasHandle_t handle,
+                                                          void*           base,
+                                                          int             elemSize,
+                                                          hipblasStride   stride,
+                                                          const int*      dIndices,
+                                                          int             batchCount,
+                                                          void**          dArray);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -861,20 +1171,41 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handl
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasIcamax_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_v2(
     hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result);
 //! @}
 
 /*! @{
@@ -908,9 +1239,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_v2(
 HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched_64(hipblasHandle_t    handle,
+                                                       int64_t            n,
+                                                       const float* const x[],
+                                                       int64_t            incx,
+                                                       int64_t            batchCount,
+                                                       int64_t*           result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
     hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched_64(hipblasHandle_t     handle,
+                                                       int64_t             n,
+                                                       const double* const x[],
+                                                       int64_t             incx,
+                                                       int64_t             batchCount,
+                                                       int64_t*            result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -918,6 +1263,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t
                                                     int                         batchCount,
                                                     int*                        result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       int64_t*                    result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
@@ -925,6 +1277,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t
                                                     int                               batchCount,
                                                     int*                              result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       int64_t*                          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_v2(hipblasHandle_t         handle,
                                                        int                     n,
                                                        const hipComplex* const x[],
@@ -932,12 +1291,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_v2(hipblasHandle_t         h
                                                        int                     batchCount,
                                                        int*                    result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched_v2_64(hipblasHandle_t         handle,
+                                                          int64_t                 n,
+                                                          const hipComplex* const x[],
+                                                          int64_t                 incx,
+                                                          int64_t                 batchCount,
+                                                          int64_t*                result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched_v2(hipblasHandle_t               handle,
                                                        int                           n,
                                                        const hipDoubleComplex* const x[],
                                                        int                           incx,
                                                        int                           batchCount,
                                                        int*                          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxBatched_v2_64(hipblasHandle_t               handle,
+                                                          int64_t                       n,
+                                                          const hipDoubleComplex* const x[],
+                                                          int64_t                       incx,
+                                                          int64_t                       batchCount,
+                                                          int64_t*                      result);
 //! @}
 
 /*! @{
@@ -981,6 +1354,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const double*   x,
@@ -989,6 +1370,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched(hipblasHandle_t handl
                                                            int             batchCount,
                                                            int*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const double*   x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount,
+                                                              int64_t*        result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -997,6 +1386,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            int*                  result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              int64_t*              result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -1005,6 +1402,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched(hipblasHandle_t
                                                            int                         batchCount,
                                                            int*                        result);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIzamaxStridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   int64_t*                    result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_v2(hipblasHandle_t   handle,
                                                               int               n,
                                                               const hipComplex* x,
@@ -1013,6 +1419,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_v2(hipblasHandle_t
                                                               int               batchCount,
                                                               int*              result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                 int64_t           n,
+                                                                 const hipComplex* x,
+                                                                 int64_t           incx,
+                                                                 hipblasStride     stridex,
+                                                                 int64_t           batchCount,
+                                                                 int64_t*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched_v2(hipblasHandle_t         handle,
                                                               int                     n,
                                                               const hipDoubleComplex* x,
@@ -1020,6 +1434,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched_v2(hipblasHandle_t
                                                               hipblasStride           stridex,
                                                               int                     batchCount,
                                                               int*                    result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamaxStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                 int64_t                 n,
+                                                                 const hipDoubleComplex* x,
+                                                                 int64_t                 incx,
+                                                                 hipblasStride           stridex,
+                                                                 int64_t                 batchCount,
+                                                                 int64_t*                result);
 //! @}
 
 /*! @{
@@ -1243,20 +1665,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasIzaminStridedBatched_v2(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSasum(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasum_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDasum(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScasum(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScasum_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_v2(
     hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -1293,6 +1733,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_v2(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -1300,6 +1747,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched(hipblasHandle_t     handle,
                                                    int                 batchCount,
                                                    double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -1307,6 +1761,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched(hipblasHandle_t
                                                     int                         batchCount,
                                                     float*                      result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
@@ -1314,6 +1775,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched(hipblasHandle_t
                                                     int                               batchCount,
                                                     double*                           result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_v2(hipblasHandle_t         handle,
                                                        int                     n,
                                                        const hipComplex* const x[],
@@ -1321,12 +1789,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_v2(hipblasHandle_t         h
                                                        int                     batchCount,
                                                        float*                  result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumBatched_v2_64(hipblasHandle_t         handle,
+                                                          int64_t                 n,
+                                                          const hipComplex* const x[],
+                                                          int64_t                 incx,
+                                                          int64_t                 batchCount,
+                                                          float*                  result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched_v2(hipblasHandle_t               handle,
                                                        int                           n,
                                                        const hipDoubleComplex* const x[],
                                                        int                           incx,
                                                        int                           batchCount,
                                                        double*                       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumBatched_v2_64(hipblasHandle_t               handle,
+                                                          int64_t                       n,
+                                                          const hipDoubleComplex* const x[],
+                                                          int64_t                       incx,
+                                                          int64_t                       batchCount,
+                                                          double*                       result);
 //! @}
 
 /*! @{
@@ -1374,6 +1856,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSasumStridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -1382,6 +1872,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasumStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -1390,6 +1888,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            float*                result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -1398,6 +1904,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched(hipblasHandle_t
                                                            int                         batchCount,
                                                            double*                     result);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDzasumStridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   double*                     result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_v2(hipblasHandle_t   handle,
                                                               int               n,
                                                               const hipComplex* x,
@@ -1406,6 +1921,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_v2(hipblasHandle_t
                                                               int               batchCount,
                                                               float*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasumStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                 int64_t           n,
+                                                                 const hipComplex* x,
+                                                                 int64_t           incx,
+                                                                 hipblasStride     stridex,
+                                                                 int64_t           batchCount,
+                                                                 float*            result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched_v2(hipblasHandle_t         handle,
                                                               int                     n,
                                                               const hipDoubleComplex* x,
@@ -1413,6 +1936,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched_v2(hipblasHandle_t
                                                               hipblasStride           stridex,
                                                               int                     batchCount,
                                                               double*                 result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasumStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                 int64_t                 n,
+                                                                 const hipDoubleComplex* x,
+                                                                 int64_t                 incx,
+                                                                 hipblasStride           stridex,
+                                                                 int64_t                 batchCount,
+                                                                 double*                 result);
 //! @}
 
 /*! @{
@@ -1455,6 +1986,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpy(hipblasHandle_t    handle,
                                             hipblasHalf*       y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpy_64(hipblasHandle_t    handle,
+                                               int64_t            n,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* x,
+                                               int64_t            incx,
+                                               hipblasHalf*       y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy(hipblasHandle_t handle,
                                             int             n,
                                             const float*    alpha,
@@ -1463,6 +2002,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy(hipblasHandle_t handle,
                                             float*          y,
                                             int             incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                                             int             n,
                                             const double*   alpha,
@@ -1471,6 +2018,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy(hipblasHandle_t handle,
                                             double*         y,
                                             int             incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* alpha,
@@ -1479,6 +2034,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
@@ -1487,6 +2050,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_v2(hipblasHandle_t   handle,
                                                int               n,
                                                const hipComplex* alpha,
@@ -1495,6 +2066,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_v2(hipblasHandle_t   handle,
                                                hipComplex*       y,
                                                int               incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* alpha,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipComplex*       y,
+                                                  int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_v2(hipblasHandle_t         handle,
                                                int                     n,
                                                const hipDoubleComplex* alpha,
@@ -1502,6 +2081,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_v2(hipblasHandle_t         handle,
                                                int                     incx,
                                                hipDoubleComplex*       y,
                                                int                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* alpha,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipDoubleComplex*       y,
+                                                  int64_t                 incy);
 //! @}
 
 /*! @{
@@ -1546,6 +2133,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          hand
                                                    int                      incy,
                                                    int                      batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyBatched_64(hipblasHandle_t          handle,
+                                                      int64_t                  n,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const x[],
+                                                      int64_t                  incx,
+                                                      hipblasHalf* const       y[],
+                                                      int64_t                  incy,
+                                                      int64_t                  batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                                    int                n,
                                                    const float*       alpha,
@@ -1555,6 +2151,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double*       alpha,
@@ -1564,6 +2169,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex*       alpha,
@@ -1573,6 +2187,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex*       alpha,
@@ -1582,6 +2205,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       const hipComplex*       alpha,
@@ -1591,6 +2223,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_v2(hipblasHandle_t         ha
                                                       int                     incy,
                                                       int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         const hipComplex*       alpha,
+                                                         const hipComplex* const x[],
+                                                         int64_t                 incx,
+                                                         hipComplex* const       y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_v2(hipblasHandle_t               handle,
                                                       int                           n,
                                                       const hipDoubleComplex*       alpha,
@@ -1599,6 +2240,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_v2(hipblasHandle_t
                                                       hipDoubleComplex* const       y[],
                                                       int                           incy,
                                                       int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyBatched_v2_64(hipblasHandle_t               handle,
+                                                         int64_t                       n,
+                                                         const hipDoubleComplex*       alpha,
+                                                         const hipDoubleComplex* const x[],
+                                                         int64_t                       incx,
+                                                         hipDoubleComplex* const       y[],
+                                                         int64_t                       incy,
+                                                         int64_t                       batchCount);
 //! @}
 
 /*! @{
@@ -1651,6 +2301,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyStridedBatched_64(hipblasHandle_t    handle,
+                                                             int64_t            n,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             hipblasHalf*       y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const float*    alpha,
@@ -1662,6 +2323,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   alpha,
@@ -1673,6 +2345,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
@@ -1684,6 +2367,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
@@ -1695,6 +2389,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              const hipComplex* alpha,
@@ -1706,6 +2412,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_v2(hipblasHandle_t   h
                                                              hipblasStride     stridey,
                                                              int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                const hipComplex* alpha,
+                                                                const hipComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                hipComplex*       y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched_v2(hipblasHandle_t         handle,
                                                              int                     n,
                                                              const hipDoubleComplex* alpha,
@@ -1716,6 +2433,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched_v2(hipblasHandle_t
                                                              int                     incy,
                                                              hipblasStride           stridey,
                                                              int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* alpha,
+                                                                const hipDoubleComplex* x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                hipDoubleComplex*       y,
+                                                                int64_t                 incy,
+                                                                hipblasStride           stridey,
+                                                                int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -1751,12 +2479,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyStridedBatched_v2(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScopy(hipblasHandle_t handle, int n, const float* x, int incx, float* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDcopy(hipblasHandle_t handle, int n, const double* x, int incx, double* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy(
     hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, hipblasComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
@@ -1764,15 +2505,36 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_v2(
     hipblasHandle_t handle, int n, const hipComplex* x, int incx, hipComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  hipComplex*       y,
+                                                  int64_t           incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_v2(hipblasHandle_t         handle,
                                                int                     n,
                                                const hipDoubleComplex* x,
                                                int                     incx,
                                                hipDoubleComplex*       y,
                                                int                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  hipDoubleComplex*       y,
+                                                  int64_t                 incy);
 //! @}
 
 /*! @{
@@ -1819,6 +2581,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -1827,6 +2597,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -1835,6 +2613,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -1843,6 +2629,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       const hipComplex* const x[],
@@ -1851,6 +2645,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_v2(hipblasHandle_t         ha
                                                       int                     incy,
                                                       int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         const hipComplex* const x[],
+                                                         int64_t                 incx,
+                                                         hipComplex* const       y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_v2(hipblasHandle_t               handle,
                                                       int                           n,
                                                       const hipDoubleComplex* const x[],
@@ -1858,6 +2660,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_v2(hipblasHandle_t
                                                       hipDoubleComplex* const       y[],
                                                       int                           incy,
                                                       int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyBatched_v2_64(hipblasHandle_t               handle,
+                                                         int64_t                       n,
+                                                         const hipDoubleComplex* const x[],
+                                                         int64_t                       incx,
+                                                         hipDoubleComplex* const       y[],
+                                                         int64_t                       incy,
+                                                         int64_t                       batchCount);
 //! @}
 
 /*! @{
@@ -1918,6 +2728,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScopyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -1928,6 +2748,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopyStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -1938,6 +2768,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -1948,6 +2788,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZcopyStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              const hipComplex* x,
@@ -1958,6 +2809,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_v2(hipblasHandle_t   h
                                                              hipblasStride     stridey,
                                                              int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopyStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                const hipComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                hipComplex*       y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched_v2(hipblasHandle_t         handle,
                                                              int                     n,
                                                              const hipDoubleComplex* x,
@@ -1967,6 +2828,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched_v2(hipblasHandle_t
                                                              int                     incy,
                                                              hipblasStride           stridey,
                                                              int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopyStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                hipDoubleComplex*       y,
+                                                                int64_t                 incy,
+                                                                hipblasStride           stridey,
+                                                                int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -2015,6 +2886,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdot(hipblasHandle_t    handle,
                                            int                incy,
                                            hipblasHalf*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdot_64(hipblasHandle_t    handle,
+                                              int64_t            n,
+                                              const hipblasHalf* x,
+                                              int64_t            incx,
+                                              const hipblasHalf* y,
+                                              int64_t            incy,
+                                              hipblasHalf*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                                             int                    n,
                                             const hipblasBfloat16* x,
@@ -2023,6 +2902,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot(hipblasHandle_t        handle,
                                             int                    incy,
                                             hipblasBfloat16*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdot_64(hipblasHandle_t        handle,
+                                               int64_t                n,
+                                               const hipblasBfloat16* x,
+                                               int64_t                incx,
+                                               const hipblasBfloat16* y,
+                                               int64_t                incy,
+                                               hipblasBfloat16*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                                            int             n,
                                            const float*    x,
@@ -2031,6 +2918,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdot(hipblasHandle_t handle,
                                            int             incy,
                                            float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                                            int             n,
                                            const double*   x,
@@ -2039,6 +2934,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdot(hipblasHandle_t handle,
                                            int             incy,
                                            double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -2047,6 +2950,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc(hipblasHandle_t       handle,
                                             int                   incy,
                                             hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                                             int                   n,
                                             const hipblasComplex* x,
@@ -2055,6 +2966,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu(hipblasHandle_t       handle,
                                             int                   incy,
                                             hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
@@ -2063,6 +2982,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* x,
@@ -2071,6 +2998,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_v2(hipblasHandle_t   handle,
                                                int               n,
                                                const hipComplex* x,
@@ -2079,6 +3014,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_v2(hipblasHandle_t   handle,
                                                int               incy,
                                                hipComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  const hipComplex* y,
+                                                  int64_t           incy,
+                                                  hipComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_v2(hipblasHandle_t   handle,
                                                int               n,
                                                const hipComplex* x,
@@ -2087,6 +3030,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_v2(hipblasHandle_t   handle,
                                                int               incy,
                                                hipComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  const hipComplex* x,
+                                                  int64_t           incx,
+                                                  const hipComplex* y,
+                                                  int64_t           incy,
+                                                  hipComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_v2(hipblasHandle_t         handle,
                                                int                     n,
                                                const hipDoubleComplex* x,
@@ -2095,6 +3046,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_v2(hipblasHandle_t         handle,
                                                int                     incy,
                                                hipDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  const hipDoubleComplex* y,
+                                                  int64_t                 incy,
+                                                  hipDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_v2(hipblasHandle_t         handle,
                                                int                     n,
                                                const hipDoubleComplex* x,
@@ -2102,6 +3061,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_v2(hipblasHandle_t         handle,
                                                const hipDoubleComplex* y,
                                                int                     incy,
                                                hipDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  const hipDoubleComplex* y,
+                                                  int64_t                 incy,
+                                                  hipDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -2157,6 +3124,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handl
                                                   int                      batchCount,
                                                   hipblasHalf*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotBatched_64(hipblasHandle_t          handle,
+                                                     int64_t                  n,
+                                                     const hipblasHalf* const x[],
+                                                     int64_t                  incx,
+                                                     const hipblasHalf* const y[],
+                                                     int64_t                  incy,
+                                                     int64_t                  batchCount,
+                                                     hipblasHalf*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t              handle,
                                                    int                          n,
                                                    const hipblasBfloat16* const x[],
@@ -2166,6 +3142,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched(hipblasHandle_t
                                                    int                          batchCount,
                                                    hipblasBfloat16*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotBatched_64(hipblasHandle_t              handle,
+                                                      int64_t                      n,
+                                                      const hipblasBfloat16* const x[],
+                                                      int64_t                      incx,
+                                                      const hipblasBfloat16* const y[],
+                                                      int64_t                      incy,
+                                                      int64_t                      batchCount,
+                                                      hipblasBfloat16*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                                   int                n,
                                                   const float* const x[],
@@ -2175,6 +3160,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched(hipblasHandle_t    handle,
                                                   int                batchCount,
                                                   float*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotBatched_64(hipblasHandle_t    handle,
+                                                     int64_t            n,
+                                                     const float* const x[],
+                                                     int64_t            incx,
+                                                     const float* const y[],
+                                                     int64_t            incy,
+                                                     int64_t            batchCount,
+                                                     float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                                   int                 n,
                                                   const double* const x[],
@@ -2184,6 +3178,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched(hipblasHandle_t     handle,
                                                   int                 batchCount,
                                                   double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotBatched_64(hipblasHandle_t     handle,
+                                                     int64_t             n,
+                                                     const double* const x[],
+                                                     int64_t             incx,
+                                                     const double* const y[],
+                                                     int64_t             incy,
+                                                     int64_t             batchCount,
+                                                     double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -2193,6 +3196,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched(hipblasHandle_t             h
                                                    int                         batchCount,
                                                    hipblasComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasComplex* const x[],
@@ -2202,6 +3214,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched(hipblasHandle_t             h
                                                    int                         batchCount,
                                                    hipblasComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount,
+                                                      hipblasComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -2211,6 +3232,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched(hipblasHandle_t
                                                    int                               batchCount,
                                                    hipblasDoubleComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t                   handle,
                                                    int                               n,
                                                    const hipblasDoubleComplex* const x[],
@@ -2220,6 +3250,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched(hipblasHandle_t
                                                    int                               batchCount,
                                                    hipblasDoubleComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_64(hipblasHandle_t                   handle,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount,
+                                                      hipblasDoubleComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       const hipComplex* const x[],
@@ -2229,6 +3268,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_v2(hipblasHandle_t         ha
                                                       int                     batchCount,
                                                       hipComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         const hipComplex* const x[],
+                                                         int64_t                 incx,
+                                                         const hipComplex* const y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount,
+                                                         hipComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       const hipComplex* const x[],
@@ -2238,6 +3286,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_v2(hipblasHandle_t         ha
                                                       int                     batchCount,
                                                       hipComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         const hipComplex* const x[],
+                                                         int64_t                 incx,
+                                                         const hipComplex* const y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount,
+                                                         hipComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_v2(hipblasHandle_t               handle,
                                                       int                           n,
                                                       const hipDoubleComplex* const x[],
@@ -2247,6 +3304,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_v2(hipblasHandle_t
                                                       int                           batchCount,
                                                       hipDoubleComplex*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcBatched_v2_64(hipblasHandle_t               handle,
+                                                         int64_t                       n,
+                                                         const hipDoubleComplex* const x[],
+                                                         int64_t                       incx,
+                                                         const hipDoubleComplex* const y[],
+                                                         int64_t                       incy,
+                                                         int64_t                       batchCount,
+                                                         hipDoubleComplex*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_v2(hipblasHandle_t               handle,
                                                       int                           n,
                                                       const hipDoubleComplex* const x[],
@@ -2255,6 +3321,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_v2(hipblasHandle_t
                                                       int                           incy,
                                                       int                           batchCount,
                                                       hipDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuBatched_v2_64(hipblasHandle_t               handle,
+                                                         int64_t                       n,
+                                                         const hipDoubleComplex* const x[],
+                                                         int64_t                       incx,
+                                                         const hipDoubleComplex* const y[],
+                                                         int64_t                       incy,
+                                                         int64_t                       batchCount,
+                                                         hipDoubleComplex*             result);
 //! @}
 
 /*! @{
@@ -2318,6 +3393,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHdotStridedBatched(hipblasHandle_t    hand
                                                          int                batchCount,
                                                          hipblasHalf*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHdotStridedBatched_64(hipblasHandle_t    handle,
+                                                            int64_t            n,
+                                                            const hipblasHalf* x,
+                                                            int64_t            incx,
+                                                            hipblasStride      stridex,
+                                                            const hipblasHalf* y,
+                                                            int64_t            incy,
+                                                            hipblasStride      stridey,
+                                                            int64_t            batchCount,
+                                                            hipblasHalf*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t        handle,
                                                           int                    n,
                                                           const hipblasBfloat16* x,
@@ -2329,6 +3415,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched(hipblasHandle_t
                                                           int                    batchCount,
                                                           hipblasBfloat16*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasBfdotStridedBatched_64(hipblasHandle_t        handle,
+                                                             int64_t                n,
+                                                             const hipblasBfloat16* x,
+                                                             int64_t                incx,
+                                                             hipblasStride          stridex,
+                                                             const hipblasBfloat16* y,
+                                                             int64_t                incy,
+                                                             hipblasStride          stridey,
+                                                             int64_t                batchCount,
+                                                             hipblasBfloat16*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          const float*    x,
@@ -2340,6 +3437,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched(hipblasHandle_t handle,
                                                          int             batchCount,
                                                          float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const float*    x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const float*    y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          const double*   x,
@@ -2351,6 +3459,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched(hipblasHandle_t handle,
                                                          int             batchCount,
                                                          double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            const double*   x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            const double*   y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            int64_t         batchCount,
+                                                            double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -2362,6 +3481,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched(hipblasHandle_t
                                                           int                   batchCount,
                                                           hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* x,
@@ -2373,6 +3503,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched(hipblasHandle_t
                                                           int                   batchCount,
                                                           hipblasComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount,
+                                                             hipblasComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -2384,6 +3525,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched(hipblasHandle_t
                                                           int                         batchCount,
                                                           hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* x,
@@ -2395,6 +3547,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched(hipblasHandle_t
                                                           int                         batchCount,
                                                           hipblasDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_64(hipblasHandle_t             handle,
+                                                             int64_t                     n,
+                                                             const hipblasDoubleComplex* x,
+                                                             int64_t                     incx,
+                                                             hipblasStride               stridex,
+                                                             const hipblasDoubleComplex* y,
+                                                             int64_t                     incy,
+                                                             hipblasStride               stridey,
+                                                             int64_t                     batchCount,
+                                                             hipblasDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              const hipComplex* x,
@@ -2406,6 +3569,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_v2(hipblasHandle_t   h
                                                              int               batchCount,
                                                              hipComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotcStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                const hipComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                const hipComplex* y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                int64_t           batchCount,
+                                                                hipComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              const hipComplex* x,
@@ -2417,6 +3591,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_v2(hipblasHandle_t   h
                                                              int               batchCount,
                                                              hipComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotuStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                const hipComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                const hipComplex* y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                int64_t           batchCount,
+                                                                hipComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_v2(hipblasHandle_t         handle,
                                                              int                     n,
                                                              const hipDoubleComplex* x,
@@ -2428,6 +3613,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_v2(hipblasHandle_t
                                                              int                     batchCount,
                                                              hipDoubleComplex*       result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotcStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                const hipDoubleComplex* y,
+                                                                int64_t                 incy,
+                                                                hipblasStride           stridey,
+                                                                int64_t                 batchCount,
+                                                                hipDoubleComplex*       result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_v2(hipblasHandle_t         handle,
                                                              int                     n,
                                                              const hipDoubleComplex* x,
@@ -2438,6 +3634,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_v2(hipblasHandle_t
                                                              hipblasStride           stridey,
                                                              int                     batchCount,
                                                              hipDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                const hipDoubleComplex* y,
+                                                                int64_t                 incy,
+                                                                hipblasStride           stridey,
+                                                                int64_t                 batchCount,
+                                                                hipDoubleComplex*       result);
 //! @}
 
 /*! @{
@@ -2472,20 +3679,38 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotuStridedBatched_v2(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSnrm2(hipblasHandle_t handle, int n, const float* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDnrm2(hipblasHandle_t handle, int n, const double* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScnrm2(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasScnrm2_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, float* result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_v2(
     hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, double* result);
 //! @}
 
 /*! @{
@@ -2523,6 +3748,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_v2(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      int64_t            batchCount,
+                                                      float*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    const double* const x[],
@@ -2530,6 +3762,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched(hipblasHandle_t     handle,
                                                    int                 batchCount,
                                                    double*             result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Batched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      int64_t             batchCount,
+                                                      double*             result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const hipblasComplex* const x[],
@@ -2537,6 +3776,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched(hipblasHandle_t
                                                     int                         batchCount,
                                                     float*                      result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const hipblasComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount,
+                                                       float*                      result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t                   handle,
                                                     int                               n,
                                                     const hipblasDoubleComplex* const x[],
@@ -2544,6 +3790,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched(hipblasHandle_t
                                                     int                               batchCount,
                                                     double*                           result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched_64(hipblasHandle_t                   handle,
+                                                       int64_t                           n,
+                                                       const hipblasDoubleComplex* const x[],
+                                                       int64_t                           incx,
+                                                       int64_t                           batchCount,
+                                                       double*                           result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_v2(hipblasHandle_t         handle,
                                                        int                     n,
                                                        const hipComplex* const x[],
@@ -2551,12 +3804,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_v2(hipblasHandle_t         h
                                                        int                     batchCount,
                                                        float*                  result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Batched_v2_64(hipblasHandle_t         handle,
+                                                          int64_t                 n,
+                                                          const hipComplex* const x[],
+                                                          int64_t                 incx,
+                                                          int64_t                 batchCount,
+                                                          float*                  result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched_v2(hipblasHandle_t               handle,
                                                        int                           n,
                                                        const hipDoubleComplex* const x[],
                                                        int                           incx,
                                                        int                           batchCount,
                                                        double*                       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Batched_v2_64(hipblasHandle_t               handle,
+                                                          int64_t                       n,
+                                                          const hipDoubleComplex* const x[],
+                                                          int64_t                       incx,
+                                                          int64_t                       batchCount,
+                                                          double*                       result);
 //! @}
 
 /*! @{
@@ -2606,6 +3873,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2StridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           float*          result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             float*          result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   x,
@@ -2614,6 +3889,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched(hipblasHandle_t handle
                                                           int             batchCount,
                                                           double*         result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2StridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount,
+                                                             double*         result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const hipblasComplex* x,
@@ -2622,6 +3905,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched(hipblasHandle_t
                                                            int                   batchCount,
                                                            float*                result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const hipblasComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount,
+                                                              float*                result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t             handle,
                                                            int                         n,
                                                            const hipblasDoubleComplex* x,
@@ -2630,6 +3921,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched(hipblasHandle_t
                                                            int                         batchCount,
                                                            double*                     result);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasDznrm2StridedBatched_64(hipblasHandle_t             handle,
+                                   int64_t                     n,
+                                   const hipblasDoubleComplex* x,
+                                   int64_t                     incx,
+                                   hipblasStride               stridex,
+                                   int64_t                     batchCount,
+                                   double*                     result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_v2(hipblasHandle_t   handle,
                                                               int               n,
                                                               const hipComplex* x,
@@ -2638,6 +3938,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_v2(hipblasHandle_t
                                                               int               batchCount,
                                                               float*            result);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2StridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                 int64_t           n,
+                                                                 const hipComplex* x,
+                                                                 int64_t           incx,
+                                                                 hipblasStride     stridex,
+                                                                 int64_t           batchCount,
+                                                                 float*            result);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched_v2(hipblasHandle_t         handle,
                                                               int                     n,
                                                               const hipDoubleComplex* x,
@@ -2645,6 +3953,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched_v2(hipblasHandle_t
                                                               hipblasStride           stridex,
                                                               int                     batchCount,
                                                               double*                 result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2StridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                 int64_t                 n,
+                                                                 const hipDoubleComplex* x,
+                                                                 int64_t                 incx,
+                                                                 hipblasStride           stridex,
+                                                                 int64_t                 batchCount,
+                                                                 double*                 result);
 //! @}
 
 /*! @{
@@ -2689,6 +4005,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrot(hipblasHandle_t handle,
                                            const float*    c,
                                            const float*    s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              float*          x,
+                                              int64_t         incx,
+                                              float*          y,
+                                              int64_t         incy,
+                                              const float*    c,
+                                              const float*    s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                                            int             n,
                                            double*         x,
@@ -2698,6 +4023,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrot(hipblasHandle_t handle,
                                            const double*   c,
                                            const double*   s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              double*         x,
+                                              int64_t         incx,
+                                              double*         y,
+                                              int64_t         incy,
+                                              const double*   c,
+                                              const double*   s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                                            int                   n,
                                            hipblasComplex*       x,
@@ -2707,6 +4041,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrot(hipblasHandle_t       handle,
                                            const float*          c,
                                            const hipblasComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_64(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              hipblasComplex*       x,
+                                              int64_t               incx,
+                                              hipblasComplex*       y,
+                                              int64_t               incy,
+                                              const float*          c,
+                                              const hipblasComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                                             int             n,
                                             hipblasComplex* x,
@@ -2716,6 +4059,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot(hipblasHandle_t handle,
                                             const float*    c,
                                             const float*    s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy,
+                                               const float*    c,
+                                               const float*    s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                                            int                         n,
                                            hipblasDoubleComplex*       x,
@@ -2725,6 +4077,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrot(hipblasHandle_t             handle,
                                            const double*               c,
                                            const hipblasDoubleComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_64(hipblasHandle_t             handle,
+                                              int64_t                     n,
+                                              hipblasDoubleComplex*       x,
+                                              int64_t                     incx,
+                                              hipblasDoubleComplex*       y,
+                                              int64_t                     incy,
+                                              const double*               c,
+                                              const hipblasDoubleComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                                             int                   n,
                                             hipblasDoubleComplex* x,
@@ -2734,6 +4095,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot(hipblasHandle_t       handle,
                                             const double*         c,
                                             const double*         s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy,
+                                               const double*         c,
+                                               const double*         s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_v2(hipblasHandle_t   handle,
                                               int               n,
                                               hipComplex*       x,
@@ -2743,6 +4113,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_v2(hipblasHandle_t   handle,
                                               const float*      c,
                                               const hipComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrot_v2_64(hipblasHandle_t   handle,
+                                                 int64_t           n,
+                                                 hipComplex*       x,
+                                                 int64_t           incx,
+                                                 hipComplex*       y,
+                                                 int64_t           incy,
+                                                 const float*      c,
+                                                 const hipComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_v2(hipblasHandle_t handle,
                                                int             n,
                                                hipComplex*     x,
@@ -2752,6 +4131,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_v2(hipblasHandle_t handle,
                                                const float*    c,
                                                const float*    s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrot_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  hipComplex*     x,
+                                                  int64_t         incx,
+                                                  hipComplex*     y,
+                                                  int64_t         incy,
+                                                  const float*    c,
+                                                  const float*    s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_v2(hipblasHandle_t         handle,
                                               int                     n,
                                               hipDoubleComplex*       x,
@@ -2761,6 +4149,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_v2(hipblasHandle_t         handle,
                                               const double*           c,
                                               const hipDoubleComplex* s);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrot_v2_64(hipblasHandle_t         handle,
+                                                 int64_t                 n,
+                                                 hipDoubleComplex*       x,
+                                                 int64_t                 incx,
+                                                 hipDoubleComplex*       y,
+                                                 int64_t                 incy,
+                                                 const double*           c,
+                                                 const hipDoubleComplex* s);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_v2(hipblasHandle_t   handle,
                                                int               n,
                                                hipDoubleComplex* x,
@@ -2769,6 +4166,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_v2(hipblasHandle_t   handle,
                                                int               incy,
                                                const double*     c,
                                                const double*     s);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrot_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  hipDoubleComplex* x,
+                                                  int64_t           incx,
+                                                  hipDoubleComplex* y,
+                                                  int64_t           incy,
+                                                  const double*     c,
+                                                  const double*     s);
 //! @}
 
 /*! @{
@@ -2817,6 +4223,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotBatched(hipblasHandle_t handle,
                                                   const float*    s,
                                                   int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     float* const    x[],
+                                                     int64_t         incx,
+                                                     float* const    y[],
+                                                     int64_t         incy,
+                                                     const float*    c,
+                                                     const float*    s,
+                                                     int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                                   int             n,
                                                   double* const   x[],
@@ -2827,6 +4243,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched(hipblasHandle_t handle,
                                                   const double*   s,
                                                   int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotBatched_64(hipblasHandle_t handle,
+                                                     int64_t         n,
+                                                     double* const   x[],
+                                                     int64_t         incx,
+                                                     double* const   y[],
+                                                     int64_t         incy,
+                                                     const double*   c,
+                                                     const double*   s,
+                                                     int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                                   int                   n,
                                                   hipblasComplex* const x[],
@@ -2837,6 +4263,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched(hipblasHandle_t       handle,
                                                   const hipblasComplex* s,
                                                   int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_64(hipblasHandle_t       handle,
+                                                     int64_t               n,
+                                                     hipblasComplex* const x[],
+                                                     int64_t               incx,
+                                                     hipblasComplex* const y[],
+                                                     int64_t               incy,
+                                                     const float*          c,
+                                                     const hipblasComplex* s,
+                                                     int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    hipblasComplex* const x[],
@@ -2847,6 +4283,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched(hipblasHandle_t       handle,
                                                    const float*          s,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      hipblasComplex* const y[],
+                                                      int64_t               incy,
+                                                      const float*          c,
+                                                      const float*          s,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             handle,
                                                   int                         n,
                                                   hipblasDoubleComplex* const x[],
@@ -2857,6 +4303,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched(hipblasHandle_t             ha
                                                   const hipblasDoubleComplex* s,
                                                   int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_64(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     hipblasDoubleComplex* const x[],
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex* const y[],
+                                                     int64_t                     incy,
+                                                     const double*               c,
+                                                     const hipblasDoubleComplex* s,
+                                                     int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    hipblasDoubleComplex* const x[],
@@ -2867,6 +4323,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched(hipblasHandle_t             h
                                                    const double*               s,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasDoubleComplex* const y[],
+                                                      int64_t                     incy,
+                                                      const double*               c,
+                                                      const double*               s,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_v2(hipblasHandle_t   handle,
                                                      int               n,
                                                      hipComplex* const x[],
@@ -2877,6 +4343,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_v2(hipblasHandle_t   handle,
                                                      const hipComplex* s,
                                                      int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotBatched_v2_64(hipblasHandle_t   handle,
+                                                        int64_t           n,
+                                                        hipComplex* const x[],
+                                                        int64_t           incx,
+                                                        hipComplex* const y[],
+                                                        int64_t           incy,
+                                                        const float*      c,
+                                                        const hipComplex* s,
+                                                        int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_v2(hipblasHandle_t   handle,
                                                       int               n,
                                                       hipComplex* const x[],
@@ -2887,6 +4363,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_v2(hipblasHandle_t   handle,
                                                       const float*      s,
                                                       int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotBatched_v2_64(hipblasHandle_t   handle,
+                                                         int64_t           n,
+                                                         hipComplex* const x[],
+                                                         int64_t           incx,
+                                                         hipComplex* const y[],
+                                                         int64_t           incy,
+                                                         const float*      c,
+                                                         const float*      s,
+                                                         int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_v2(hipblasHandle_t         handle,
                                                      int                     n,
                                                      hipDoubleComplex* const x[],
@@ -2897,6 +4383,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_v2(hipblasHandle_t         han
                                                      const hipDoubleComplex* s,
                                                      int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotBatched_v2_64(hipblasHandle_t         handle,
+                                                        int64_t                 n,
+                                                        hipDoubleComplex* const x[],
+                                                        int64_t                 incx,
+                                                        hipDoubleComplex* const y[],
+                                                        int64_t                 incy,
+                                                        const double*           c,
+                                                        const hipDoubleComplex* s,
+                                                        int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       hipDoubleComplex* const x[],
@@ -2906,6 +4402,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_v2(hipblasHandle_t         ha
                                                       const double*           c,
                                                       const double*           s,
                                                       int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         hipDoubleComplex* const x[],
+                                                         int64_t                 incx,
+                                                         hipDoubleComplex* const y[],
+                                                         int64_t                 incy,
+                                                         const double*           c,
+                                                         const double*           s,
+                                                         int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -2962,6 +4468,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotStridedBatched(hipblasHandle_t handle,
                                                          const float*    s,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            float*          x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            float*          y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const float*    c,
+                                                            const float*    s,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                                          int             n,
                                                          double*         x,
@@ -2974,6 +4492,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched(hipblasHandle_t handle,
                                                          const double*   s,
                                                          int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotStridedBatched_64(hipblasHandle_t handle,
+                                                            int64_t         n,
+                                                            double*         x,
+                                                            int64_t         incx,
+                                                            hipblasStride   stridex,
+                                                            double*         y,
+                                                            int64_t         incy,
+                                                            hipblasStride   stridey,
+                                                            const double*   c,
+                                                            const double*   s,
+                                                            int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       handle,
                                                          int                   n,
                                                          hipblasComplex*       x,
@@ -2986,6 +4516,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched(hipblasHandle_t       h
                                                          const hipblasComplex* s,
                                                          int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_64(hipblasHandle_t       handle,
+                                                            int64_t               n,
+                                                            hipblasComplex*       x,
+                                                            int64_t               incx,
+                                                            hipblasStride         stridex,
+                                                            hipblasComplex*       y,
+                                                            int64_t               incy,
+                                                            hipblasStride         stridey,
+                                                            const float*          c,
+                                                            const hipblasComplex* s,
+                                                            int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           hipblasComplex* x,
@@ -2998,6 +4540,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched(hipblasHandle_t handle
                                                           const float*    s,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    c,
+                                                             const float*    s,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t             handle,
                                                          int                         n,
                                                          hipblasDoubleComplex*       x,
@@ -3010,6 +4564,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched(hipblasHandle_t
                                                          const hipblasDoubleComplex* s,
                                                          int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_64(hipblasHandle_t             handle,
+                                                            int64_t                     n,
+                                                            hipblasDoubleComplex*       x,
+                                                            int64_t                     incx,
+                                                            hipblasStride               stridex,
+                                                            hipblasDoubleComplex*       y,
+                                                            int64_t                     incy,
+                                                            hipblasStride               stridey,
+                                                            const double*               c,
+                                                            const hipblasDoubleComplex* s,
+                                                            int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           hipblasDoubleComplex* x,
@@ -3022,6 +4588,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched(hipblasHandle_t
                                                           const double*         s,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             const double*         c,
+                                                             const double*         s,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_v2(hipblasHandle_t   handle,
                                                             int               n,
                                                             hipComplex*       x,
@@ -3034,6 +4612,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_v2(hipblasHandle_t   ha
                                                             const hipComplex* s,
                                                             int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                               int64_t           n,
+                                                               hipComplex*       x,
+                                                               int64_t           incx,
+                                                               hipblasStride     stridex,
+                                                               hipComplex*       y,
+                                                               int64_t           incy,
+                                                               hipblasStride     stridey,
+                                                               const float*      c,
+                                                               const hipComplex* s,
+                                                               int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_v2(hipblasHandle_t handle,
                                                              int             n,
                                                              hipComplex*     x,
@@ -3046,6 +4636,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_v2(hipblasHandle_t han
                                                              const float*    s,
                                                              int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsrotStridedBatched_v2_64(hipblasHandle_t handle,
+                                                                int64_t         n,
+                                                                hipComplex*     x,
+                                                                int64_t         incx,
+                                                                hipblasStride   stridex,
+                                                                hipComplex*     y,
+                                                                int64_t         incy,
+                                                                hipblasStride   stridey,
+                                                                const float*    c,
+                                                                const float*    s,
+                                                                int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_v2(hipblasHandle_t         handle,
                                                             int                     n,
                                                             hipDoubleComplex*       x,
@@ -3058,6 +4660,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_v2(hipblasHandle_t
                                                             const hipDoubleComplex* s,
                                                             int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                               int64_t                 n,
+                                                               hipDoubleComplex*       x,
+                                                               int64_t                 incx,
+                                                               hipblasStride           stridex,
+                                                               hipDoubleComplex*       y,
+                                                               int64_t                 incy,
+                                                               hipblasStride           stridey,
+                                                               const double*           c,
+                                                               const hipDoubleComplex* s,
+                                                               int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              hipDoubleComplex* x,
@@ -3069,6 +4683,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_v2(hipblasHandle_t   h
                                                              const double*     c,
                                                              const double*     s,
                                                              int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdrotStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                hipDoubleComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                hipDoubleComplex* y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                const double*     c,
+                                                                const double*     s,
+                                                                int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -3158,6 +4784,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgBatched(hipblasHandle_t handle,
                                                    float* const    s[],
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgBatched_64(hipblasHandle_t handle,
+                                                      float* const    a[],
+                                                      float* const    b[],
+                                                      float* const    c[],
+                                                      float* const    s[],
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                                    double* const   a[],
                                                    double* const   b[],
@@ -3165,6 +4798,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched(hipblasHandle_t handle,
                                                    double* const   s[],
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgBatched_64(hipblasHandle_t handle,
+                                                      double* const   a[],
+                                                      double* const   b[],
+                                                      double* const   c[],
+                                                      double* const   s[],
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                                    hipblasComplex* const a[],
                                                    hipblasComplex* const b[],
@@ -3172,6 +4812,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched(hipblasHandle_t       handle,
                                                    hipblasComplex* const s[],
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched_64(hipblasHandle_t       handle,
+                                                      hipblasComplex* const a[],
+                                                      hipblasComplex* const b[],
+                                                      float* const          c[],
+                                                      hipblasComplex* const s[],
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             handle,
                                                    hipblasDoubleComplex* const a[],
                                                    hipblasDoubleComplex* const b[],
@@ -3179,6 +4826,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched(hipblasHandle_t             h
                                                    hipblasDoubleComplex* const s[],
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched_64(hipblasHandle_t             handle,
+                                                      hipblasDoubleComplex* const a[],
+                                                      hipblasDoubleComplex* const b[],
+                                                      double* const               c[],
+                                                      hipblasDoubleComplex* const s[],
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched_v2(hipblasHandle_t   handle,
                                                       hipComplex* const a[],
                                                       hipComplex* const b[],
@@ -3186,12 +4840,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched_v2(hipblasHandle_t   handle,
                                                       hipComplex* const s[],
                                                       int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgBatched_v2_64(hipblasHandle_t   handle,
+                                                         hipComplex* const a[],
+                                                         hipComplex* const b[],
+                                                         float* const      c[],
+                                                         hipComplex* const s[],
+                                                         int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched_v2(hipblasHandle_t         handle,
                                                       hipDoubleComplex* const a[],
                                                       hipDoubleComplex* const b[],
                                                       double* const           c[],
                                                       hipDoubleComplex* const s[],
                                                       int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgBatched_v2_64(hipblasHandle_t         handle,
+                                                         hipDoubleComplex* const a[],
+                                                         hipDoubleComplex* const b[],
+                                                         double* const           c[],
+                                                         hipDoubleComplex* const s[],
+                                                         int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -3246,6 +4914,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             float*          a,
+                                                             hipblasStride   stridea,
+                                                             float*          b,
+                                                             hipblasStride   strideb,
+                                                             float*          c,
+                                                             hipblasStride   stridec,
+                                                             float*          s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle,
                                                           double*         a,
                                                           hipblasStride   stridea,
@@ -3257,6 +4936,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             double*         a,
+                                                             hipblasStride   stridea,
+                                                             double*         b,
+                                                             hipblasStride   strideb,
+                                                             double*         c,
+                                                             hipblasStride   stridec,
+                                                             double*         s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle,
                                                           hipblasComplex* a,
                                                           hipblasStride   stridea,
@@ -3268,6 +4958,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strides,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched_64(hipblasHandle_t handle,
+                                                             hipblasComplex* a,
+                                                             hipblasStride   stridea,
+                                                             hipblasComplex* b,
+                                                             hipblasStride   strideb,
+                                                             float*          c,
+                                                             hipblasStride   stridec,
+                                                             hipblasComplex* s,
+                                                             hipblasStride   strides,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t       handle,
                                                           hipblasDoubleComplex* a,
                                                           hipblasStride         stridea,
@@ -3279,6 +4980,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched(hipblasHandle_t
                                                           hipblasStride         strides,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasDoubleComplex* a,
+                                                             hipblasStride         stridea,
+                                                             hipblasDoubleComplex* b,
+                                                             hipblasStride         strideb,
+                                                             double*               c,
+                                                             hipblasStride         stridec,
+                                                             hipblasDoubleComplex* s,
+                                                             hipblasStride         strides,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched_v2(hipblasHandle_t handle,
                                                              hipComplex*     a,
                                                              hipblasStride   stridea,
@@ -3290,6 +5002,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched_v2(hipblasHandle_t han
                                                              hipblasStride   strides,
                                                              int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCrotgStridedBatched_v2_64(hipblasHandle_t handle,
+                                                                hipComplex*     a,
+                                                                hipblasStride   stridea,
+                                                                hipComplex*     b,
+                                                                hipblasStride   strideb,
+                                                                float*          c,
+                                                                hipblasStride   stridec,
+                                                                hipComplex*     s,
+                                                                hipblasStride   strides,
+                                                                int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_v2(hipblasHandle_t   handle,
                                                              hipDoubleComplex* a,
                                                              hipblasStride     stridea,
@@ -3300,6 +5023,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_v2(hipblasHandle_t   h
                                                              hipDoubleComplex* s,
                                                              hipblasStride     strides,
                                                              int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                hipDoubleComplex* a,
+                                                                hipblasStride     stridea,
+                                                                hipDoubleComplex* b,
+                                                                hipblasStride     strideb,
+                                                                double*           c,
+                                                                hipblasStride     stridec,
+                                                                hipDoubleComplex* s,
+                                                                hipblasStride     strides,
+                                                                int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -3346,8 +5080,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZrotgStridedBatched_v2(hipblasHandle_t   h
 HIPBLAS_EXPORT hipblasStatus_t hipblasSrotm(
     hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy, const float* param);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotm_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               float*          x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy,
+                                               const float*    param);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotm(
     hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy, const double* param);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotm_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               double*         x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy,
+                                               const double*   param);
 //! @}
 
 /*! @{
@@ -3403,6 +5153,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmBatched(hipblasHandle_t    handle,
                                                    const float* const param[],
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmBatched_64(hipblasHandle_t    handle,
+                                                      int64_t            n,
+                                                      float* const       x[],
+                                                      int64_t            incx,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      const float* const param[],
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                                    int                 n,
                                                    double* const       x[],
@@ -3411,6 +5170,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    const double* const param[],
                                                    int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmBatched_64(hipblasHandle_t     handle,
+                                                      int64_t             n,
+                                                      double* const       x[],
+                                                      int64_t             incx,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      const double* const param[],
+                                                      int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -3478,6 +5246,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   strideParam,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const float*    param,
+                                                             hipblasStride   strideParam,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           double*         x,
@@ -3489,6 +5269,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched(hipblasHandle_t handle
                                                           const double*   param,
                                                           hipblasStride   strideParam,
                                                           int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             const double*   param,
+                                                             hipblasStride   strideParam,
+                                                             int64_t         batchCount);
 //! @}
 
 /*! @{
@@ -3587,6 +5379,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgBatched(hipblasHandle_t    handle,
                                                     float* const       param[],
                                                     int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgBatched_64(hipblasHandle_t    handle,
+                                                       float* const       d1[],
+                                                       float* const       d2[],
+                                                       float* const       x1[],
+                                                       const float* const y1[],
+                                                       float* const       param[],
+                                                       int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                                     double* const       d1[],
                                                     double* const       d2[],
@@ -3594,6 +5394,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched(hipblasHandle_t     handle,
                                                     const double* const y1[],
                                                     double* const       param[],
                                                     int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgBatched_64(hipblasHandle_t     handle,
+                                                       double* const       d1[],
+                                                       double* const       d2[],
+                                                       double* const       x1[],
+                                                       const double* const y1[],
+                                                       double* const       param[],
+                                                       int64_t             batchCount);
 //! @}
 
 /*! @{
@@ -3666,6 +5474,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgStridedBatched(hipblasHandle_t handl
                                                            hipblasStride   strideParam,
                                                            int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSrotmgStridedBatched_64(hipblasHandle_t handle,
+                                                              float*          d1,
+                                                              hipblasStride   strided1,
+                                                              float*          d2,
+                                                              hipblasStride   strided2,
+                                                              float*          x1,
+                                                              hipblasStride   stridex1,
+                                                              const float*    y1,
+                                                              hipblasStride   stridey1,
+                                                              float*          param,
+                                                              hipblasStride   strideParam,
+                                                              int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handle,
                                                            double*         d1,
                                                            hipblasStride   strided1,
@@ -3678,6 +5499,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handl
                                                            double*         param,
                                                            hipblasStride   strideParam,
                                                            int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched_64(hipblasHandle_t handle,
+                                                              double*         d1,
+                                                              hipblasStride   strided1,
+                                                              double*         d2,
+                                                              hipblasStride   strided2,
+                                                              double*         x1,
+                                                              hipblasStride   stridex1,
+                                                              const double*   y1,
+                                                              hipblasStride   stridey1,
+                                                              double*         param,
+                                                              hipblasStride   strideParam,
+                                                              int64_t         batchCount);
 //! @}
 
 /*! @{
@@ -3710,35 +5544,74 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDrotmgStridedBatched(hipblasHandle_t handl
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSscal(hipblasHandle_t handle, int n, const float* alpha, float* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDscal(hipblasHandle_t handle, int n, const double* alpha, double* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscal(
     hipblasHandle_t handle, int n, const hipblasComplex* alpha, hipblasComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasCsscal(hipblasHandle_t handle, int n, const float* alpha, hipblasComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
                                             int                         n,
                                             const hipblasDoubleComplex* alpha,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_v2(
     hipblasHandle_t handle, int n, const hipComplex* alpha, hipComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* alpha, hipComplex* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasCsscal_v2(hipblasHandle_t handle, int n, const float* alpha, hipComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipComplex* x, int64_t incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_v2(
     hipblasHandle_t handle, int n, const hipDoubleComplex* alpha, hipDoubleComplex* x, int incx);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_v2_64(hipblasHandle_t         handle,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* alpha,
+                                                  hipDoubleComplex*       x,
+                                                  int64_t                 incx);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_v2(
     hipblasHandle_t handle, int n, const double* alpha, hipDoubleComplex* x, int incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_v2_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipDoubleComplex* x, int64_t incx);
 //! @}
 
 /*! @{
@@ -3774,6 +5647,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_v2(
 HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const float*    alpha,
+                                                      float* const    x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched(hipblasHandle_t handle,
                                                    int             n,
                                                    const double*   alpha,
@@ -3781,6 +5661,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched(hipblasHandle_t handle,
                                                    int             incx,
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      const double*   alpha,
+                                                      double* const   x[],
+                                                      int64_t         incx,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    const hipblasComplex* alpha,
@@ -3788,6 +5675,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched(hipblasHandle_t       handle,
                                                    int                   incx,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      const hipblasComplex* alpha,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    const hipblasDoubleComplex* alpha,
@@ -3795,6 +5689,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched(hipblasHandle_t             h
                                                    int                         incx,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle,
                                                     int                   n,
                                                     const float*          alpha,
@@ -3802,6 +5703,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched(hipblasHandle_t       handle
                                                     int                   incx,
                                                     int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_64(hipblasHandle_t       handle,
+                                                       int64_t               n,
+                                                       const float*          alpha,
+                                                       hipblasComplex* const x[],
+                                                       int64_t               incx,
+                                                       int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t             handle,
                                                     int                         n,
                                                     const double*               alpha,
@@ -3809,6 +5717,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched(hipblasHandle_t
                                                     int                         incx,
                                                     int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched_64(hipblasHandle_t             handle,
+                                                       int64_t                     n,
+                                                       const double*               alpha,
+                                                       hipblasDoubleComplex* const x[],
+                                                       int64_t                     incx,
+                                                       int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_v2(hipblasHandle_t   handle,
                                                       int               n,
                                                       const hipComplex* alpha,
@@ -3816,6 +5731,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_v2(hipblasHandle_t   handle,
                                                       int               incx,
                                                       int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalBatched_v2_64(hipblasHandle_t   handle,
+                                                         int64_t           n,
+                                                         const hipComplex* alpha,
+                                                         hipComplex* const x[],
+                                                         int64_t           incx,
+                                                         int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       const hipDoubleComplex* alpha,
@@ -3823,6 +5745,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_v2(hipblasHandle_t         ha
                                                       int                     incx,
                                                       int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         const hipDoubleComplex* alpha,
+                                                         hipDoubleComplex* const x[],
+                                                         int64_t                 incx,
+                                                         int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_v2(hipblasHandle_t   handle,
                                                        int               n,
                                                        const float*      alpha,
@@ -3830,12 +5759,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_v2(hipblasHandle_t   handle,
                                                        int               incx,
                                                        int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalBatched_v2_64(hipblasHandle_t   handle,
+                                                          int64_t           n,
+                                                          const float*      alpha,
+                                                          hipComplex* const x[],
+                                                          int64_t           incx,
+                                                          int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched_v2(hipblasHandle_t         handle,
                                                        int                     n,
                                                        const double*           alpha,
                                                        hipDoubleComplex* const x[],
                                                        int                     incx,
                                                        int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalBatched_v2_64(hipblasHandle_t         handle,
+                                                          int64_t                 n,
+                                                          const double*           alpha,
+                                                          hipDoubleComplex* const x[],
+                                                          int64_t                 incx,
+                                                          int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -3881,6 +5824,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridex,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const float*    alpha,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           const double*   alpha,
@@ -3889,6 +5840,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridex,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscalStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             const double*   alpha,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           const hipblasComplex* alpha,
@@ -3897,6 +5856,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridex,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             hipblasComplex*       x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t             handle,
                                                           int                         n,
                                                           const hipblasDoubleComplex* alpha,
@@ -3905,6 +5872,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridex,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZscalStridedBatched_64(hipblasHandle_t             handle,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  hipblasDoubleComplex*       x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handle,
                                                            int             n,
                                                            const float*    alpha,
@@ -3913,6 +5889,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched(hipblasHandle_t handl
                                                            hipblasStride   stridex,
                                                            int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_64(hipblasHandle_t handle,
+                                                              int64_t         n,
+                                                              const float*    alpha,
+                                                              hipblasComplex* x,
+                                                              int64_t         incx,
+                                                              hipblasStride   stridex,
+                                                              int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t       handle,
                                                            int                   n,
                                                            const double*         alpha,
@@ -3921,6 +5905,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched(hipblasHandle_t
                                                            hipblasStride         stridex,
                                                            int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_64(hipblasHandle_t       handle,
+                                                              int64_t               n,
+                                                              const double*         alpha,
+                                                              hipblasDoubleComplex* x,
+                                                              int64_t               incx,
+                                                              hipblasStride         stridex,
+                                                              int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              const hipComplex* alpha,
@@ -3929,6 +5921,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_v2(hipblasHandle_t   h
                                                              hipblasStride     stridex,
                                                              int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                const hipComplex* alpha,
+                                                                hipComplex*       x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched_v2(hipblasHandle_t         handle,
                                                              int                     n,
                                                              const hipDoubleComplex* alpha,
@@ -3937,6 +5937,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched_v2(hipblasHandle_t
                                                              hipblasStride           stridex,
                                                              int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscalStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* alpha,
+                                                                hipDoubleComplex*       x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_v2(hipblasHandle_t handle,
                                                               int             n,
                                                               const float*    alpha,
@@ -3945,6 +5953,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_v2(hipblasHandle_t ha
                                                               hipblasStride   stridex,
                                                               int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscalStridedBatched_v2_64(hipblasHandle_t handle,
+                                                                 int64_t         n,
+                                                                 const float*    alpha,
+                                                                 hipComplex*     x,
+                                                                 int64_t         incx,
+                                                                 hipblasStride   stridex,
+                                                                 int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_v2(hipblasHandle_t   handle,
                                                               int               n,
                                                               const double*     alpha,
@@ -3952,6 +5968,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_v2(hipblasHandle_t
                                                               int               incx,
                                                               hipblasStride     stridex,
                                                               int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                 int64_t           n,
+                                                                 const double*     alpha,
+                                                                 hipDoubleComplex* x,
+                                                                 int64_t           incx,
+                                                                 hipblasStride     stridex,
+                                                                 int64_t           batchCount);
 //! @}
 
 /*! @{
@@ -3987,12 +6011,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdscalStridedBatched_v2(hipblasHandle_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSswap(hipblasHandle_t handle, int n, float* x, int incx, float* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasDswap(hipblasHandle_t handle, int n, double* x, int incx, double* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswap(
     hipblasHandle_t handle, int n, hipblasComplex* x, int incx, hipblasComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                                             int                   n,
                                             hipblasDoubleComplex* x,
@@ -4000,11 +6037,28 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                                             hipblasDoubleComplex* y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_v2(
     hipblasHandle_t handle, int n, hipComplex* x, int incx, hipComplex* y, int incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_v2_64(
+    hipblasHandle_t handle, int64_t n, hipComplex* x, int64_t incx, hipComplex* y, int64_t incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_v2(
     hipblasHandle_t handle, int n, hipDoubleComplex* x, int incx, hipDoubleComplex* y, int incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_v2_64(hipblasHandle_t   handle,
+                                                  int64_t           n,
+                                                  hipDoubleComplex* x,
+                                                  int64_t           incx,
+                                                  hipDoubleComplex* y,
+                                                  int64_t           incy);
 //! @}
 
 /*! @{
@@ -4048,6 +6102,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched(hipblasHandle_t handle,
                                                    int             incy,
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      float* const    x[],
+                                                      int64_t         incx,
+                                                      float* const    y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched(hipblasHandle_t handle,
                                                    int             n,
                                                    double* const   x[],
@@ -4056,6 +6118,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched(hipblasHandle_t handle,
                                                    int             incy,
                                                    int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapBatched_64(hipblasHandle_t handle,
+                                                      int64_t         n,
+                                                      double* const   x[],
+                                                      int64_t         incx,
+                                                      double* const   y[],
+                                                      int64_t         incy,
+                                                      int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched(hipblasHandle_t       handle,
                                                    int                   n,
                                                    hipblasComplex* const x[],
@@ -4064,6 +6134,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched(hipblasHandle_t       handle,
                                                    int                   incy,
                                                    int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_64(hipblasHandle_t       handle,
+                                                      int64_t               n,
+                                                      hipblasComplex* const x[],
+                                                      int64_t               incx,
+                                                      hipblasComplex* const y[],
+                                                      int64_t               incy,
+                                                      int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched(hipblasHandle_t             handle,
                                                    int                         n,
                                                    hipblasDoubleComplex* const x[],
@@ -4072,6 +6150,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_64(hipblasHandle_t             handle,
+                                                      int64_t                     n,
+                                                      hipblasDoubleComplex* const x[],
+                                                      int64_t                     incx,
+                                                      hipblasDoubleComplex* const y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_v2(hipblasHandle_t   handle,
                                                       int               n,
                                                       hipComplex* const x[],
@@ -4080,6 +6166,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_v2(hipblasHandle_t   handle,
                                                       int               incy,
                                                       int               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapBatched_v2_64(hipblasHandle_t   handle,
+                                                         int64_t           n,
+                                                         hipComplex* const x[],
+                                                         int64_t           incx,
+                                                         hipComplex* const y[],
+                                                         int64_t           incy,
+                                                         int64_t           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_v2(hipblasHandle_t         handle,
                                                       int                     n,
                                                       hipDoubleComplex* const x[],
@@ -4087,6 +6181,14 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_v2(hipblasHandle_t         ha
                                                       hipDoubleComplex* const y[],
                                                       int                     incy,
                                                       int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapBatched_v2_64(hipblasHandle_t         handle,
+                                                         int64_t                 n,
+                                                         hipDoubleComplex* const x[],
+                                                         int64_t                 incx,
+                                                         hipDoubleComplex* const y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -4144,6 +6246,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             float*          x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             float*          y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           double*         x,
@@ -4154,6 +6266,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             double*         x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             double*         y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle,
                                                           int             n,
                                                           hipblasComplex* x,
@@ -4164,6 +6286,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched(hipblasHandle_t handle
                                                           hipblasStride   stridey,
                                                           int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_64(hipblasHandle_t handle,
+                                                             int64_t         n,
+                                                             hipblasComplex* x,
+                                                             int64_t         incx,
+                                                             hipblasStride   stridex,
+                                                             hipblasComplex* y,
+                                                             int64_t         incy,
+                                                             hipblasStride   stridey,
+                                                             int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t       handle,
                                                           int                   n,
                                                           hipblasDoubleComplex* x,
@@ -4174,6 +6306,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_64(hipblasHandle_t       handle,
+                                                             int64_t               n,
+                                                             hipblasDoubleComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             hipblasDoubleComplex* y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_v2(hipblasHandle_t handle,
                                                              int             n,
                                                              hipComplex*     x,
@@ -4184,6 +6326,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_v2(hipblasHandle_t han
                                                              hipblasStride   stridey,
                                                              int             batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswapStridedBatched_v2_64(hipblasHandle_t handle,
+                                                                int64_t         n,
+                                                                hipComplex*     x,
+                                                                int64_t         incx,
+                                                                hipblasStride   stridex,
+                                                                hipComplex*     y,
+                                                                int64_t         incy,
+                                                                hipblasStride   stridey,
+                                                                int64_t         batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_v2(hipblasHandle_t   handle,
                                                              int               n,
                                                              hipDoubleComplex* x,
@@ -4193,6 +6345,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_v2(hipblasHandle_t   h
                                                              int               incy,
                                                              hipblasStride     stridey,
                                                              int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswapStridedBatched_v2_64(hipblasHandle_t   handle,
+                                                                int64_t           n,
+                                                                hipDoubleComplex* x,
+                                                                int64_t           incx,
+                                                                hipblasStride     stridex,
+                                                                hipDoubleComplex* y,
+                                                                int64_t           incy,
+                                                                hipblasStride     stridey,
+                                                                int64_t           batchCount);
 //! @}
 
 /*
@@ -4799,6 +6961,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv(hipblasHandle_t    handle,
                                             float*             y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       x,
+                                               int64_t            incx,
+                                               const float*       beta,
+                                               float*             y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                                             hipblasOperation_t trans,
                                             int                m,
@@ -4812,6 +6987,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv(hipblasHandle_t    handle,
                                             double*            y,
                                             int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemv_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      x,
+                                               int64_t            incx,
+                                               const double*      beta,
+                                               double*            y,
+                                               int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                                             hipblasOperation_t    trans,
                                             int                   m,
@@ -4825,6 +7013,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv(hipblasHandle_t       handle,
                                             hipblasComplex*       y,
                                             int                   incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    trans,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                                             hipblasOperation_t          trans,
                                             int                         m,
@@ -4838,6 +7039,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          trans,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_v2(hipblasHandle_t    handle,
                                                hipblasOperation_t trans,
                                                int                m,
@@ -4851,6 +7065,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_v2(hipblasHandle_t    handle,
                                                hipComplex*        y,
                                                int                incy);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemv_v2_64(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans,
+                                                  int64_t            m,
+                                                  int64_t            n,
+                                                  const hipComplex*  alpha,
+                                                  const hipComplex*  AP,
+                                                  int64_t            lda,
+                                                  const hipComplex*  x,
+                                                  int64_t            incx,
+                                                  const hipComplex*  beta,
+                                                  hipComplex*        y,
+                                                  int64_t            incy);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_v2(hipblasHandle_t         handle,
                                                hipblasOperation_t      trans,
                                                int                     m,
@@ -4863,6 +7090,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_v2(hipblasHandle_t         handle,
                                                const hipDoubleComplex* beta,
                                                hipDoubleComplex*       y,
                                                int                     incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemv_v2_64(hipblasHandle_t         handle,
+                                                  hipblasOperation_t      trans,
+                                                  int64_t                 m,
+                                                  int64_t                 n,
+                                                  const hipDoubleComplex* alpha,
+                                                  const hipDoubleComplex* AP,
+                                                  int64_t                 lda,
+                                                  const hipDoubleComplex* x,
+                                                  int64_t                 incx,
+                                                  const hipDoubleComplex* beta,
+                                                  hipDoubleComplex*       y,
+                                                  int64_t                 incy);
 //! @}
 
 /*! @{
@@ -4933,6 +7173,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched(hipblasHandle_t    handle,
                                                    int                incy,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const x[],
+                                                      int64_t            incx,
+                                                      const float*       beta,
+                                                      float* const       y[],
+                                                      int64_t            incy,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  trans,
                                                    int                 m,
@@ -4947,6 +7201,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched(hipblasHandle_t     handle,
                                                    int                 incy,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  trans,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const x[],
+                                                      int64_t             incx,
+                                                      const double*       beta,
+                                                      double* const       y[],
+                                                      int64_t             incy,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          trans,
                                                    int                         m,
@@ -4961,6 +7229,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched(hipblasHandle_t             h
                                                    int                         incy,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          trans,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const x[],
+                                                      int64_t                     incx,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       y[],
+                                                      int64_t                     incy,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                trans,
                                                    int                               m,
@@ -4975,6 +7257,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched(hipblasHandle_t
                                                    int                               incy,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                trans,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int64_t                           incx,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       y[],
+                                                      int64_t                           incy,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_v2(hipblasHandle_t         handle,
                                                       hipblasOperation_t      trans,
                                                       int                     m,
@@ -4989,6 +7285,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_v2(hipblasHandle_t         ha
                                                       int                     incy,
                                                       int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvBatched_v2_64(hipblasHandle_t         handle,
+                                                         hipblasOperation_t      trans,
+                                                         int64_t                 m,
+                                                         int64_t                 n,
+                                                         const hipComplex*       alpha,
+                                                         const hipComplex* const AP[],
+                                                         int64_t                 lda,
+                                                         const hipComplex* const x[],
+                                                         int64_t                 incx,
+                                                         const hipComplex*       beta,
+                                                         hipComplex* const       y[],
+                                                         int64_t                 incy,
+                                                         int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_v2(hipblasHandle_t               handle,
                                                       hipblasOperation_t            trans,
                                                       int                           m,
@@ -5002,6 +7312,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_v2(hipblasHandle_t
                                                       hipDoubleComplex* const       y[],
                                                       int                           incy,
                                                       int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvBatched_v2_64(hipblasHandle_t               handle,
+                                                         hipblasOperation_t            trans,
+                                                         int64_t                       m,
+                                                         int64_t                       n,
+                                                         const hipDoubleComplex*       alpha,
+                                                         const hipDoubleComplex* const AP[],
+                                                         int64_t                       lda,
+                                                         const hipDoubleComplex* const x[],
+                                                         int64_t                       incx,
+                                                         const hipDoubleComplex*       beta,
+                                                         hipDoubleComplex* const       y[],
+                                                         int64_t                       incy,
+                                                         int64_t                       batchCount);
 //! @}
 
 /*! @{
@@ -5090,6 +7414,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const float*       x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const float*       beta,
+                                                             float*             y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           int                m,
@@ -5107,6 +7448,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched(hipblasHandle_t    han
                                                           hipblasStride      stridey,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             hipblasStride      strideA,
+                                                             const double*      x,
+                                                             int64_t            incx,
+                                                             hipblasStride      stridex,
+                                                             const double*      beta,
+                                                             double*            y,
+                                                             int64_t            incy,
+                                                             hipblasStride      stridey,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
                                                           int                   m,
@@ -5124,6 +7482,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched(hipblasHandle_t
                                                           hipblasStride         stridey,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             hipblasStride         strideA,
+                                                             const hipblasComplex* x,
+                                                             int64_t               incx,
+                                                             hipblasStride         stridex,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       y,
+                                                             int64_t               incy,
+                                                             hipblasStride         stridey,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          transA,
                                                           int                         m,
@@ -5141,6 +7516,24 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched(hipblasHandle_t
                                                           hipblasStride               stridey,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemvStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  hipblasStride               strideA,
+                                  const hipblasDoubleComplex* x,
+                                  int64_t                     incx,
+                                  hipblasStride               stridex,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       y,
+                                  int64_t                     incy,
+                                  hipblasStride               stridey,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_v2(hipblasHandle_t    handle,
                                                              hipblasOperation_t transA,
                                                              int                m,
@@ -5158,6 +7551,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_v2(hipblasHandle_t
                                                              hipblasStride      stridey,
                                                              int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvStridedBatched_v2_64(hipblasHandle_t    handle,
+                                                                hipblasOperation_t transA,
+                                                                int64_t            m,
+                                                                int64_t            n,
+                                                                const hipComplex*  alpha,
+                                                                const hipComplex*  AP,
+                                                                int64_t            lda,
+                                                                hipblasStride      strideA,
+                                                                const hipComplex*  x,
+                                                                int64_t            incx,
+                                                                hipblasStride      stridex,
+                                                                const hipComplex*  beta,
+                                                                hipComplex*        y,
+                                                                int64_t            incy,
+                                                                hipblasStride      stridey,
+                                                                int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched_v2(hipblasHandle_t         handle,
                                                              hipblasOperation_t      transA,
                                                              int                     m,
@@ -5174,6 +7584,23 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched_v2(hipblasHandle_t
                                                              int                     incy,
                                                              hipblasStride           stridey,
                                                              int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                hipblasOperation_t      transA,
+                                                                int64_t                 m,
+                                                                int64_t                 n,
+                                                                const hipDoubleComplex* alpha,
+                                                                const hipDoubleComplex* AP,
+                                                                int64_t                 lda,
+                                                                hipblasStride           strideA,
+                                                                const hipDoubleComplex* x,
+                                                                int64_t                 incx,
+                                                                hipblasStride           stridex,
+                                                                const hipDoubleComplex* beta,
+                                                                hipDoubleComplex*       y,
+                                                                int64_t                 incy,
+                                                                hipblasStride           stridey,
+                                                                int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -12939,6 +15366,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
                                             hipblasHalf*       CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const hipblasHalf* alpha,
+                                               const hipblasHalf* AP,
+                                               int64_t            lda,
+                                               const hipblasHalf* BP,
+                                               int64_t            ldb,
+                                               const hipblasHalf* beta,
+                                               hipblasHalf*       CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                                             hipblasOperation_t transA,
                                             hipblasOperation_t transB,
@@ -12954,6 +15396,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
                                             float*             CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const float*       alpha,
+                                               const float*       AP,
+                                               int64_t            lda,
+                                               const float*       BP,
+                                               int64_t            ldb,
+                                               const float*       beta,
+                                               float*             CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                                             hipblasOperation_t transA,
                                             hipblasOperation_t transB,
@@ -12969,6 +15426,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
                                             double*            CP,
                                             int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm_64(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int64_t            m,
+                                               int64_t            n,
+                                               int64_t            k,
+                                               const double*      alpha,
+                                               const double*      AP,
+                                               int64_t            lda,
+                                               const double*      BP,
+                                               int64_t            ldb,
+                                               const double*      beta,
+                                               double*            CP,
+                                               int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                                             hipblasOperation_t    transA,
                                             hipblasOperation_t    transB,
@@ -12984,6 +15456,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
                                             hipblasComplex*       CP,
                                             int                   ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_64(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transA,
+                                               hipblasOperation_t    transB,
+                                               int64_t               m,
+                                               int64_t               n,
+                                               int64_t               k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* AP,
+                                               int64_t               lda,
+                                               const hipblasComplex* BP,
+                                               int64_t               ldb,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       CP,
+                                               int64_t               ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             hipblasOperation_t          transA,
                                             hipblasOperation_t          transB,
@@ -12999,6 +15486,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       CP,
                                             int                         ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_64(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transA,
+                                               hipblasOperation_t          transB,
+                                               int64_t                     m,
+                                               int64_t                     n,
+                                               int64_t                     k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* AP,
+                                               int64_t                     lda,
+                                               const hipblasDoubleComplex* BP,
+                                               int64_t                     ldb,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       CP,
+                                               int64_t                     ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_v2(hipblasHandle_t    handle,
                                                hipblasOperation_t transA,
                                                hipblasOperation_t transB,
@@ -13014,6 +15516,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_v2(hipblasHandle_t    handle,
                                                hipComplex*        CP,
                                                int                ldc);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm_v2_64(hipblasHandle_t    handle,
+                                                  hipblasOperation_t transA,
+                                                  hipblasOperation_t transB,
+                                                  int64_t            m,
+                                                  int64_t            n,
+                                                  int64_t            k,
+                                                  const hipComplex*  alpha,
+                                                  const hipComplex*  AP,
+                                                  int64_t            lda,
+                                                  const hipComplex*  BP,
+                                                  int64_t            ldb,
+                                                  const hipComplex*  beta,
+                                                  hipComplex*        CP,
+                                                  int64_t            ldc);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_v2(hipblasHandle_t         handle,
                                                hipblasOperation_t      transA,
                                                hipblasOperation_t      transB,
@@ -13028,6 +15545,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_v2(hipblasHandle_t         handle,
                                                const hipDoubleComplex* beta,
                                                hipDoubleComplex*       CP,
                                                int                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm_v2_64(hipblasHandle_t         handle,
+                                                  hipblasOperation_t      transA,
+                                                  hipblasOperation_t      transB,
+                                                  int64_t                 m,
+                                                  int64_t                 n,
+                                                  int64_t                 k,
+                                                  const hipDoubleComplex* alpha,
+                                                  const hipDoubleComplex* AP,
+                                                  int64_t                 lda,
+                                                  const hipDoubleComplex* BP,
+                                                  int64_t                 ldb,
+                                                  const hipDoubleComplex* beta,
+                                                  hipDoubleComplex*       CP,
+                                                  int64_t                 ldc);
 //! @}
 
 /*! @{
@@ -13106,6 +15638,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          hand
                                                    int                      ldc,
                                                    int                      batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched_64(hipblasHandle_t          handle,
+                                                      hipblasOperation_t       transA,
+                                                      hipblasOperation_t       transB,
+                                                      int64_t                  m,
+                                                      int64_t                  n,
+                                                      int64_t                  k,
+                                                      const hipblasHalf*       alpha,
+                                                      const hipblasHalf* const AP[],
+                                                      int64_t                  lda,
+                                                      const hipblasHalf* const BP[],
+                                                      int64_t                  ldb,
+                                                      const hipblasHalf*       beta,
+                                                      hipblasHalf* const       CP[],
+                                                      int64_t                  ldc,
+                                                      int64_t                  batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                                    hipblasOperation_t transA,
                                                    hipblasOperation_t transB,
@@ -13122,6 +15670,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
                                                    int                ldc,
                                                    int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched_64(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int64_t            m,
+                                                      int64_t            n,
+                                                      int64_t            k,
+                                                      const float*       alpha,
+                                                      const float* const AP[],
+                                                      int64_t            lda,
+                                                      const float* const BP[],
+                                                      int64_t            ldb,
+                                                      const float*       beta,
+                                                      float* const       CP[],
+                                                      int64_t            ldc,
+                                                      int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                                    hipblasOperation_t  transA,
                                                    hipblasOperation_t  transB,
@@ -13138,6 +15702,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
                                                    int                 ldc,
                                                    int                 batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched_64(hipblasHandle_t     handle,
+                                                      hipblasOperation_t  transA,
+                                                      hipblasOperation_t  transB,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      const double*       alpha,
+                                                      const double* const AP[],
+                                                      int64_t             lda,
+                                                      const double* const BP[],
+                                                      int64_t             ldb,
+                                                      const double*       beta,
+                                                      double* const       CP[],
+                                                      int64_t             ldc,
+                                                      int64_t             batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
                                                    hipblasOperation_t          transA,
                                                    hipblasOperation_t          transB,
@@ -13154,6 +15734,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             h
                                                    int                         ldc,
                                                    int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_64(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int64_t                     m,
+                                                      int64_t                     n,
+                                                      int64_t                     k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const AP[],
+                                                      int64_t                     lda,
+                                                      const hipblasComplex* const BP[],
+                                                      int64_t                     ldb,
+                                                      const hipblasComplex*       beta,
+                                                      hipblasComplex* const       CP[],
+                                                      int64_t                     ldc,
+                                                      int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
                                                    hipblasOperation_t                transA,
                                                    hipblasOperation_t                transB,
@@ -13170,6 +15766,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t
                                                    int                               ldc,
                                                    int                               batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_64(hipblasHandle_t                   handle,
+                                                      hipblasOperation_t                transA,
+                                                      hipblasOperation_t                transB,
+                                                      int64_t                           m,
+                                                      int64_t                           n,
+                                                      int64_t                           k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const AP[],
+                                                      int64_t                           lda,
+                                                      const hipblasDoubleComplex* const BP[],
+                                                      int64_t                           ldb,
+                                                      const hipblasDoubleComplex*       beta,
+                                                      hipblasDoubleComplex* const       CP[],
+                                                      int64_t                           ldc,
+                                                      int64_t                           batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_v2(hipblasHandle_t         handle,
                                                       hipblasOperation_t      transA,
                                                       hipblasOperation_t      transB,
@@ -13186,6 +15798,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_v2(hipblasHandle_t         ha
                                                       int                     ldc,
                                                       int                     batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched_v2_64(hipblasHandle_t         handle,
+                                                         hipblasOperation_t      transA,
+                                                         hipblasOperation_t      transB,
+                                                         int64_t                 m,
+                                                         int64_t                 n,
+                                                         int64_t                 k,
+                                                         const hipComplex*       alpha,
+                                                         const hipComplex* const AP[],
+                                                         int64_t                 lda,
+                                                         const hipComplex* const BP[],
+                                                         int64_t                 ldb,
+                                                         const hipComplex*       beta,
+                                                         hipComplex* const       CP[],
+                                                         int64_t                 ldc,
+                                                         int64_t                 batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_v2(hipblasHandle_t               handle,
                                                       hipblasOperation_t            transA,
                                                       hipblasOperation_t            transB,
@@ -13201,6 +15829,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_v2(hipblasHandle_t
                                                       hipDoubleComplex* const       CP[],
                                                       int                           ldc,
                                                       int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched_v2_64(hipblasHandle_t               handle,
+                                                         hipblasOperation_t            transA,
+                                                         hipblasOperation_t            transB,
+                                                         int64_t                       m,
+                                                         int64_t                       n,
+                                                         int64_t                       k,
+                                                         const hipDoubleComplex*       alpha,
+                                                         const hipDoubleComplex* const AP[],
+                                                         int64_t                       lda,
+                                                         const hipDoubleComplex* const BP[],
+                                                         int64_t                       ldb,
+                                                         const hipDoubleComplex*       beta,
+                                                         hipDoubleComplex* const       CP[],
+                                                         int64_t                       ldc,
+                                                         int64_t                       batchCount);
 //! @}
 
 /*! @{
@@ -13297,6 +15941,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const hipblasHalf* alpha,
+                                                             const hipblasHalf* AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const hipblasHalf* BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const hipblasHalf* beta,
+                                                             hipblasHalf*       CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           hipblasOperation_t transB,
@@ -13316,6 +15979,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const float*       alpha,
+                                                             const float*       AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const float*       BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const float*       beta,
+                                                             float*             CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
                                                           hipblasOperation_t transA,
                                                           hipblasOperation_t transB,
@@ -13335,6 +16017,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    han
                                                           long long          strideC,
                                                           int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched_64(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int64_t            m,
+                                                             int64_t            n,
+                                                             int64_t            k,
+                                                             const double*      alpha,
+                                                             const double*      AP,
+                                                             int64_t            lda,
+                                                             long long          strideA,
+                                                             const double*      BP,
+                                                             int64_t            ldb,
+                                                             long long          strideB,
+                                                             const double*      beta,
+                                                             double*            CP,
+                                                             int64_t            ldc,
+                                                             long long          strideC,
+                                                             int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
                                                           hipblasOperation_t    transA,
                                                           hipblasOperation_t    transB,
@@ -13354,6 +16055,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t
                                                           long long             strideC,
                                                           int                   batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_64(hipblasHandle_t       handle,
+                                                             hipblasOperation_t    transA,
+                                                             hipblasOperation_t    transB,
+                                                             int64_t               m,
+                                                             int64_t               n,
+                                                             int64_t               k,
+                                                             const hipblasComplex* alpha,
+                                                             const hipblasComplex* AP,
+                                                             int64_t               lda,
+                                                             long long             strideA,
+                                                             const hipblasComplex* BP,
+                                                             int64_t               ldb,
+                                                             long long             strideB,
+                                                             const hipblasComplex* beta,
+                                                             hipblasComplex*       CP,
+                                                             int64_t               ldc,
+                                                             long long             strideC,
+                                                             int64_t               batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
                                                           hipblasOperation_t          transA,
                                                           hipblasOperation_t          transB,
@@ -13373,6 +16093,26 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t
                                                           long long                   strideC,
                                                           int                         batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmStridedBatched_64(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transA,
+                                  hipblasOperation_t          transB,
+                                  int64_t                     m,
+                                  int64_t                     n,
+                                  int64_t                     k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* AP,
+                                  int64_t                     lda,
+                                  long long                   strideA,
+                                  const hipblasDoubleComplex* BP,
+                                  int64_t                     ldb,
+                                  long long                   strideB,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       CP,
+                                  int64_t                     ldc,
+                                  long long                   strideC,
+                                  int64_t                     batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_v2(hipblasHandle_t    handle,
                                                              hipblasOperation_t transA,
                                                              hipblasOperation_t transB,
@@ -13392,6 +16132,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_v2(hipblasHandle_t
                                                              long long          strideC,
                                                              int                batchCount);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched_v2_64(hipblasHandle_t    handle,
+                                                                hipblasOperation_t transA,
+                                                                hipblasOperation_t transB,
+                                                                int64_t            m,
+                                                                int64_t            n,
+                                                                int64_t            k,
+                                                                const hipComplex*  alpha,
+                                                                const hipComplex*  AP,
+                                                                int64_t            lda,
+                                                                long long          strideA,
+                                                                const hipComplex*  BP,
+                                                                int64_t            ldb,
+                                                                long long          strideB,
+                                                                const hipComplex*  beta,
+                                                                hipComplex*        CP,
+                                                                int64_t            ldc,
+                                                                long long          strideC,
+                                                                int64_t            batchCount);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2(hipblasHandle_t         handle,
                                                              hipblasOperation_t      transA,
                                                              hipblasOperation_t      transB,
@@ -13410,6 +16169,25 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2(hipblasHandle_t
                                                              int                     ldc,
                                                              long long               strideC,
                                                              int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2_64(hipblasHandle_t         handle,
+                                                                hipblasOperation_t      transA,
+                                                                hipblasOperation_t      transB,
+                                                                int64_t                 m,
+                                                                int64_t                 n,
+                                                                int64_t                 k,
+                                                                const hipDoubleComplex* alpha,
+                                                                const hipDoubleComplex* AP,
+                                                                int64_t                 lda,
+                                                                long long               strideA,
+                                                                const hipDoubleComplex* BP,
+                                                                int64_t                 ldb,
+                                                                long long               strideB,
+                                                                const hipDoubleComplex* beta,
+                                                                hipDoubleComplex*       CP,
+                                                                int64_t                 ldc,
+                                                                long long               strideC,
+                                                                int64_t                 batchCount);
 //! @}
 
 /*! @{
@@ -19952,16 +22730,372 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfStridedBatched_v2(hipblasHandle_t
     \brief SOLVER API
 
     \details
-    getrs solves a system of n linear equations on n variables in its factorized form.
+    getrfRect computes the LU factorization of a general m-by-n matrix A
+    using partial pivoting with row interchanges. The LU factorization can
+    be done without pivoting if ipiv is passed as a nullptr.
 
-    It solves one of the following systems, depending on the value of trans:
+    In the case that ipiv is not null, the factorization has the form:
 
     \f[
-        \begin{array}{cl}
-        A X = B & \: \text{not transposed,}\\
-        A^T X = B & \: \text{transposed, or}\\
-        A^H X = B & \: \text{conjugate transposed.}
-        \end{array}
+        A = PLU
+    \f]
+
+    where P is a permutation matrix, L is lower triangular (lower trapezoidal if m > n) with unit
+    diagonal elements, and U is upper triangular (upper trapezoidal if m < n).
+
+    In the case that ipiv is null, the factorization is done without pivoting:
+
+    \f[
+        A = LU
+    \f]
+
+    For square matrices it is equivalent to \ref hipblasSgetrf "getrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (through cuSOLVER)
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of the matrix A.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrix A to be factored.
+              On exit, the factors L and U from the factorization.
+              The unit diagonal elements of L are not stored.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    ipiv      pointer to int. Array on the GPU of dimension min(m,n).\n
+              The vector of pivot indices. Elements of ipiv are 1-based indices.
+              For 1 <= i <= min(m,n), the row i of the
+              matrix was interchanged with row ipiv[i].
+              Matrix P of the factorization can be derived from ipiv.
+              The factorization here can be done without pivoting if ipiv is passed
+              in as a nullptr.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = j > 0, U is singular. U[j,j] is the first zero pivot.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRect(hipblasHandle_t handle,
+                                                 const int       m,
+                                                 const int       n,
+                                                 float*          A,
+                                                 const int       lda,
+                                                 int*            ipiv,
+                                                 int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRect(hipblasHandle_t handle,
+                                                 const int       m,
+                                                 const int       n,
+                                                 double*         A,
+                                                 const int       lda,
+                                                 int*            ipiv,
+                                                 int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRect(hipblasHandle_t handle,
+                                                 const int       m,
+                                                 const int       n,
+                                                 hipblasComplex* A,
+                                                 const int       lda,
+                                                 int*            ipiv,
+                                                 int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRect(hipblasHandle_t       handle,
+                                                 const int             m,
+                                                 const int             n,
+                                                 hipblasDoubleComplex* A,
+                                                 const int             lda,
+                                                 int*                  ipiv,
+                                                 int*                  info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRect_v2(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    hipComplex*     A,
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRect_v2(hipblasHandle_t   handle,
+                                                    const int         m,
+                                                    const int         n,
+                                                    hipDoubleComplex* A,
+                                                    const int         lda,
+                                                    int*              ipiv,
+                                                    int*              info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrfRectBatched computes the LU factorization of a batch of general
+    m-by-n matrices using partial pivoting with row interchanges. The LU factorization can
+    be done without pivoting if ipiv is passed as a nullptr.
+
+    In the case that ipiv is not null, the factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        A_i = P_iL_iU_i
+    \f]
+
+    where \f$P_i\f$ is a permutation matrix, \f$L_i\f$ is lower triangular (lower trapezoidal if m > n)
+    with unit diagonal elements, and \f$U_i\f$ is upper triangular (upper trapezoidal if m < n).
+
+    In the case that ipiv is null, the factorization is done without pivoting:
+
+    \f[
+        A_i = L_iU_i
+    \f]
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (only for m = n)
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all matrices A_i in the batch.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of all matrices A_i in the batch.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the m-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorizations.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv      pointer to int. Array on the GPU of dimension min(m,n)*batchCount.\n
+              Contains the vectors of pivot indices ipiv_i (corresponding to A_i),
+              stored one after the other with stride min(m,n).
+              Elements of ipiv_i are 1-based indices.
+              For each instance A_i in the batch and for 1 <= j <= min(m,n), the row j of the
+              matrix A_i was interchanged with row ipiv_i[j].
+              Matrix P_i of the factorization can be derived from ipiv_i.
+              The factorization here can be done without pivoting if ipiv is passed
+              in as a nullptr.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRectBatched(hipblasHandle_t handle,
+                                                        const int       m,
+                                                        const int       n,
+                                                        float* const    A[],
+                                                        const int       lda,
+                                                        int*            ipiv,
+                                                        int*            info,
+                                                        const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRectBatched(hipblasHandle_t handle,
+                                                        const int       m,
+                                                        const int       n,
+                                                        double* const   A[],
+                                                        const int       lda,
+                                                        int*            ipiv,
+                                                        int*            info,
+                                                        const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRectBatched(hipblasHandle_t       handle,
+                                                        const int             m,
+                                                        const int             n,
+                                                        hipblasComplex* const A[],
+                                                        const int             lda,
+                                                        int*                  ipiv,
+                                                        int*                  info,
+                                                        const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRectBatched(hipblasHandle_t             handle,
+                                                        const int                   m,
+                                                        const int                   n,
+                                                        hipblasDoubleComplex* const A[],
+                                                        const int                   lda,
+                                                        int*                        ipiv,
+                                                        int*                        info,
+                                                        const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRectBatched_v2(hipblasHandle_t   handle,
+                                                           const int         m,
+                                                           const int         n,
+                                                           hipComplex* const A[],
+                                                           const int         lda,
+                                                           int*              ipiv,
+                                                           int*              info,
+                                                           const int         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRectBatched_v2(hipblasHandle_t         handle,
+                                                           const int               m,
+                                                           const int               n,
+                                                           hipDoubleComplex* const A[],
+                                                           const int               lda,
+                                                           int*                    ipiv,
+                                                           int*                    info,
+                                                           const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrfRectStridedBatched computes the LU factorization of a batch of
+    general m-by-n matrices using partial pivoting with row interchanges. The LU factorization can
+    be done without pivoting if ipiv is passed as a nullptr.
+
+    In the case that ipiv is not null, the factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        A_i = P_iL_iU_i
+    \f]
+
+    where \f$P_i\f$ is a permutation matrix, \f$L_i\f$ is lower triangular (lower trapezoidal if m > n)
+    with unit diagonal elements, and \f$U_i\f$ is upper triangular (upper trapezoidal if m < n).
+
+    In the case that ipiv is null, the factorization is done without pivoting:
+
+    \f[
+        A_i = L_iU_i
+    \f]
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all matrices A_i in the batch.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the m-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorization.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[out]
+    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors of pivots indices ipiv_i (corresponding to A_i).
+              Dimension of ipiv_i is min(m,n).
+              Elements of ipiv_i are 1-based indices.
+              For each instance A_i in the batch and for 1 <= j <= min(m,n), the row j of the
+              matrix A_i was interchanged with row ipiv_i[j].
+              Matrix P_i of the factorization can be derived from ipiv_i.
+              The factorization here can be done without pivoting if ipiv is passed
+              in as a nullptr.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+              There is no restriction for the value of strideP. Normal use case is strideP >= min(m,n).
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRectStridedBatched(hipblasHandle_t     handle,
+                                                               const int           m,
+                                                               const int           n,
+                                                               float*              A,
+                                                               const int           lda,
+                                                               const hipblasStride strideA,
+                                                               int*                ipiv,
+                                                               const hipblasStride strideP,
+                                                               int*                info,
+                                                               const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRectStridedBatched(hipblasHandle_t     handle,
+                                                               const int           m,
+                                                               const int           n,
+                                                               double*             A,
+                                                               const int           lda,
+                                                               const hipblasStride strideA,
+                                                               int*                ipiv,
+                                                               const hipblasStride strideP,
+                                                               int*                info,
+                                                               const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRectStridedBatched(hipblasHandle_t     handle,
+                                                               const int           m,
+                                                               const int           n,
+                                                               hipblasComplex*     A,
+                                                               const int           lda,
+                                                               const hipblasStride strideA,
+                                                               int*                ipiv,
+                                                               const hipblasStride strideP,
+                                                               int*                info,
+                                                               const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRectStridedBatched(hipblasHandle_t       handle,
+                                                               const int             m,
+                                                               const int             n,
+                                                               hipblasDoubleComplex* A,
+                                                               const int             lda,
+                                                               const hipblasStride   strideA,
+                                                               int*                  ipiv,
+                                                               const hipblasStride   strideP,
+                                                               int*                  info,
+                                                               const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRectStridedBatched_v2(hipblasHandle_t     handle,
+                                                                  const int           m,
+                                                                  const int           n,
+                                                                  hipComplex*         A,
+                                                                  const int           lda,
+                                                                  const hipblasStride strideA,
+                                                                  int*                ipiv,
+                                                                  const hipblasStride strideP,
+                                                                  int*                info,
+                                                                  const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRectStridedBatched_v2(hipblasHandle_t     handle,
+                                                                  const int           m,
+                                                                  const int           n,
+                                                                  hipDoubleComplex*   A,
+                                                                  const int           lda,
+                                                                  const hipblasStride strideA,
+                                                                  int*                ipiv,
+                                                                  const hipblasStride strideP,
+                                                                  int*                info,
+                                                                  const int           batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrs solves a system of n linear equations on n variables in its factorized form.
+
+    It solves one of the following systems, depending on the value of trans:
+
+    \f[
+        \begin{array}{cl}
+        A X = B & \: \text{not transposed,}\\
+        A^T X = B & \: \text{transposed, or}\\
+        A^H X = B & \: \text{conjugate transposed.}
+        \end{array}
     \f]
 
     Matrix A is defined by its triangular factors as returned by \ref hipblasSgetrf "getrf".
@@ -20366,6 +23500,104 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched_v2(hipblasHandle_t
                                                               const int                batchCount);
 //! @}
 
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getri computes the inverse \f$C = A^{-1}\f$ of a general n-by-n matrix A.
+
+    The inverse is computed by solving the linear system
+
+    \f[
+        A C = I
+    \f]
+
+    where I is the identity matrix, and A is factorized as \f$A = P  L  U\f$ as given by \ref hipblasSgetrf "getrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of the matrix A.
+    @param[in]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              The factors L and U of the factorization A = P*L*U returned by \ref hipblasSgetrf "getrf".
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[in]
+    ipiv      pointer to int. Array on the GPU of dimension n.\n
+              The pivot indices returned by \ref hipblasSgetrf "getrf".
+              ipiv can be passed in as a nullptr, this will assume that getrf was called without partial pivoting.
+    @param[out]
+    C         pointer to type. Array on the GPU of dimension ldc*n.\n
+              If info = 0, the inverse of A. Otherwise, undefined.
+    @param[in]
+    ldc       int. ldc >= n.\n
+              Specifies the leading dimension of C.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = j > 0, U is singular. U[j,j] is the first zero pivot.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetri(hipblasHandle_t handle,
+                                             const int       n,
+                                             float*          A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             float*          C,
+                                             const int       ldc,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetri(hipblasHandle_t handle,
+                                             const int       n,
+                                             double*         A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             double*         C,
+                                             const int       ldc,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetri(hipblasHandle_t handle,
+                                             const int       n,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             hipblasComplex* C,
+                                             const int       ldc,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetri(hipblasHandle_t       handle,
+                                             const int             n,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             int*                  ipiv,
+                                             hipblasDoubleComplex* C,
+                                             const int             ldc,
+                                             int*                  info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetri_v2(hipblasHandle_t handle,
+                                                const int       n,
+                                                hipComplex*     A,
+                                                const int       lda,
+                                                int*            ipiv,
+                                                hipComplex*     C,
+                                                const int       ldc,
+                                                int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetri_v2(hipblasHandle_t   handle,
+                                                const int         n,
+                                                hipDoubleComplex* A,
+                                                const int         lda,
+                                                int*              ipiv,
+                                                hipDoubleComplex* C,
+                                                const int         ldc,
+                                                int*              info);
+//! @}
+
 /*! @{
     \brief SOLVER API
 
@@ -20476,35 +23708,172 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriBatched_v2(hipblasHandle_t         h
 //! @}
 
 /*! @{
-    \brief GELS solves an overdetermined (or underdetermined) linear system defined by an m-by-n
-    matrix A, and a corresponding matrix B, using the QR factorization computed by \ref hipblasSgeqrf "GEQRF" (or the LQ
-    factorization computed by "GELQF").
+    \brief SOLVER API
 
     \details
-    Depending on the value of trans, the problem solved by this function is either of the form
+    getriStridedBatched computes the inverse \f$C_i = A_i^{-1}\f$ of a batch of general n-by-n matrices \f$A_i\f$.
 
-    \f[
-        \begin{array}{cl}
-        A X = B & \: \text{not transposed, or}\\
-        A' X = B & \: \text{transposed if real, or conjugate transposed if complex}
-        \end{array}
-    \f]
-
-    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
-    and a least-squares solution approximating X is found by minimizing
+    The inverse is computed by solving the linear system
 
     \f[
-        || B - A  X || \quad \text{(or} \: || B - A' X ||\text{)}
+        A_i C_i = I
     \f]
 
-    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
-    and a unique solution for X is chosen such that \f$|| X ||\f$ is minimal.
+    where I is the identity matrix, and \f$A_i\f$ is factorized as \f$A_i = P_i  L_i  U_i\f$ as given by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
 
     - Supported precisions in rocSOLVER : s,d,c,z
-    - Supported precisions in cuBLAS    : currently unsupported
+    - Supported precisions in cuBLAS    : s,d,c,z (only for strideP = n when ipiv is not null)
 
     @param[in]
-    handle      hipblasHandle_t.
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of rows and columns of all matrices A_i in the batch.
+    @param[in]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              The factors L_i and U_i of the factorization A_i = P_i*L_i*U_i returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[in]
+    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+              The pivot indices returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+              ipiv can be passed in as a nullptr, this will assume that getrfStridedBatched was called without partial pivoting.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+              There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[out]
+    C         pointer to type. Array on the GPU (the size depends on the value of strideC).\n
+              If info[i] = 0, the inverse of matrices A_i. Otherwise, undefined.
+    @param[in]
+    ldc       int. ldc >= n.\n
+              Specifies the leading dimension of C_i.
+    @param[in]
+    strideC   hipblasStride.\n
+              Stride from the start of one matrix C_i to the next one C_(i+1).
+              There is no restriction for the value of strideC. Normal use case is strideC >= ldc*n
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for inversion of A_i.
+              If info[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           float*              A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           float*              C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetriStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           double*             C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           hipblasComplex*     C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriStridedBatched(hipblasHandle_t       handle,
+                                                           const int             n,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const hipblasStride   strideA,
+                                                           int*                  ipiv,
+                                                           const hipblasStride   strideP,
+                                                           hipblasDoubleComplex* C,
+                                                           const int             ldc,
+                                                           const hipblasStride   strideC,
+                                                           int*                  info,
+                                                           const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriStridedBatched_v2(hipblasHandle_t     handle,
+                                                              const int           n,
+                                                              hipComplex*         A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              int*                ipiv,
+                                                              const hipblasStride strideP,
+                                                              hipComplex*         C,
+                                                              const int           ldc,
+                                                              const hipblasStride strideC,
+                                                              int*                info,
+                                                              const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriStridedBatched_v2(hipblasHandle_t     handle,
+                                                              const int           n,
+                                                              hipDoubleComplex*   A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              int*                ipiv,
+                                                              const hipblasStride strideP,
+                                                              hipDoubleComplex*   C,
+                                                              const int           ldc,
+                                                              const hipblasStride strideC,
+                                                              int*                info,
+                                                              const int           batchCount);
+//! @}
+
+/*! @{
+    \brief GELS solves an overdetermined (or underdetermined) linear system defined by an m-by-n
+    matrix A, and a corresponding matrix B, using the QR factorization computed by \ref hipblasSgeqrf "GEQRF" (or the LQ
+    factorization computed by "GELQF").
+
+    \details
+    Depending on the value of trans, the problem solved by this function is either of the form
+
+    \f[
+        \begin{array}{cl}
+        A X = B & \: \text{not transposed, or}\\
+        A' X = B & \: \text{transposed if real, or conjugate transposed if complex}
+        \end{array}
+    \f]
+
+    If m >= n (or m < n in the case of transpose/conjugate transpose), the system is overdetermined
+    and a least-squares solution approximating X is found by minimizing
+
+    \f[
+        || B - A  X || \quad \text{(or} \: || B - A' X ||\text{)}
+    \f]
+
+    If m < n (or m >= n in the case of transpose/conjugate transpose), the system is underdetermined
+    and a unique solution for X is chosen such that \f$|| X ||\f$ is minimal.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle      hipblasHandle_t.
     @param[in]
     trans       hipblasOperation_t.\n
                 Specifies the form of the system of equations.
@@ -21310,468 +24679,2007 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t
                                                               const int           batchCount);
 //! @}
 
-/*
- * ===========================================================================
- *   BLAS Extensions
- * ===========================================================================
- */
-
-/*! \brief BLAS EX API
+/*! @{
+    \brief SOLVER API
 
     \details
-    gemmEx performs one of the matrix-matrix operations
+    potrf computes the Cholesky factorization of a real symmetric (complex
+    Hermitian) positive definite matrix A.
 
-        C = alpha*op( A )*op( B ) + beta*C,
+    Depending on the value of uplo, the factorization has the form
 
-    where op( X ) is one of
+    \f[
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L  L^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
 
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
+    U is an upper triangular matrix and L is lower triangular.
 
-    alpha and beta are scalars, and A, B, and C are matrices, with
-    op( A ) an m by k matrix, op( B ) a k by n matrix and C is a m by n matrix.
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (through cuSOLVER)
 
-    - Supported types are determined by the backend. See cuBLAS documentation for cuBLAS backend.
-      For rocBLAS backend, conversion from hipblasComputeType_t to rocblas_datatype_t happens within hipBLAS.
-      Supported types are as follows:
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the upper or lower part of the matrix A is stored.
+              If uplo indicates lower (or upper), then the upper (or lower)
+              part of A is not used.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns and rows of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A to be factored.
+              On exit, the lower or upper triangular factor.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = i > 0, the leading minor of order i of A is not positive definite.
+              The factorization stopped at this point.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipComplex*             A,
+                                                const int               lda,
+                                                int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                hipDoubleComplex*       A,
+                                                const int               lda,
+                                                int*                    info);
+//! @}
 
-      |   aType    |   bType    |   cType    |     computeType     |
-      | ---------- | ---------- | ---------- | ------------------- |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_16F |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16F  | HIP_R_16F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16BF | HIP_R_16BF | HIP_R_16BF | HIPBLAS_COMPUTE_32F |
-      | HIP_R_16BF | HIP_R_16BF | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_32F  | HIP_R_32F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_R_64F  | HIP_R_64F  | HIP_R_64F  | HIPBLAS_COMPUTE_64F |
-      | HIP_R_8I   | HIP_R_8I   | HIP_R_32I  | HIPBLAS_COMPUTE_32I |
-      | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
-      | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
+/*! @{
+    \brief SOLVER API
 
-    hipblasGemmExWithFlags is also available which is identical to hipblasGemmEx
-    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
-    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+    \details
+    potrfBatched computes the Cholesky factorization of a
+    batch of real symmetric (complex Hermitian) positive definite matrices.
 
-    With HIPBLAS_V2 define, hipblasGemmEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmEx will no
-    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmEx follows
-    the same convention.
+    Depending on the value of uplo, the factorization of matrix \f$A_i\f$ in the batch has the form
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
 
-            hipblasStatus_t hipblasGemmEx(hipblasHandle_t      handle,
-                                          hipblasOperation_t   transA,
-                                          hipblasOperation_t   transB,
-                                          int                  m,
-                                          int                  n,
-                                          int                  k,
-                                          const void*          alpha,
-                                          const void*          A,
-                                          hipDataType          aType,
-                                          int                  lda,
-                                          const void*          B,
-                                          hipDataType          bType,
-                                          int                  ldb,
-                                          const void*          beta,
-                                          void*                C,
-                                          hipDataType          cType,
-                                          int                  ldc,
-                                          hipblasComputeType_t computeType,
-                                          hipblasGemmAlgo_t    algo)
+    \f$U_i\f$ is an upper triangular matrix and \f$L_i\f$ is lower triangular.
 
-            hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t      handle,
-                                                   hipblasOperation_t   transA,
-                                                   hipblasOperation_t   transB,
-                                                   int                  m,
-                                                   int                  n,
-                                                   int                  k,
-                                                   const void*          alpha,
-                                                   const void*          A,
-                                                   hipDataType          aType,
-                                                   int                  lda,
-                                                   const void*          B,
-                                                   hipDataType          bType,
-                                                   int                  ldb,
-                                                   const void*          beta,
-                                                   void*                C,
-                                                   hipDataType          cType,
-                                                   int                  ldc,
-                                                   hipblasComputeType_t computeType,
-                                                   hipblasGemmAlgo_t    algo,
-                                                   hipblasGemmFlags_t   flags)
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (through cuSOLVER)
 
-        #else // [DEPRECATED]
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns and rows of all matrices A_i in the batch.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i to be factored.
+              On exit, the upper or lower triangular factors.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0, the leading minor of order j of A_i is not positive definite.
+              The i-th factorization stopped at this point.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batchCount);
 
-            hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                          hipblasOperation_t transA,
-                                          hipblasOperation_t transB,
-                                          int                m,
-                                          int                n,
-                                          int                k,
-                                          const void*        alpha,
-                                          const void*        A,
-                                          hipblasDatatype_t  aType,
-                                          int                lda,
-                                          const void*        B,
-                                          hipblasDatatype_t  bType,
-                                          int                ldb,
-                                          const void*        beta,
-                                          void*              C,
-                                          hipblasDatatype_t  cType,
-                                          int                ldc,
-                                          hipblasDatatype_t  computeType,
-                                          hipblasGemmAlgo_t  algo)
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipComplex* const       A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
 
-            hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t      handle,
-                                                   hipblasOperation_t   transA,
-                                                   hipblasOperation_t   transB,
-                                                   int                  m,
-                                                   int                  n,
-                                                   int                  k,
-                                                   const void*          alpha,
-                                                   const void*          A,
-                                                   hipblasDatatype_t    aType,
-                                                   int                  lda,
-                                                   const void*          B,
-                                                   hipblasDatatype_t    bType,
-                                                   int                  ldb,
-                                                   const void*          beta,
-                                                   void*                C,
-                                                   hipblasDatatype_t    cType,
-                                                   int                  ldc,
-                                                   hipblasDatatype_t    computeType,
-                                                   hipblasGemmAlgo_t    algo,
-                                                   hipblasGemmFlags_t   flags)
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
 
-        #endif
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrfStridedBatched computes the Cholesky factorization of a
+    batch of real symmetric (complex Hermitian) positive definite matrices.
+
+    Depending on the value of uplo, the factorization of matrix \f$A_i\f$ in the batch has the form
+
+    \f[
+        \begin{array}{cl}
+        A_i = U_i^H U_i & \: \text{if uplo is upper, or}\\
+        A_i = L_i  L_i^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    \f$U_i\f$ is an upper triangular matrix and \f$L_i\f$ is lower triangular.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
+    handle    hipblasHandle_t.
     @param[in]
-    transA    [hipblasOperation_t]
-              specifies the form of op( A ).
+    uplo      hipblasFillMode_t.\n
+              Specifies whether the factorization is upper or lower triangular.
+              If uplo indicates lower (or upper), then the upper (or lower) part of A_i is not used.
     @param[in]
-    transB    [hipblasOperation_t]
-              specifies the form of op( B ).
+    n         int. n >= 0.\n
+              The number of columns and rows of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i to be factored.
+              On exit, the upper or lower triangular factors.
     @param[in]
-    m         [int]
-              matrix dimension m.
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
     @param[in]
-    n         [int]
-              matrix dimension n.
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0, the leading minor of order j of A_i is not positive definite.
+              The i-th factorization stopped at this point.
     @param[in]
-    k         [int]
-              matrix dimension k.
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipComplex*             A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              hipDoubleComplex*       A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              int*                    info,
+                                                              const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    potrs solves a symmetric (Hermitian) positive definite system of n linear
+    equations on n variables in its factorized form.
+
+    It solves the system
+
+    \f[
+        A X = B
+    \f]
+
+    where A is a real symmetric (complex Hermitian) positive definite matrix defined by its triangular factor
+
+    \f[
+        \begin{array}{cl}
+        A = U^H U & \: \text{if uplo is upper, or}\\
+        A = L  L^H & \: \text{if uplo is lower.}
+        \end{array}
+    \f]
+
+    as returned by \ref hipblasSpotrf "potrf".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (through cuSOLVER)
+
     @param[in]
-    alpha     [const void *]
-              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    handle      hipblasHandle_t.
     @param[in]
-    A         [void *]
-              device pointer storing matrix A.
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the factor stored in A is upper or lower triangular.
     @param[in]
-    aType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix A.\n
-    [hipDataType]
-              specifies the datatype of matrix A.
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of A.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of A.
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrix B.
     @param[in]
-    B         [void *]
-              device pointer storing matrix B.
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                The factor L or U of the Cholesky factorization of A returned by \ref hipblasSpotrf "potrf".
     @param[in]
-    bType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix B.\n
-    [hipDataType]
-              specifies the datatype of matrix B.
+    lda         int. lda >= n.\n
+                The leading dimension of A.
+    @param[in,out]
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B.
+                On exit, the solution matrix X.
     @param[in]
-    ldb       [int]
-              specifies the leading dimension of B.
+    ldb         int. ldb >= n.\n
+                The leading dimension of B.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             float*                  A,
+                                             const int               lda,
+                                             float*                  B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             double*                 A,
+                                             const int               lda,
+                                             double*                 B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             hipblasDoubleComplex*   B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipComplex*             A,
+                                                const int               lda,
+                                                hipComplex*             B,
+                                                const int               ldb,
+                                                int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs_v2(hipblasHandle_t         handle,
+                                                const hipblasFillMode_t uplo,
+                                                const int               n,
+                                                const int               nrhs,
+                                                hipDoubleComplex*       A,
+                                                const int               lda,
+                                                hipDoubleComplex*       B,
+                                                const int               ldb,
+                                                int*                    info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details potrsBatched solves a batch of symmetric (Hermitian) positive definite
+    systems of n linear equations on n variables in its factorized forms.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    where \f$A_i\f$ is defined by its triangular factor as returned by \ref hipblasSpotrfBatched "potrfBatched".
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : s,d,c,z (through cuSOLVER, only for nrhs = 1)
+
     @param[in]
-    beta      [const void *]
-              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    handle      hipblasHandle_t.
     @param[in]
-    C         [void *]
-              device pointer storing matrix C.
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the factors stored in A_i are upper or lower triangular.
     @param[in]
-    cType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of matrix C.\n
-    [hipDataType]
-              specifies the datatype of matrix C.
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
     @param[in]
-    ldc       [int]
-              specifies the leading dimension of C.
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
     @param[in]
-    computeType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of computation.\n
-    [hipblasComputeType_t]
-              specifies the datatype of computation.
+    A           Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                The factors L_i or U_i of the Cholesky factorization of A_i returned by \ref hipblasSpotrfBatched "potrfBatched".
     @param[in]
-    algo      [hipblasGemmAlgo_t]
-              enumerant specifying the algorithm type.
-
-    ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                             hipblasOperation_t transA,
-                                             hipblasOperation_t transB,
-                                             int                m,
-                                             int                n,
-                                             int                k,
-                                             const void*        alpha,
-                                             const void*        A,
-                                             hipblasDatatype_t  aType,
-                                             int                lda,
-                                             const void*        B,
-                                             hipblasDatatype_t  bType,
-                                             int                ldb,
-                                             const void*        beta,
-                                             void*              C,
-                                             hipblasDatatype_t  cType,
-                                             int                ldc,
-                                             hipblasDatatype_t  computeType,
-                                             hipblasGemmAlgo_t  algo);
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[in,out]
+    B           Array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    float* const            B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    double* const           B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
-                                                hipblasOperation_t   transA,
-                                                hipblasOperation_t   transB,
-                                                int                  m,
-                                                int                  n,
-                                                int                  k,
-                                                const void*          alpha,
-                                                const void*          A,
-                                                hipDataType          aType,
-                                                int                  lda,
-                                                const void*          B,
-                                                hipDataType          bType,
-                                                int                  ldb,
-                                                const void*          beta,
-                                                void*                C,
-                                                hipDataType          cType,
-                                                int                  ldc,
-                                                hipblasComputeType_t computeType,
-                                                hipblasGemmAlgo_t    algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       const int               nrhs,
+                                                       hipComplex* const       A[],
+                                                       const int               lda,
+                                                       hipComplex* const       B[],
+                                                       const int               ldb,
+                                                       int*                    info,
+                                                       const int               batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t    handle,
-                                                      hipblasOperation_t transA,
-                                                      hipblasOperation_t transB,
-                                                      int                m,
-                                                      int                n,
-                                                      int                k,
-                                                      const void*        alpha,
-                                                      const void*        A,
-                                                      hipblasDatatype_t  aType,
-                                                      int                lda,
-                                                      const void*        B,
-                                                      hipblasDatatype_t  bType,
-                                                      int                ldb,
-                                                      const void*        beta,
-                                                      void*              C,
-                                                      hipblasDatatype_t  cType,
-                                                      int                ldc,
-                                                      hipblasDatatype_t  computeType,
-                                                      hipblasGemmAlgo_t  algo,
-                                                      hipblasGemmFlags_t flags);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      handle,
-                                                         hipblasOperation_t   transA,
-                                                         hipblasOperation_t   transB,
-                                                         int                  m,
-                                                         int                  n,
-                                                         int                  k,
-                                                         const void*          alpha,
-                                                         const void*          A,
-                                                         hipDataType          aType,
-                                                         int                  lda,
-                                                         const void*          B,
-                                                         hipDataType          bType,
-                                                         int                  ldb,
-                                                         const void*          beta,
-                                                         void*                C,
-                                                         hipDataType          cType,
-                                                         int                  ldc,
-                                                         hipblasComputeType_t computeType,
-                                                         hipblasGemmAlgo_t    algo,
-                                                         hipblasGemmFlags_t   flags);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched_v2(hipblasHandle_t         handle,
+                                                       const hipblasFillMode_t uplo,
+                                                       const int               n,
+                                                       const int               nrhs,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       hipDoubleComplex* const B[],
+                                                       const int               ldb,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
 
-/*! \brief BLAS EX API
-    \details
-    gemmBatchedEx performs one of the batched matrix-matrix operations
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
-    where op( X ) is one of
-        op( X ) = X      or
-        op( X ) = X**T   or
-        op( X ) = X**H,
-    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
-    op( A ) an m by k by batchCount batched matrix,
-    op( B ) a k by n by batchCount batched matrix and
-    C a m by n by batchCount batched matrix.
-    The batched matrices are an array of pointers to matrices.
-    The number of pointers to matrices is batchCount.
+/*! @{
+    \brief SOLVER API
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    \details potrsStridedBatched solves a batch of symmetric (Hermitian) positive definite
+    systems of n linear equations on n variables in its factorized forms.
 
-    hipblasGemmBatchedExWithFlags is also available which is identical to hipblasGemmBatchedEx
-    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
-    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+    For each instance i in the batch, it solves the system
 
-    With HIPBLAS_V2 define, hipblasGemmBatchedEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmBatchedEx will no
-    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmBatchedExWithFlags
-    follows the same convention.
+    \f[
+        A_i X_i = B_i
+    \f]
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+    where \f$A_i\f$ is defined by its triangular factor as returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
 
-            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t      handle,
-                                                 hipblasOperation_t   transA,
-                                                 hipblasOperation_t   transB,
-                                                 int                  m,
-                                                 int                  n,
-                                                 int                  k,
-                                                 const void*          alpha,
-                                                 const void*          A[],
-                                                 hipDataType          aType,
-                                                 int                  lda,
-                                                 const void*          B[],
-                                                 hipDataType          bType,
-                                                 int                  ldb,
-                                                 const void*          beta,
-                                                 void*                C[],
-                                                 hipDataType          cType,
-                                                 int                  ldc,
-                                                 int                  batchCount,
-                                                 hipblasComputeType_t computeType,
-                                                 hipblasGemmAlgo_t    algo)
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : currently unsupported
 
-            hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t      handle,
-                                                          hipblasOperation_t   transA,
-                                                          hipblasOperation_t   transB,
-                                                          int                  m,
-                                                          int                  n,
-                                                          int                  k,
-                                                          const void*          alpha,
-                                                          const void*          A[],
-                                                          hipDataType          aType,
-                                                          int                  lda,
-                                                          const void*          B[],
-                                                          hipDataType          bType,
-                                                          int                  ldb,
-                                                          const void*          beta,
-                                                          void*                C[],
-                                                          hipDataType          cType,
-                                                          int                  ldc,
-                                                          int                  batchCount,
-                                                          hipblasComputeType_t computeType,
-                                                          hipblasGemmAlgo_t    algo,
-                                                          hipblasGemmFlags_t   flags)
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    uplo        hipblasFillMode_t.\n
+                Specifies whether the factors stored in A_i are upper or lower triangular.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all A_i matrices.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i.
+    @param[in]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                The factors L_i or U_i of the Cholesky factorization of A_i returned by \ref hipblasSpotrfStridedBatched "potrfStridedBatched".
+    @param[in]
+    lda         int. lda >= n.\n
+                The leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[in,out]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i.
+                On exit, the solution matrix X_i of each system in the batch.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                The leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           float*                  B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           double*                 B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const hipblasStride     strideA,
+                                                           hipblasDoubleComplex*   B,
+                                                           const int               ldb,
+                                                           const hipblasStride     strideB,
+                                                           int*                    info,
+                                                           const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              const int               nrhs,
+                                                              hipComplex*             A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              hipComplex*             B,
+                                                              const int               ldb,
+                                                              const hipblasStride     strideB,
+                                                              int*                    info,
+                                                              const int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched_v2(hipblasHandle_t         handle,
+                                                              const hipblasFillMode_t uplo,
+                                                              const int               n,
+                                                              const int               nrhs,
+                                                              hipDoubleComplex*       A,
+                                                              const int               lda,
+                                                              const hipblasStride     strideA,
+                                                              hipDoubleComplex*       B,
+                                                              const int               ldb,
+                                                              const hipblasStride     strideB,
+                                                              int*                    info,
+                                                              const int               batchCount);
+//! @}
 
-        #else // [DEPRECATED]
+/*! @{
+    \brief SOLVER API
 
-            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                                 hipblasOperation_t transA,
-                                                 hipblasOperation_t transB,
-                                                 int                m,
-                                                 int                n,
-                                                 int                k,
-                                                 const void*        alpha,
-                                                 const void*        A[],
-                                                 hipblasDatatype_t  aType,
-                                                 int                lda,
-                                                 const void*        B[],
-                                                 hipblasDatatype_t  bType,
-                                                 int                ldb,
-                                                 const void*        beta,
-                                                 void*              C[],
-                                                 hipblasDatatype_t  cType,
-                                                 int                ldc,
-                                                 int                batchCount,
-                                                 hipblasDatatype_t  computeType,
-                                                 hipblasGemmAlgo_t  algo)
+    \details XXgesv solves a system of n linear equations on n variables using a factorization
+    in lower precision and iterative refinement in double precision.
 
-            hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t      handle,
-                                                          hipblasOperation_t   transA,
-                                                          hipblasOperation_t   transB,
-                                                          int                  m,
-                                                          int                  n,
-                                                          int                  k,
-                                                          const void*          alpha,
-                                                          const void*          A[],
-                                                          hipblasDatatype_t    aType,
-                                                          int                  lda,
-                                                          const void*          B[],
-                                                          hipblasDatatype_t    bType,
-                                                          int                  ldb,
-                                                          const void*          beta,
-                                                          void*                C[],
-                                                          hipblasDatatype_t    cType,
-                                                          int                  ldc,
-                                                          int                  batchCount,
-                                                          hipblasDatatype_t    computeType,
-                                                          hipblasGemmAlgo_t    algo,
-                                                          hipblasGemmFlags_t   flags)
+    It solves the system
 
-        #endif
+    \f[
+        A X = B
+    \f]
 
+    The matrix is factorized in single precision with the LU factorization of "GETRF", and the
+    solution is refined in double precision until the residual satisfies
 
+    \f[
+        \| B - A X \|_{\infty} \le \| X \|_{\infty} \| A \|_{\infty} \epsilon \sqrt{n}
+    \f]
 
+    column by column, as in LAPACK. A system whose single precision factorization fails, or whose
+    refinement does not converge in 30 iterations, is solved again with a double precision
+    factorization. This is several times faster than a double precision solve when single precision
+    arithmetic is faster and the systems are not too badly conditioned.
 
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : ds,zc
+    Note that rocSOLVER backend needs hipBLAS built with the HIP compiler, which also builds the
+    kernels of the refinement. The cuBLAS backend solves the systems of a batch one at a time.
 
     @param[in]
-    handle    [hipblasHandle_t]
-              handle to the hipblas library context queue.
-    @param[in]
-    transA    [hipblasOperation_t]
-              specifies the form of op( A ).
-    @param[in]
-    transB    [hipblasOperation_t]
-              specifies the form of op( B ).
-    @param[in]
-    m         [int]
-              matrix dimension m.
-    @param[in]
-    n         [int]
-              matrix dimension n.
-    @param[in]
-    k         [int]
-              matrix dimension k.
-    @param[in]
-    alpha     [const void *]
-              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
-    @param[in]
-    A         [void *]
-              device pointer storing array of pointers to each matrix A_i.
+    handle      hipblasHandle_t.
     @param[in]
-    aType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix A_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix A_i.
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of matrix A.
     @param[in]
-    lda       [int]
-              specifies the leading dimension of each A_i.
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of the matrices B and X.
+    @param[in,out]
+    A           pointer to type. Array on the GPU of dimension lda*n.\n
+                On entry, the matrix A to be factored.
+                On exit, unchanged if the refinement converged; otherwise the double precision
+                factors L and U of the factorization A = P L U.
     @param[in]
-    B         [void *]
-              device pointer storing array of pointers to each matrix B_i.
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrix A.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n.\n
+                The vector of pivot indices of the last factorization. Row i of matrix A
+                was interchanged with row ipiv[i].
     @param[in]
-    bType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix B_i.\n
-    [hipDataType]
-              specifies the datatype of each matrix B_i.
+    B           pointer to type. Array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrix B. It is not modified.
     @param[in]
-    ldb       [int]
-              specifies the leading dimension of each B_i.
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrix B.
+    @param[out]
+    X           pointer to type. Array on the GPU of dimension ldx*nrhs.\n
+                On entry, ignored.
+                On exit, the solution matrix X. X must not overlap B.
     @param[in]
-    beta      [const void *]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrix X.
+    @param[out]
+    iter        pointer to an int on the host.\n
+                If iter >= 0, the refinement converged after iter iterations.
+                If iter < 0, the system was solved in double precision because the
+                matrices overflow in single precision (-2), the single precision
+                factorization failed (-3), or the refinement did not converge (-31).
+                cuSOLVER reports its own negative values for these cases.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to an int on the GPU.\n
+                If deviceInfo = 0, successful exit.
+                If deviceInfo = j > 0, U is singular; U[j,j] is the first zero pivot
+                of the double precision factorization and X was not computed.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             double*         A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             double*         B,
+                                             const int       ldb,
+                                             double*         X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             int*            info,
+                                             int*            deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv(hipblasHandle_t       handle,
+                                             const int             n,
+                                             const int             nrhs,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             int*                  ipiv,
+                                             hipblasDoubleComplex* B,
+                                             const int             ldb,
+                                             hipblasDoubleComplex* X,
+                                             const int             ldx,
+                                             int*                  iter,
+                                             int*                  info,
+                                             int*                  deviceInfo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv_v2(hipblasHandle_t   handle,
+                                                const int         n,
+                                                const int         nrhs,
+                                                hipDoubleComplex* A,
+                                                const int         lda,
+                                                int*              ipiv,
+                                                hipDoubleComplex* B,
+                                                const int         ldb,
+                                                hipDoubleComplex* X,
+                                                const int         ldx,
+                                                int*              iter,
+                                                int*              info,
+                                                int*              deviceInfo);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details XXgesvBatched solves a batch of systems of n linear equations on n variables using
+    factorizations in lower precision and iterative refinement in double precision.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    The matrix is factorized in single precision with the LU factorization of "GETRF", and the
+    solution is refined in double precision until the residual satisfies
+
+    \f[
+        \| B_i - A_i X_i \|_{\infty} \le \| X_i \|_{\infty} \| A_i \|_{\infty} \epsilon \sqrt{n}
+    \f]
+
+    column by column, as in LAPACK. A system whose single precision factorization fails, or whose
+    refinement does not converge in 30 iterations, is solved again with a double precision
+    factorization. This is several times faster than a double precision solve when single precision
+    arithmetic is faster and the systems are not too badly conditioned.
+
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : ds,zc
+    Note that rocSOLVER backend needs hipBLAS built with the HIP compiler, which also builds the
+    kernels of the refinement. The cuBLAS backend solves the systems of a batch one at a time.
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all matrices A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i and X_i.
+    @param[in,out]
+    A           array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+                On entry, the matrices A_i to be factored.
+                On exit, unchanged if the refinement converged; otherwise the double precision
+                factors L and U of the factorization A_i = P L U.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU of dimension n*batchCount.\n
+                The vectors of pivot indices ipiv_i (corresponding to A_i) of the last
+                factorization of each system, stored n apart.
+    @param[in]
+    B           array of pointers to type. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+                On entry, the right hand side matrices B_i. It is not modified.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[out]
+    X           array of pointers to type. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n
+                On entry, ignored.
+                On exit, the solution matrices X_i. X must not overlap B.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[out]
+    iter        pointer to int. Array of batchCount integers on the host.\n
+                If iter[i] >= 0, the refinement converged after iter[i] iterations.
+                If iter[i] < 0, the system was solved in double precision because the
+                matrices overflow in single precision (-2), the single precision
+                factorization failed (-3), or the refinement did not converge (-31).
+                cuSOLVER reports its own negative values for these cases.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[i] = 0, successful exit for system i.
+                If deviceInfo[i] = j > 0, U_i is singular; U_i[j,j] is the first zero pivot
+                of the double precision factorization and X_i was not computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    const int       nrhs,
+                                                    double* const   A[],
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    double* const   B[],
+                                                    const int       ldb,
+                                                    double* const   X[],
+                                                    const int       ldx,
+                                                    int*            iter,
+                                                    int*            info,
+                                                    int*            deviceInfo,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t             handle,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        ipiv,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    hipblasDoubleComplex* const X[],
+                                                    const int                   ldx,
+                                                    int*                        iter,
+                                                    int*                        info,
+                                                    int*                        deviceInfo,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched_v2(hipblasHandle_t         handle,
+                                                       const int               n,
+                                                       const int               nrhs,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       int*                    ipiv,
+                                                       hipDoubleComplex* const B[],
+                                                       const int               ldb,
+                                                       hipDoubleComplex* const X[],
+                                                       const int               ldx,
+                                                       int*                    iter,
+                                                       int*                    info,
+                                                       int*                    deviceInfo,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details XXgesvStridedBatched solves a batch of systems of n linear equations on n variables
+    using factorizations in lower precision and iterative refinement in double precision.
+
+    For each instance i in the batch, it solves the system
+
+    \f[
+        A_i X_i = B_i
+    \f]
+
+    The matrix is factorized in single precision with the LU factorization of "GETRF", and the
+    solution is refined in double precision until the residual satisfies
+
+    \f[
+        \| B_i - A_i X_i \|_{\infty} \le \| X_i \|_{\infty} \| A_i \|_{\infty} \epsilon \sqrt{n}
+    \f]
+
+    column by column, as in LAPACK. A system whose single precision factorization fails, or whose
+    refinement does not converge in 30 iterations, is solved again with a double precision
+    factorization. This is several times faster than a double precision solve when single precision
+    arithmetic is faster and the systems are not too badly conditioned.
+
+    - Supported precisions in rocSOLVER : ds,zc
+    - Supported precisions in cuBLAS    : ds,zc
+    Note that rocSOLVER backend needs hipBLAS built with the HIP compiler, which also builds the
+    kernels of the refinement. The cuBLAS backend solves the systems of a batch one at a time.
+
+    @param[in]
+    handle      hipblasHandle_t.
+    @param[in]
+    n           int. n >= 0.\n
+                The order of the system, i.e. the number of columns and rows of all matrices A_i.
+    @param[in]
+    nrhs        int. nrhs >= 0.\n
+                The number of right hand sides, i.e., the number of columns
+                of all the matrices B_i and X_i.
+    @param[in,out]
+    A           pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+                On entry, the matrices A_i to be factored.
+                On exit, unchanged if the refinement converged; otherwise the double precision
+                factors L and U of the factorization A_i = P L U.
+    @param[in]
+    lda         int. lda >= n.\n
+                Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA     hipblasStride.\n
+                Stride from the start of one matrix A_i to the next one A_(i+1).
+                There is no restriction for the value of strideA. Normal use case is strideA >= lda*n.
+    @param[out]
+    ipiv        pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+                The vectors of pivot indices ipiv_i (corresponding to A_i) of the last
+                factorization of each system. Row i of matrix A_i was interchanged with row ipiv_i[i].
+    @param[in]
+    strideP     hipblasStride.\n
+                Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+                There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in]
+    B           pointer to type. Array on the GPU (the size depends on the value of strideB).\n
+                On entry, the right hand side matrices B_i. It is not modified.
+    @param[in]
+    ldb         int. ldb >= n.\n
+                Specifies the leading dimension of matrices B_i.
+    @param[in]
+    strideB     hipblasStride.\n
+                Stride from the start of one matrix B_i to the next one B_(i+1).
+                There is no restriction for the value of strideB. Normal use case is strideB >= ldb*nrhs.
+    @param[out]
+    X           pointer to type. Array on the GPU (the size depends on the value of strideX).\n
+                On entry, ignored.
+                On exit, the solution matrices X_i. X must not overlap B.
+    @param[in]
+    ldx         int. ldx >= n.\n
+                Specifies the leading dimension of matrices X_i.
+    @param[in]
+    strideX     hipblasStride.\n
+                Stride from the start of one matrix X_i to the next one X_(i+1).
+                There is no restriction for the value of strideX. Normal use case is strideX >= ldx*nrhs.
+    @param[out]
+    iter        pointer to int. Array of batchCount integers on the host.\n
+                If iter[i] >= 0, the refinement converged after iter[i] iterations.
+                If iter[i] < 0, the system was solved in double precision because the
+                matrices overflow in single precision (-2), the single precision
+                factorization failed (-3), or the refinement did not converge (-31).
+                cuSOLVER reports its own negative values for these cases.
+    @param[out]
+    info        pointer to an int on the host.\n
+                If info = 0, successful exit.
+                If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array of batchCount integers on the GPU.\n
+                If deviceInfo[i] = 0, successful exit for system i.
+                If deviceInfo[i] = j > 0, U_i is singular; U_i[j,j] is the first zero pivot
+                of the double precision factorization and X_i was not computed.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                Number of instances (systems) in the batch.
+   ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t     handle,
+                                                           const int           n,
+                                                           const int           nrhs,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           int*                ipiv,
+                                                           const hipblasStride strideP,
+                                                           double*             B,
+                                                           const int           ldb,
+                                                           const hipblasStride strideB,
+                                                           double*             X,
+                                                           const int           ldx,
+                                                           const hipblasStride strideX,
+                                                           int*                iter,
+                                                           int*                info,
+                                                           int*                deviceInfo,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t       handle,
+                                                           const int             n,
+                                                           const int             nrhs,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const hipblasStride   strideA,
+                                                           int*                  ipiv,
+                                                           const hipblasStride   strideP,
+                                                           hipblasDoubleComplex* B,
+                                                           const int             ldb,
+                                                           const hipblasStride   strideB,
+                                                           hipblasDoubleComplex* X,
+                                                           const int             ldx,
+                                                           const hipblasStride   strideX,
+                                                           int*                  iter,
+                                                           int*                  info,
+                                                           int*                  deviceInfo,
+                                                           const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched_v2(hipblasHandle_t     handle,
+                                                              const int           n,
+                                                              const int           nrhs,
+                                                              hipDoubleComplex*   A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              int*                ipiv,
+                                                              const hipblasStride strideP,
+                                                              hipDoubleComplex*   B,
+                                                              const int           ldb,
+                                                              const hipblasStride strideB,
+                                                              hipDoubleComplex*   X,
+                                                              const int           ldx,
+                                                              const hipblasStride strideX,
+                                                              int*                iter,
+                                                              int*                info,
+                                                              int*                deviceInfo,
+                                                              const int           batchCount);
+//! @}
+
+/*
+ * ===========================================================================
+ *   BLAS Extensions
+ * ===========================================================================
+ */
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmEx performs one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B, and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C is a m by n matrix.
+
+    - Supported types are determined by the backend. See cuBLAS documentation for cuBLAS backend.
+      For rocBLAS backend, conversion from hipblasComputeType_t to rocblas_datatype_t happens within hipBLAS.
+      Supported types are as follows:
+
+      |   aType    |   bType    |   cType    |     computeType     |
+      | ---------- | ---------- | ---------- | ------------------- |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_16F |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_16F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16F  | HIP_R_16F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16BF | HIP_R_16BF | HIP_R_16BF | HIPBLAS_COMPUTE_32F |
+      | HIP_R_16BF | HIP_R_16BF | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_32F  | HIP_R_32F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_R_64F  | HIP_R_64F  | HIP_R_64F  | HIPBLAS_COMPUTE_64F |
+      | HIP_R_8I   | HIP_R_8I   | HIP_R_32I  | HIPBLAS_COMPUTE_32I |
+      | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
+      | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
+
+    hipblasGemmExWithFlags is also available which is identical to hipblasGemmEx
+    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
+    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+
+    With HIPBLAS_V2 define, hipblasGemmEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmEx will no
+    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmEx follows
+    the same convention.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmEx(hipblasHandle_t      handle,
+                                          hipblasOperation_t   transA,
+                                          hipblasOperation_t   transB,
+                                          int                  m,
+                                          int                  n,
+                                          int                  k,
+                                          const void*          alpha,
+                                          const void*          A,
+                                          hipDataType          aType,
+                                          int                  lda,
+                                          const void*          B,
+                                          hipDataType          bType,
+                                          int                  ldb,
+                                          const void*          beta,
+                                          void*                C,
+                                          hipDataType          cType,
+                                          int                  ldc,
+                                          hipblasComputeType_t computeType,
+                                          hipblasGemmAlgo_t    algo)
+
+            hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transA,
+                                                   hipblasOperation_t   transB,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          aType,
+                                                   int                  lda,
+                                                   const void*          B,
+                                                   hipDataType          bType,
+                                                   int                  ldb,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          cType,
+                                                   int                  ldc,
+                                                   hipblasComputeType_t computeType,
+                                                   hipblasGemmAlgo_t    algo,
+                                                   hipblasGemmFlags_t   flags)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int                m,
+                                          int                n,
+                                          int                k,
+                                          const void*        alpha,
+                                          const void*        A,
+                                          hipblasDatatype_t  aType,
+                                          int                lda,
+                                          const void*        B,
+                                          hipblasDatatype_t  bType,
+                                          int                ldb,
+                                          const void*        beta,
+                                          void*              C,
+                                          hipblasDatatype_t  cType,
+                                          int                ldc,
+                                          hipblasDatatype_t  computeType,
+                                          hipblasGemmAlgo_t  algo)
+
+            hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transA,
+                                                   hipblasOperation_t   transB,
+                                                   int                  m,
+                                                   int                  n,
+                                                   int                  k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipblasDatatype_t    aType,
+                                                   int                  lda,
+                                                   const void*          B,
+                                                   hipblasDatatype_t    bType,
+                                                   int                  ldb,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipblasDatatype_t    cType,
+                                                   int                  ldc,
+                                                   hipblasDatatype_t    computeType,
+                                                   hipblasGemmAlgo_t    algo,
+                                                   hipblasGemmFlags_t   flags)
+
+        #endif
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix A.\n
+    [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix B.\n
+    [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of matrix C.\n
+    [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of computation.\n
+    [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  aType,
+                                             int                lda,
+                                             const void*        B,
+                                             hipblasDatatype_t  bType,
+                                             int                ldb,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  cType,
+                                             int                ldc,
+                                             hipblasDatatype_t  computeType,
+                                             hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_64(hipblasHandle_t    handle,
+                                                hipblasOperation_t transA,
+                                                hipblasOperation_t transB,
+                                                int64_t            m,
+                                                int64_t            n,
+                                                int64_t            k,
+                                                const void*        alpha,
+                                                const void*        A,
+                                                hipblasDatatype_t  aType,
+                                                int64_t            lda,
+                                                const void*        B,
+                                                hipblasDatatype_t  bType,
+                                                int64_t            ldb,
+                                                const void*        beta,
+                                                void*              C,
+                                                hipblasDatatype_t  cType,
+                                                int64_t            ldc,
+                                                hipblasDatatype_t  computeType,
+                                                hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
+                                                hipblasOperation_t   transA,
+                                                hipblasOperation_t   transB,
+                                                int                  m,
+                                                int                  n,
+                                                int                  k,
+                                                const void*          alpha,
+                                                const void*          A,
+                                                hipDataType          aType,
+                                                int                  lda,
+                                                const void*          B,
+                                                hipDataType          bType,
+                                                int                  ldb,
+                                                const void*          beta,
+                                                void*                C,
+                                                hipDataType          cType,
+                                                int                  ldc,
+                                                hipblasComputeType_t computeType,
+                                                hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx_v2_64(hipblasHandle_t      handle,
+                                                   hipblasOperation_t   transA,
+                                                   hipblasOperation_t   transB,
+                                                   int64_t              m,
+                                                   int64_t              n,
+                                                   int64_t              k,
+                                                   const void*          alpha,
+                                                   const void*          A,
+                                                   hipDataType          aType,
+                                                   int64_t              lda,
+                                                   const void*          B,
+                                                   hipDataType          bType,
+                                                   int64_t              ldb,
+                                                   const void*          beta,
+                                                   void*                C,
+                                                   hipDataType          cType,
+                                                   int64_t              ldc,
+                                                   hipblasComputeType_t computeType,
+                                                   hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const void*        alpha,
+                                                      const void*        A,
+                                                      hipblasDatatype_t  aType,
+                                                      int                lda,
+                                                      const void*        B,
+                                                      hipblasDatatype_t  bType,
+                                                      int                ldb,
+                                                      const void*        beta,
+                                                      void*              C,
+                                                      hipblasDatatype_t  cType,
+                                                      int                ldc,
+                                                      hipblasDatatype_t  computeType,
+                                                      hipblasGemmAlgo_t  algo,
+                                                      hipblasGemmFlags_t flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_64(hipblasHandle_t    handle,
+                                                         hipblasOperation_t transA,
+                                                         hipblasOperation_t transB,
+                                                         int64_t            m,
+                                                         int64_t            n,
+                                                         int64_t            k,
+                                                         const void*        alpha,
+                                                         const void*        A,
+                                                         hipblasDatatype_t  aType,
+                                                         int64_t            lda,
+                                                         const void*        B,
+                                                         hipblasDatatype_t  bType,
+                                                         int64_t            ldb,
+                                                         const void*        beta,
+                                                         void*              C,
+                                                         hipblasDatatype_t  cType,
+                                                         int64_t            ldc,
+                                                         hipblasDatatype_t  computeType,
+                                                         hipblasGemmAlgo_t  algo,
+                                                         hipblasGemmFlags_t flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      handle,
+                                                         hipblasOperation_t   transA,
+                                                         hipblasOperation_t   transB,
+                                                         int                  m,
+                                                         int                  n,
+                                                         int                  k,
+                                                         const void*          alpha,
+                                                         const void*          A,
+                                                         hipDataType          aType,
+                                                         int                  lda,
+                                                         const void*          B,
+                                                         hipDataType          bType,
+                                                         int                  ldb,
+                                                         const void*          beta,
+                                                         void*                C,
+                                                         hipDataType          cType,
+                                                         int                  ldc,
+                                                         hipblasComputeType_t computeType,
+                                                         hipblasGemmAlgo_t    algo,
+                                                         hipblasGemmFlags_t   flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                            hipblasOperation_t   transA,
+                                                            hipblasOperation_t   transB,
+                                                            int64_t              m,
+                                                            int64_t              n,
+                                                            int64_t              k,
+                                                            const void*          alpha,
+                                                            const void*          A,
+                                                            hipDataType          aType,
+                                                            int64_t              lda,
+                                                            const void*          B,
+                                                            hipDataType          bType,
+                                                            int64_t              ldb,
+                                                            const void*          beta,
+                                                            void*                C,
+                                                            hipDataType          cType,
+                                                            int64_t              ldc,
+                                                            hipblasComputeType_t computeType,
+                                                            hipblasGemmAlgo_t    algo,
+                                                            hipblasGemmFlags_t   flags);
+
+/*! \brief BLAS EX API
+    \details
+    gemmBatchedEx performs one of the batched matrix-matrix operations
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount.
+    where op( X ) is one of
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+    alpha and beta are scalars, and A, B, and C are batched pointers to matrices, with
+    op( A ) an m by k by batchCount batched matrix,
+    op( B ) a k by n by batchCount batched matrix and
+    C a m by n by batchCount batched matrix.
+    The batched matrices are an array of pointers to matrices.
+    The number of pointers to matrices is batchCount.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    hipblasGemmBatchedExWithFlags is also available which is identical to hipblasGemmBatchedEx
+    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
+    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+
+    With HIPBLAS_V2 define, hipblasGemmBatchedEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmBatchedEx will no
+    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmBatchedExWithFlags
+    follows the same convention.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t      handle,
+                                                 hipblasOperation_t   transA,
+                                                 hipblasOperation_t   transB,
+                                                 int                  m,
+                                                 int                  n,
+                                                 int                  k,
+                                                 const void*          alpha,
+                                                 const void*          A[],
+                                                 hipDataType          aType,
+                                                 int                  lda,
+                                                 const void*          B[],
+                                                 hipDataType          bType,
+                                                 int                  ldb,
+                                                 const void*          beta,
+                                                 void*                C[],
+                                                 hipDataType          cType,
+                                                 int                  ldc,
+                                                 int                  batchCount,
+                                                 hipblasComputeType_t computeType,
+                                                 hipblasGemmAlgo_t    algo)
+
+            hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t      handle,
+                                                          hipblasOperation_t   transA,
+                                                          hipblasOperation_t   transB,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          const void*          alpha,
+                                                          const void*          A[],
+                                                          hipDataType          aType,
+                                                          int                  lda,
+                                                          const void*          B[],
+                                                          hipDataType          bType,
+                                                          int                  ldb,
+                                                          const void*          beta,
+                                                          void*                C[],
+                                                          hipDataType          cType,
+                                                          int                  ldc,
+                                                          int                  batchCount,
+                                                          hipblasComputeType_t computeType,
+                                                          hipblasGemmAlgo_t    algo,
+                                                          hipblasGemmFlags_t   flags)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                 hipblasOperation_t transA,
+                                                 hipblasOperation_t transB,
+                                                 int                m,
+                                                 int                n,
+                                                 int                k,
+                                                 const void*        alpha,
+                                                 const void*        A[],
+                                                 hipblasDatatype_t  aType,
+                                                 int                lda,
+                                                 const void*        B[],
+                                                 hipblasDatatype_t  bType,
+                                                 int                ldb,
+                                                 const void*        beta,
+                                                 void*              C[],
+                                                 hipblasDatatype_t  cType,
+                                                 int                ldc,
+                                                 int                batchCount,
+                                                 hipblasDatatype_t  computeType,
+                                                 hipblasGemmAlgo_t  algo)
+
+            hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t      handle,
+                                                          hipblasOperation_t   transA,
+                                                          hipblasOperation_t   transB,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          const void*          alpha,
+                                                          const void*          A[],
+                                                          hipblasDatatype_t    aType,
+                                                          int                  lda,
+                                                          const void*          B[],
+                                                          hipblasDatatype_t    bType,
+                                                          int                  ldb,
+                                                          const void*          beta,
+                                                          void*                C[],
+                                                          hipblasDatatype_t    cType,
+                                                          int                  ldc,
+                                                          int                  batchCount,
+                                                          hipblasDatatype_t    computeType,
+                                                          hipblasGemmAlgo_t    algo,
+                                                          hipblasGemmFlags_t   flags)
+
+        #endif
+
+
+
+
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing array of pointers to each matrix A_i.
+    @param[in]
+    aType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix A_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    B         [void *]
+              device pointer storing array of pointers to each matrix B_i.
+    @param[in]
+    bType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix B_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i.
+    @param[in]
+    cType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix C_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch.
+    @param[in]
+    computeType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of computation.\n
+    [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  aType,
+                                                    int                lda,
+                                                    const void*        B[],
+                                                    hipblasDatatype_t  bType,
+                                                    int                ldb,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  cType,
+                                                    int                ldc,
+                                                    int                batchCount,
+                                                    hipblasDatatype_t  computeType,
+                                                    hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_64(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transA,
+                                                       hipblasOperation_t transB,
+                                                       int64_t            m,
+                                                       int64_t            n,
+                                                       int64_t            k,
+                                                       const void*        alpha,
+                                                       const void*        A[],
+                                                       hipblasDatatype_t  aType,
+                                                       int64_t            lda,
+                                                       const void*        B[],
+                                                       hipblasDatatype_t  bType,
+                                                       int64_t            ldb,
+                                                       const void*        beta,
+                                                       void*              C[],
+                                                       hipblasDatatype_t  cType,
+                                                       int64_t            ldc,
+                                                       int64_t            batchCount,
+                                                       hipblasDatatype_t  computeType,
+                                                       hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
+                                                       hipblasOperation_t   transA,
+                                                       hipblasOperation_t   transB,
+                                                       int                  m,
+                                                       int                  n,
+                                                       int                  k,
+                                                       const void*          alpha,
+                                                       const void*          A[],
+                                                       hipDataType          aType,
+                                                       int                  lda,
+                                                       const void*          B[],
+                                                       hipDataType          bType,
+                                                       int                  ldb,
+                                                       const void*          beta,
+                                                       void*                C[],
+                                                       hipDataType          cType,
+                                                       int                  ldc,
+                                                       int                  batchCount,
+                                                       hipblasComputeType_t computeType,
+                                                       hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_v2_64(hipblasHandle_t      handle,
+                                                          hipblasOperation_t   transA,
+                                                          hipblasOperation_t   transB,
+                                                          int64_t              m,
+                                                          int64_t              n,
+                                                          int64_t              k,
+                                                          const void*          alpha,
+                                                          const void*          A[],
+                                                          hipDataType          aType,
+                                                          int64_t              lda,
+                                                          const void*          B[],
+                                                          hipDataType          bType,
+                                                          int64_t              ldb,
+                                                          const void*          beta,
+                                                          void*                C[],
+                                                          hipDataType          cType,
+                                                          int64_t              ldc,
+                                                          int64_t              batchCount,
+                                                          hipblasComputeType_t computeType,
+                                                          hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t    handle,
+                                                             hipblasOperation_t transA,
+                                                             hipblasOperation_t transB,
+                                                             int                m,
+                                                             int                n,
+                                                             int                k,
+                                                             const void*        alpha,
+                                                             const void*        A[],
+                                                             hipblasDatatype_t  aType,
+                                                             int                lda,
+                                                             const void*        B[],
+                                                             hipblasDatatype_t  bType,
+                                                             int                ldb,
+                                                             const void*        beta,
+                                                             void*              C[],
+                                                             hipblasDatatype_t  cType,
+                                                             int                ldc,
+                                                             int                batchCount,
+                                                             hipblasDatatype_t  computeType,
+                                                             hipblasGemmAlgo_t  algo,
+                                                             hipblasGemmFlags_t flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                                                hipblasOperation_t transA,
+                                                                hipblasOperation_t transB,
+                                                                int64_t            m,
+                                                                int64_t            n,
+                                                                int64_t            k,
+                                                                const void*        alpha,
+                                                                const void*        A[],
+                                                                hipblasDatatype_t  aType,
+                                                                int64_t            lda,
+                                                                const void*        B[],
+                                                                hipblasDatatype_t  bType,
+                                                                int64_t            ldb,
+                                                                const void*        beta,
+                                                                void*              C[],
+                                                                hipblasDatatype_t  cType,
+                                                                int64_t            ldc,
+                                                                int64_t            batchCount,
+                                                                hipblasDatatype_t  computeType,
+                                                                hipblasGemmAlgo_t  algo,
+                                                                hipblasGemmFlags_t flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                                                hipblasOperation_t   transA,
+                                                                hipblasOperation_t   transB,
+                                                                int                  m,
+                                                                int                  n,
+                                                                int                  k,
+                                                                const void*          alpha,
+                                                                const void*          A[],
+                                                                hipDataType          aType,
+                                                                int                  lda,
+                                                                const void*          B[],
+                                                                hipDataType          bType,
+                                                                int                  ldb,
+                                                                const void*          beta,
+                                                                void*                C[],
+                                                                hipDataType          cType,
+                                                                int                  ldc,
+                                                                int                  batchCount,
+                                                                hipblasComputeType_t computeType,
+                                                                hipblasGemmAlgo_t    algo,
+                                                                hipblasGemmFlags_t   flags);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                                                   hipblasOperation_t   transA,
+                                                                   hipblasOperation_t   transB,
+                                                                   int64_t              m,
+                                                                   int64_t              n,
+                                                                   int64_t              k,
+                                                                   const void*          alpha,
+                                                                   const void*          A[],
+                                                                   hipDataType          aType,
+                                                                   int64_t              lda,
+                                                                   const void*          B[],
+                                                                   hipDataType          bType,
+                                                                   int64_t              ldb,
+                                                                   const void*          beta,
+                                                                   void*                C[],
+                                                                   hipDataType          cType,
+                                                                   int64_t              ldc,
+                                                                   int64_t              batchCount,
+                                                                   hipblasComputeType_t computeType,
+                                                                   hipblasGemmAlgo_t    algo,
+                                                                   hipblasGemmFlags_t   flags);
+
+/*! \brief BLAS EX API
+
+    \details
+    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+
+        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix,
+    op( B ) a k by n by batchCount strided_batched matrix and
+    C a m by n by batchCount strided_batched matrix.
+
+    The strided_batched matrices are multiple matrices separated by a constant stride.
+    The number of matrices is batchCount.
+
+    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+
+    hipblasGemmStridedBatchedExWithFlags is also available which is identical to hipblasStridedBatchedGemmEx
+    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
+    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+
+    With HIPBLAS_V2 define, hipblasGemmStridedBatchedEx accepts hipDataType for aType, bType, and cType.
+    It also accepts hipblasComputeType_t for computeType. hipblasGemmStridedBatchedEx will no
+    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmStridedBatchedExWithFlags
+    follows the same convention.
+
+        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+
+            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t      handle,
+                                                        hipblasOperation_t   transA,
+                                                        hipblasOperation_t   transB,
+                                                        int                  m,
+                                                        int                  n,
+                                                        int                  k,
+                                                        const void*          alpha,
+                                                        const void*          A,
+                                                        hipDataType          aType,
+                                                        int                  lda,
+                                                        hipblasStride        strideA,
+                                                        const void*          B,
+                                                        hipDataType          bType,
+                                                        int                  ldb,
+                                                        hipblasStride        strideB,
+                                                        const void*          beta,
+                                                        void*                C,
+                                                        hipDataType          cType,
+                                                        int                  ldc,
+                                                        hipblasStride        strideC,
+                                                        int                  batchCount,
+                                                        hipblasComputeType_t computeType,
+                                                        hipblasGemmAlgo_t    algo)
+
+            hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t      handle,
+                                                                 hipblasOperation_t   transA,
+                                                                 hipblasOperation_t   transB,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 const void*          alpha,
+                                                                 const void*          A,
+                                                                 hipDataType          aType,
+                                                                 int                  lda,
+                                                                 hipblasStride        strideA,
+                                                                 const void*          B,
+                                                                 hipDataType          bType,
+                                                                 int                  ldb,
+                                                                 hipblasStride        strideB,
+                                                                 const void*          beta,
+                                                                 void*                C,
+                                                                 hipDataType          cType,
+                                                                 int                  ldc,
+                                                                 hipblasStride        strideC,
+                                                                 int                  batchCount,
+                                                                 hipblasComputeType_t computeType,
+                                                                 hipblasGemmAlgo_t    algo,
+                                                                 hipblasGemmFlags_t   flags)
+
+        #else // [DEPRECATED]
+
+            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transA,
+                                                        hipblasOperation_t transB,
+                                                        int                m,
+                                                        int                n,
+                                                        int                k,
+                                                        const void*        alpha,
+                                                        const void*        A,
+                                                        hipblasDatatype_t  aType,
+                                                        int                lda,
+                                                        hipblasStride      strideA,
+                                                        const void*        B,
+                                                        hipblasDatatype_t  bType,
+                                                        int                ldb,
+                                                        hipblasStride      strideB,
+                                                        const void*        beta,
+                                                        void*              C,
+                                                        hipblasDatatype_t  cType,
+                                                        int                ldc,
+                                                        hipblasStride      strideC,
+                                                        int                batchCount,
+                                                        hipblasDatatype_t  computeType,
+                                                        hipblasGemmAlgo_t  algo)
+
+            hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t      handle,
+                                                                 hipblasOperation_t   transA,
+                                                                 hipblasOperation_t   transB,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 const void*          alpha,
+                                                                 const void*          A,
+                                                                 hipblasDatatype_t    aType,
+                                                                 int                  lda,
+                                                                 hipblasStride        strideA,
+                                                                 const void*          B,
+                                                                 hipblasDatatype_t    bType,
+                                                                 int                  ldb,
+                                                                 hipblasStride        strideB,
+                                                                 const void*          beta,
+                                                                 void*                C,
+                                                                 hipblasDatatype_t    cType,
+                                                                 int                  ldc,
+                                                                 hipblasStride        strideC,
+                                                                 int                  batchCount,
+                                                                 hipblasDatatype_t    computeType,
+                                                                 hipblasGemmAlgo_t    algo,
+                                                                 hipblasGemmFlags_t   flags)
+
+        #endif
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer pointing to first matrix A_1.
+    @param[in]
+    aType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix A_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA  [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         [void *]
+              device pointer pointing to first matrix B_1.
+    @param[in]
+    bType
+    [hipblasDatatype_t] [DEPRECATED]
+              specifies the datatype of each matrix B_i.\n
+    [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB  [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      [const void *]
               device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
     @param[in]
     C         [void *]
-              device array of device pointers to each matrix C_i.
+              device pointer pointing to first matrix C_1.
     @param[in]
     cType
     [hipblasDatatype_t] [DEPRECATED]
@@ -21782,6 +26690,9 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      ha
     ldc       [int]
               specifies the leading dimension of each C_i.
     @param[in]
+    strideC  [hipblasStride]
+              specifies stride from start of one C_i matrix to the next C_(i + 1).
+    @param[in]
     batchCount
               [int]
               number of gemm operations in the batch.
@@ -21796,227 +26707,438 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      ha
               enumerant specifying the algorithm type.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
-                                                    hipblasOperation_t transA,
-                                                    hipblasOperation_t transB,
-                                                    int                m,
-                                                    int                n,
-                                                    int                k,
-                                                    const void*        alpha,
-                                                    const void*        A[],
-                                                    hipblasDatatype_t  aType,
-                                                    int                lda,
-                                                    const void*        B[],
-                                                    hipblasDatatype_t  bType,
-                                                    int                ldb,
-                                                    const void*        beta,
-                                                    void*              C[],
-                                                    hipblasDatatype_t  cType,
-                                                    int                ldc,
-                                                    int                batchCount,
-                                                    hipblasDatatype_t  computeType,
-                                                    hipblasGemmAlgo_t  algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  aType,
+                                                           int                lda,
+                                                           hipblasStride      strideA,
+                                                           const void*        B,
+                                                           hipblasDatatype_t  bType,
+                                                           int                ldb,
+                                                           hipblasStride      strideB,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  cType,
+                                                           int                ldc,
+                                                           hipblasStride      strideC,
+                                                           int                batchCount,
+                                                           hipblasDatatype_t  computeType,
+                                                           hipblasGemmAlgo_t  algo);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx_v2(hipblasHandle_t      handle,
-                                                       hipblasOperation_t   transA,
-                                                       hipblasOperation_t   transB,
-                                                       int                  m,
-                                                       int                  n,
-                                                       int                  k,
-                                                       const void*          alpha,
-                                                       const void*          A[],
-                                                       hipDataType          aType,
-                                                       int                  lda,
-                                                       const void*          B[],
-                                                       hipDataType          bType,
-                                                       int                  ldb,
-                                                       const void*          beta,
-                                                       void*                C[],
-                                                       hipDataType          cType,
-                                                       int                  ldc,
-                                                       int                  batchCount,
-                                                       hipblasComputeType_t computeType,
-                                                       hipblasGemmAlgo_t    algo);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_64(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transA,
+                                                              hipblasOperation_t transB,
+                                                              int64_t            m,
+                                                              int64_t            n,
+                                                              int64_t            k,
+                                                              const void*        alpha,
+                                                              const void*        A,
+                                                              hipblasDatatype_t  aType,
+                                                              int64_t            lda,
+                                                              hipblasStride      strideA,
+                                                              const void*        B,
+                                                              hipblasDatatype_t  bType,
+                                                              int64_t            ldb,
+                                                              hipblasStride      strideB,
+                                                              const void*        beta,
+                                                              void*              C,
+                                                              hipblasDatatype_t  cType,
+                                                              int64_t            ldc,
+                                                              hipblasStride      strideC,
+                                                              int64_t            batchCount,
+                                                              hipblasDatatype_t  computeType,
+                                                              hipblasGemmAlgo_t  algo);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags(hipblasHandle_t    handle,
-                                                             hipblasOperation_t transA,
-                                                             hipblasOperation_t transB,
-                                                             int                m,
-                                                             int                n,
-                                                             int                k,
-                                                             const void*        alpha,
-                                                             const void*        A[],
-                                                             hipblasDatatype_t  aType,
-                                                             int                lda,
-                                                             const void*        B[],
-                                                             hipblasDatatype_t  bType,
-                                                             int                ldb,
-                                                             const void*        beta,
-                                                             void*              C[],
-                                                             hipblasDatatype_t  cType,
-                                                             int                ldc,
-                                                             int                batchCount,
-                                                             hipblasDatatype_t  computeType,
-                                                             hipblasGemmAlgo_t  algo,
-                                                             hipblasGemmFlags_t flags);
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
+                                                              hipblasOperation_t   transA,
+                                                              hipblasOperation_t   transB,
+                                                              int                  m,
+                                                              int                  n,
+                                                              int                  k,
+                                                              const void*          alpha,
+                                                              const void*          A,
+                                                              hipDataType          aType,
+                                                              int                  lda,
+                                                              hipblasStride        strideA,
+                                                              const void*          B,
+                                                              hipDataType          bType,
+                                                              int                  ldb,
+                                                              hipblasStride        strideB,
+                                                              const void*          beta,
+                                                              void*                C,
+                                                              hipDataType          cType,
+                                                              int                  ldc,
+                                                              hipblasStride        strideC,
+                                                              int                  batchCount,
+                                                              hipblasComputeType_t computeType,
+                                                              hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_v2_64(hipblasHandle_t      handle,
+                                                                 hipblasOperation_t   transA,
+                                                                 hipblasOperation_t   transB,
+                                                                 int64_t              m,
+                                                                 int64_t              n,
+                                                                 int64_t              k,
+                                                                 const void*          alpha,
+                                                                 const void*          A,
+                                                                 hipDataType          aType,
+                                                                 int64_t              lda,
+                                                                 hipblasStride        strideA,
+                                                                 const void*          B,
+                                                                 hipDataType          bType,
+                                                                 int64_t              ldb,
+                                                                 hipblasStride        strideB,
+                                                                 const void*          beta,
+                                                                 void*                C,
+                                                                 hipDataType          cType,
+                                                                 int64_t              ldc,
+                                                                 hipblasStride        strideC,
+                                                                 int64_t              batchCount,
+                                                                 hipblasComputeType_t computeType,
+                                                                 hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t    handle,
+                                                                    hipblasOperation_t transA,
+                                                                    hipblasOperation_t transB,
+                                                                    int                m,
+                                                                    int                n,
+                                                                    int                k,
+                                                                    const void*        alpha,
+                                                                    const void*        A,
+                                                                    hipblasDatatype_t  aType,
+                                                                    int                lda,
+                                                                    hipblasStride      strideA,
+                                                                    const void*        B,
+                                                                    hipblasDatatype_t  bType,
+                                                                    int                ldb,
+                                                                    hipblasStride      strideB,
+                                                                    const void*        beta,
+                                                                    void*              C,
+                                                                    hipblasDatatype_t  cType,
+                                                                    int                ldc,
+                                                                    hipblasStride      strideC,
+                                                                    int                batchCount,
+                                                                    hipblasDatatype_t  computeType,
+                                                                    hipblasGemmAlgo_t  algo,
+                                                                    hipblasGemmFlags_t flags);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithFlags_64(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int64_t            m,
+                                            int64_t            n,
+                                            int64_t            k,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  aType,
+                                            int64_t            lda,
+                                            hipblasStride      strideA,
+                                            const void*        B,
+                                            hipblasDatatype_t  bType,
+                                            int64_t            ldb,
+                                            hipblasStride      strideB,
+                                            const void*        beta,
+                                            void*              C,
+                                            hipblasDatatype_t  cType,
+                                            int64_t            ldc,
+                                            hipblasStride      strideC,
+                                            int64_t            batchCount,
+                                            hipblasDatatype_t  computeType,
+                                            hipblasGemmAlgo_t  algo,
+                                            hipblasGemmFlags_t flags);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t      handle,
-                                                                hipblasOperation_t   transA,
-                                                                hipblasOperation_t   transB,
-                                                                int                  m,
-                                                                int                  n,
-                                                                int                  k,
-                                                                const void*          alpha,
-                                                                const void*          A[],
-                                                                hipDataType          aType,
-                                                                int                  lda,
-                                                                const void*          B[],
-                                                                hipDataType          bType,
-                                                                int                  ldb,
-                                                                const void*          beta,
-                                                                void*                C[],
-                                                                hipDataType          cType,
-                                                                int                  ldc,
-                                                                int                  batchCount,
-                                                                hipblasComputeType_t computeType,
-                                                                hipblasGemmAlgo_t    algo,
-                                                                hipblasGemmFlags_t   flags);
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithFlags_v2(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transA,
+                                            hipblasOperation_t   transB,
+                                            int                  m,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          aType,
+                                            int                  lda,
+                                            hipblasStride        strideA,
+                                            const void*          B,
+                                            hipDataType          bType,
+                                            int                  ldb,
+                                            hipblasStride        strideB,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          cType,
+                                            int                  ldc,
+                                            hipblasStride        strideC,
+                                            int                  batchCount,
+                                            hipblasComputeType_t computeType,
+                                            hipblasGemmAlgo_t    algo,
+                                            hipblasGemmFlags_t   flags);
 
-/*! \brief BLAS EX API
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedExWithFlags_v2_64(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transA,
+                                               hipblasOperation_t   transB,
+                                               int64_t              m,
+                                               int64_t              n,
+                                               int64_t              k,
+                                               const void*          alpha,
+                                               const void*          A,
+                                               hipDataType          aType,
+                                               int64_t              lda,
+                                               hipblasStride        strideA,
+                                               const void*          B,
+                                               hipDataType          bType,
+                                               int64_t              ldb,
+                                               hipblasStride        strideB,
+                                               const void*          beta,
+                                               void*                C,
+                                               hipDataType          cType,
+                                               int64_t              ldc,
+                                               hipblasStride        strideC,
+                                               int64_t              batchCount,
+                                               hipblasComputeType_t computeType,
+                                               hipblasGemmAlgo_t    algo,
+                                               hipblasGemmFlags_t   flags);
+
+/*! BLAS EX API
 
     \details
-    gemmStridedBatchedEx performs one of the strided_batched matrix-matrix operations
+    gemmGroupedBatchedEx performs one of the matrix-matrix operations
 
-        C_i = alpha*op(A_i)*op(B_i) + beta*C_i, for i = 1, ..., batchCount
+        C_i = alpha_g*op( A_i )*op( B_i ) + beta_g*C_i, for i = 1, ..., batchCount
 
-    where op( X ) is one of
+    where the problems are split into groupCount groups, and every problem i of group g shares
+    that group's op( A ) and op( B ), dimensions m, n and k, leading dimensions and scalars
+    alpha_g and beta_g. op( X ) is one of
 
         op( X ) = X      or
         op( X ) = X**T   or
         op( X ) = X**H,
 
-    alpha and beta are scalars, and A, B, and C are strided_batched matrices, with
-    op( A ) an m by k by batchCount strided_batched matrix,
-    op( B ) a k by n by batchCount strided_batched matrix and
-    C a m by n by batchCount strided_batched matrix.
+    Group g holds groupSize[g] consecutive problems, so A, B and C point to
+    batchCount = groupSize[0] + ... + groupSize[groupCount - 1] matrices each. This allows GEMMs
+    of many different shapes to be issued with one call.
 
-    The strided_batched matrices are multiple matrices separated by a constant stride.
-    The number of matrices is batchCount.
+    Supported types are the same as for hipblasGemmEx with hipDataType and hipblasComputeType_t.
 
-    - Supported types are determined by the backend. See rocBLAS/cuBLAS documentation.
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transAArray [const hipblasOperation_t*]
+              host array of groupCount operations op( A ), one for each group.
+    @param[in]
+    transBArray [const hipblasOperation_t*]
+              host array of groupCount operations op( B ), one for each group.
+    @param[in]
+    mArray    [const int*]
+              host array of groupCount matrix dimensions m.
+    @param[in]
+    nArray    [const int*]
+              host array of groupCount matrix dimensions n.
+    @param[in]
+    kArray    [const int*]
+              host array of groupCount matrix dimensions k.
+    @param[in]
+    alphaArray [const void *]
+              host or device array, following the pointer mode, of groupCount scalars alpha,
+              one for each group. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device array of device pointers to each matrix A_i.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    ldaArray  [const int*]
+              host array of groupCount leading dimensions of the A_i.
+    @param[in]
+    B         [void *]
+              device array of device pointers to each matrix B_i.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldbArray  [const int*]
+              host array of groupCount leading dimensions of the B_i.
+    @param[in]
+    betaArray [const void *]
+              host or device array, following the pointer mode, of groupCount scalars beta,
+              one for each group. Same datatype as computeType.
+    @param[in]
+    C         [void *]
+              device array of device pointers to each matrix C_i.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of each matrix C_i.
+    @param[in]
+    ldcArray  [const int*]
+              host array of groupCount leading dimensions of the C_i.
+    @param[in]
+    groupCount
+              [int]
+              number of groups.
+    @param[in]
+    groupSize [const int*]
+              host array of groupCount numbers of gemm operations in each group.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
 
-    hipblasGemmStridedBatchedExWithFlags is also available which is identical to hipblasStridedBatchedGemmEx
-    with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
-    rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedBatchedEx(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t transAArray[],
+                                                           const hipblasOperation_t transBArray[],
+                                                           const int                mArray[],
+                                                           const int                nArray[],
+                                                           const int                kArray[],
+                                                           const void*              alphaArray,
+                                                           const void* const        A[],
+                                                           hipDataType              aType,
+                                                           const int                ldaArray[],
+                                                           const void* const        B[],
+                                                           hipDataType              bType,
+                                                           const int                ldbArray[],
+                                                           const void*              betaArray,
+                                                           void* const              C[],
+                                                           hipDataType              cType,
+                                                           const int                ldcArray[],
+                                                           int                      groupCount,
+                                                           const int                groupSize[],
+                                                           hipblasComputeType_t     computeType);
 
-    With HIPBLAS_V2 define, hipblasGemmStridedBatchedEx accepts hipDataType for aType, bType, and cType.
-    It also accepts hipblasComputeType_t for computeType. hipblasGemmStridedBatchedEx will no
-    longer support hipblasDataType_t for these parameters in a future release. hipblasGemmStridedBatchedExWithFlags
-    follows the same convention.
+/*! BLAS EX API
 
-        #ifdef HIPBLAS_V2 // available in hipBLAS version 2.0.0 and later with -DHIPBLAS_V2
+    \details
+    gemmExWithEpilogue performs the matrix-matrix operation
 
-            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t      handle,
-                                                        hipblasOperation_t   transA,
-                                                        hipblasOperation_t   transB,
-                                                        int                  m,
-                                                        int                  n,
-                                                        int                  k,
-                                                        const void*          alpha,
-                                                        const void*          A,
-                                                        hipDataType          aType,
-                                                        int                  lda,
-                                                        hipblasStride        strideA,
-                                                        const void*          B,
-                                                        hipDataType          bType,
-                                                        int                  ldb,
-                                                        hipblasStride        strideB,
-                                                        const void*          beta,
-                                                        void*                C,
-                                                        hipDataType          cType,
-                                                        int                  ldc,
-                                                        hipblasStride        strideC,
-                                                        int                  batchCount,
-                                                        hipblasComputeType_t computeType,
-                                                        hipblasGemmAlgo_t    algo)
+        D = epilogue( alpha*op( A )*op( B ) + beta*C ),
 
-            hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t      handle,
-                                                                 hipblasOperation_t   transA,
-                                                                 hipblasOperation_t   transB,
-                                                                 int                  m,
-                                                                 int                  n,
-                                                                 int                  k,
-                                                                 const void*          alpha,
-                                                                 const void*          A,
-                                                                 hipDataType          aType,
-                                                                 int                  lda,
-                                                                 hipblasStride        strideA,
-                                                                 const void*          B,
-                                                                 hipDataType          bType,
-                                                                 int                  ldb,
-                                                                 hipblasStride        strideB,
-                                                                 const void*          beta,
-                                                                 void*                C,
-                                                                 hipDataType          cType,
-                                                                 int                  ldc,
-                                                                 hipblasStride        strideC,
-                                                                 int                  batchCount,
-                                                                 hipblasComputeType_t computeType,
-                                                                 hipblasGemmAlgo_t    algo,
-                                                                 hipblasGemmFlags_t   flags)
+    where the epilogue described by hipblasGemmEpilogue_t scales the rows or columns of the
+    result, adds a bias vector to every column, applies an activation function and converts the
+    result to the datatype of D. The epilogue replaces the separate kernels otherwise issued after
+    the GEMM, so the result is read and written once:
 
-        #else // [DEPRECATED]
+        D(i, j) = activation( scale * (alpha*op( A )*op( B ) + beta*C)(i, j) + bias[i] ).
 
-            hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                                        hipblasOperation_t transA,
-                                                        hipblasOperation_t transB,
-                                                        int                m,
-                                                        int                n,
-                                                        int                k,
-                                                        const void*        alpha,
-                                                        const void*        A,
-                                                        hipblasDatatype_t  aType,
-                                                        int                lda,
-                                                        hipblasStride      strideA,
-                                                        const void*        B,
-                                                        hipblasDatatype_t  bType,
-                                                        int                ldb,
-                                                        hipblasStride      strideB,
-                                                        const void*        beta,
-                                                        void*              C,
-                                                        hipblasDatatype_t  cType,
-                                                        int                ldc,
-                                                        hipblasStride      strideC,
-                                                        int                batchCount,
-                                                        hipblasDatatype_t  computeType,
-                                                        hipblasGemmAlgo_t  algo)
+    op( X ) is one of op( X ) = X, op( X ) = X**T or op( X ) = X**H. alpha and beta are scalars,
+    op( A ) is an m by k matrix, op( B ) a k by n matrix and C and D are m by n matrices.
 
-            hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t      handle,
-                                                                 hipblasOperation_t   transA,
-                                                                 hipblasOperation_t   transB,
-                                                                 int                  m,
-                                                                 int                  n,
-                                                                 int                  k,
-                                                                 const void*          alpha,
-                                                                 const void*          A,
-                                                                 hipblasDatatype_t    aType,
-                                                                 int                  lda,
-                                                                 hipblasStride        strideA,
-                                                                 const void*          B,
-                                                                 hipblasDatatype_t    bType,
-                                                                 int                  ldb,
-                                                                 hipblasStride        strideB,
-                                                                 const void*          beta,
-                                                                 void*                C,
-                                                                 hipblasDatatype_t    cType,
-                                                                 int                  ldc,
-                                                                 hipblasStride        strideC,
-                                                                 int                  batchCount,
-                                                                 hipblasDatatype_t    computeType,
-                                                                 hipblasGemmAlgo_t    algo,
-                                                                 hipblasGemmFlags_t   flags)
+    When epilogue->D is NULL the result is written to C. When D has a different datatype than C,
+    C is used as the intermediate result and is overwritten.
+
+    Supported types are those of hipblasGemmExWithFlags, with cType and dType one of
+    HIP_R_16F, HIP_R_16BF, HIP_R_32F and HIP_R_64F when the epilogue does more than a plain GEMM.
+
+    With the rocBLAS backend, the epilogue runs as a single pass over the result following the GEMM.
+    With the cuBLAS backend, bias and activation are fused into the GEMM through cuBLASLt; scaling
+    and a dType different from cType return HIPBLAS_STATUS_NOT_SUPPORTED.
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType    [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    B         [void *]
+              device pointer storing matrix B.
+    @param[in]
+    bType    [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[inout]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType    [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+    @param[in]
+    flags     [hipblasGemmFlags_t]
+              optional gemm flags.
+    @param[in]
+    epilogue  [const hipblasGemmEpilogue_t *]
+              host pointer to the epilogue, or NULL for a plain GEMM.
 
-        #endif
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t              handle,
+                                                         hipblasOperation_t           transA,
+                                                         hipblasOperation_t           transB,
+                                                         int                          m,
+                                                         int                          n,
+                                                         int                          k,
+                                                         const void*                  alpha,
+                                                         const void*                  A,
+                                                         hipDataType                  aType,
+                                                         int                          lda,
+                                                         const void*                  B,
+                                                         hipDataType                  bType,
+                                                         int                          ldb,
+                                                         const void*                  beta,
+                                                         void*                        C,
+                                                         hipDataType                  cType,
+                                                         int                          ldc,
+                                                         hipblasComputeType_t         computeType,
+                                                         hipblasGemmAlgo_t            algo,
+                                                         hipblasGemmFlags_t           flags,
+                                                         const hipblasGemmEpilogue_t* epilogue);
+
+/*! BLAS EX API
+
+    \details
+    gemmStridedBatchedExWithEpilogue performs the matrix-matrix operations
+
+        D_i = epilogue( alpha*op( A_i )*op( B_i ) + beta*C_i ), for i = 1, ..., batchCount
+
+    with the epilogue of hipblasGemmExWithEpilogue. The scale and bias vectors of problem i are
+    found at strides strideScale and strideBias of the first ones, and D_i at stride strideD of
+    D; a stride of 0 shares one vector across the batch.
 
     @param[in]
     handle    [hipblasHandle_t]
@@ -22043,10 +27165,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t
     A         [void *]
               device pointer pointing to first matrix A_1.
     @param[in]
-    aType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix A_i.\n
-    [hipDataType]
+    aType    [hipDataType]
               specifies the datatype of each matrix A_i.
     @param[in]
     lda       [int]
@@ -22058,10 +27177,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t
     B         [void *]
               device pointer pointing to first matrix B_1.
     @param[in]
-    bType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix B_i.\n
-    [hipDataType]
+    bType    [hipDataType]
               specifies the datatype of each matrix B_i.
     @param[in]
     ldb       [int]
@@ -22072,14 +27188,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t
     @param[in]
     beta      [const void *]
               device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
-    @param[in]
+    @param[inout]
     C         [void *]
               device pointer pointing to first matrix C_1.
     @param[in]
-    cType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of each matrix C_i.\n
-    [hipDataType]
+    cType    [hipDataType]
               specifies the datatype of each matrix C_i.
     @param[in]
     ldc       [int]
@@ -22093,113 +27206,45 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithFlags_v2(hipblasHandle_t
               number of gemm operations in the batch.
     @param[in]
     computeType
-    [hipblasDatatype_t] [DEPRECATED]
-              specifies the datatype of computation.\n
-    [hipblasComputeType_t]
+              [hipblasComputeType_t]
               specifies the datatype of computation.
     @param[in]
     algo      [hipblasGemmAlgo_t]
               enumerant specifying the algorithm type.
+    @param[in]
+    flags     [hipblasGemmFlags_t]
+              optional gemm flags.
+    @param[in]
+    epilogue  [const hipblasGemmEpilogue_t *]
+              host pointer to the epilogue, or NULL for a plain GEMM.
 
     ********************************************************************/
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
-                                                           hipblasOperation_t transA,
-                                                           hipblasOperation_t transB,
-                                                           int                m,
-                                                           int                n,
-                                                           int                k,
-                                                           const void*        alpha,
-                                                           const void*        A,
-                                                           hipblasDatatype_t  aType,
-                                                           int                lda,
-                                                           hipblasStride      strideA,
-                                                           const void*        B,
-                                                           hipblasDatatype_t  bType,
-                                                           int                ldb,
-                                                           hipblasStride      strideB,
-                                                           const void*        beta,
-                                                           void*              C,
-                                                           hipblasDatatype_t  cType,
-                                                           int                ldc,
-                                                           hipblasStride      strideC,
-                                                           int                batchCount,
-                                                           hipblasDatatype_t  computeType,
-                                                           hipblasGemmAlgo_t  algo);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx_v2(hipblasHandle_t      handle,
-                                                              hipblasOperation_t   transA,
-                                                              hipblasOperation_t   transB,
-                                                              int                  m,
-                                                              int                  n,
-                                                              int                  k,
-                                                              const void*          alpha,
-                                                              const void*          A,
-                                                              hipDataType          aType,
-                                                              int                  lda,
-                                                              hipblasStride        strideA,
-                                                              const void*          B,
-                                                              hipDataType          bType,
-                                                              int                  ldb,
-                                                              hipblasStride        strideB,
-                                                              const void*          beta,
-                                                              void*                C,
-                                                              hipDataType          cType,
-                                                              int                  ldc,
-                                                              hipblasStride        strideC,
-                                                              int                  batchCount,
-                                                              hipblasComputeType_t computeType,
-                                                              hipblasGemmAlgo_t    algo);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExWithFlags(hipblasHandle_t    handle,
-                                                                    hipblasOperation_t transA,
-                                                                    hipblasOperation_t transB,
-                                                                    int                m,
-                                                                    int                n,
-                                                                    int                k,
-                                                                    const void*        alpha,
-                                                                    const void*        A,
-                                                                    hipblasDatatype_t  aType,
-                                                                    int                lda,
-                                                                    hipblasStride      strideA,
-                                                                    const void*        B,
-                                                                    hipblasDatatype_t  bType,
-                                                                    int                ldb,
-                                                                    hipblasStride      strideB,
-                                                                    const void*        beta,
-                                                                    void*              C,
-                                                                    hipblasDatatype_t  cType,
-                                                                    int                ldc,
-                                                                    hipblasStride      strideC,
-                                                                    int                batchCount,
-                                                                    hipblasDatatype_t  computeType,
-                                                                    hipblasGemmAlgo_t  algo,
-                                                                    hipblasGemmFlags_t flags);
-
 HIPBLAS_EXPORT hipblasStatus_t
-    hipblasGemmStridedBatchedExWithFlags_v2(hipblasHandle_t      handle,
-                                            hipblasOperation_t   transA,
-                                            hipblasOperation_t   transB,
-                                            int                  m,
-                                            int                  n,
-                                            int                  k,
-                                            const void*          alpha,
-                                            const void*          A,
-                                            hipDataType          aType,
-                                            int                  lda,
-                                            hipblasStride        strideA,
-                                            const void*          B,
-                                            hipDataType          bType,
-                                            int                  ldb,
-                                            hipblasStride        strideB,
-                                            const void*          beta,
-                                            void*                C,
-                                            hipDataType          cType,
-                                            int                  ldc,
-                                            hipblasStride        strideC,
-                                            int                  batchCount,
-                                            hipblasComputeType_t computeType,
-                                            hipblasGemmAlgo_t    algo,
-                                            hipblasGemmFlags_t   flags);
+    hipblasGemmStridedBatchedExWithEpilogue(hipblasHandle_t              handle,
+                                            hipblasOperation_t           transA,
+                                            hipblasOperation_t           transB,
+                                            int                          m,
+                                            int                          n,
+                                            int                          k,
+                                            const void*                  alpha,
+                                            const void*                  A,
+                                            hipDataType                  aType,
+                                            int                          lda,
+                                            hipblasStride                strideA,
+                                            const void*                  B,
+                                            hipDataType                  bType,
+                                            int                          ldb,
+                                            hipblasStride                strideB,
+                                            const void*                  beta,
+                                            void*                        C,
+                                            hipDataType                  cType,
+                                            int                          ldc,
+                                            hipblasStride                strideC,
+                                            int                          batchCount,
+                                            hipblasComputeType_t         computeType,
+                                            hipblasGemmAlgo_t            algo,
+                                            hipblasGemmFlags_t           flags,
+                                            const hipblasGemmEpilogue_t* epilogue);
 
 /*! BLAS EX API
 
@@ -22934,6 +27979,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
                                              int               incy,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       alpha,
+                                                hipblasDatatype_t alphaType,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                void*             y,
+                                                hipblasDatatype_t yType,
+                                                int64_t           incy,
+                                                hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
                                                 int             n,
                                                 const void*     alpha,
@@ -22946,6 +28003,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx_v2(hipblasHandle_t handle,
                                                 int             incy,
                                                 hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx_v2_64(hipblasHandle_t handle,
+                                                   int64_t         n,
+                                                   const void*     alpha,
+                                                   hipDataType     alphaType,
+                                                   const void*     x,
+                                                   hipDataType     xType,
+                                                   int64_t         incx,
+                                                   void*           y,
+                                                   hipDataType     yType,
+                                                   int64_t         incy,
+                                                   hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -23052,6 +28121,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
                                                     int               batchCount,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       alpha,
+                                                       hipblasDatatype_t alphaType,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       void*             y,
+                                                       hipblasDatatype_t yType,
+                                                       int64_t           incy,
+                                                       int64_t           batchCount,
+                                                       hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
                                                        int             n,
                                                        const void*     alpha,
@@ -23065,6 +28147,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx_v2(hipblasHandle_t handle,
                                                        int             batchCount,
                                                        hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx_v2_64(hipblasHandle_t handle,
+                                                          int64_t         n,
+                                                          const void*     alpha,
+                                                          hipDataType     alphaType,
+                                                          const void*     x,
+                                                          hipDataType     xType,
+                                                          int64_t         incx,
+                                                          void*           y,
+                                                          hipDataType     yType,
+                                                          int64_t         incy,
+                                                          int64_t         batchCount,
+                                                          hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -23189,6 +28284,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   han
                                                            int               batchCount,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       alpha,
+                                                              hipblasDatatype_t alphaType,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              void*             y,
+                                                              hipblasDatatype_t yType,
+                                                              int64_t           incy,
+                                                              hipblasStride     stridey,
+                                                              int64_t           batchCount,
+                                                              hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t handle,
                                                               int             n,
                                                               const void*     alpha,
@@ -23204,6 +28314,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx_v2(hipblasHandle_t ha
                                                               int             batchCount,
                                                               hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                 int64_t         n,
+                                                                 const void*     alpha,
+                                                                 hipDataType     alphaType,
+                                                                 const void*     x,
+                                                                 hipDataType     xType,
+                                                                 int64_t         incx,
+                                                                 hipblasStride   stridex,
+                                                                 void*           y,
+                                                                 hipDataType     yType,
+                                                                 int64_t         incy,
+                                                                 hipblasStride   stridey,
+                                                                 int64_t         batchCount,
+                                                                 hipDataType     executionType);
+
 /*! @{
     \brief BLAS EX API
 
@@ -23311,6 +28436,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t resultType,
                                             hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               const void*       x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               const void*       y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               void*             result,
+                                               hipblasDatatype_t resultType,
+                                               hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                                              int               n,
                                              const void*       x,
@@ -23322,6 +28459,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
                                              void*             result,
                                              hipblasDatatype_t resultType,
                                              hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                const void*       y,
+                                                hipblasDatatype_t yType,
+                                                int64_t           incy,
+                                                void*             result,
+                                                hipblasDatatype_t resultType,
+                                                hipblasDatatype_t executionType);
 //! @}
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
@@ -23336,6 +28485,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx_v2(hipblasHandle_t handle,
                                                hipDataType     resultType,
                                                hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  const void*     x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  const void*     y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  void*           result,
+                                                  hipDataType     resultType,
+                                                  hipDataType     executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
                                                 int             n,
                                                 const void*     x,
@@ -23348,6 +28509,18 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx_v2(hipblasHandle_t handle,
                                                 hipDataType     resultType,
                                                 hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx_v2_64(hipblasHandle_t handle,
+                                                   int64_t         n,
+                                                   const void*     x,
+                                                   hipDataType     xType,
+                                                   int64_t         incx,
+                                                   const void*     y,
+                                                   hipDataType     yType,
+                                                   int64_t         incy,
+                                                   void*           result,
+                                                   hipDataType     resultType,
+                                                   hipDataType     executionType);
+
 /*! @{
     \brief BLAS EX API
 
@@ -23464,6 +28637,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
                                                    hipblasDatatype_t resultType,
                                                    hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx_64(hipblasHandle_t   handle,
+                                                      int64_t           n,
+                                                      const void*       x,
+                                                      hipblasDatatype_t xType,
+                                                      int64_t           incx,
+                                                      const void*       y,
+                                                      hipblasDatatype_t yType,
+                                                      int64_t           incy,
+                                                      int64_t           batchCount,
+                                                      void*             result,
+                                                      hipblasDatatype_t resultType,
+                                                      hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                                     int               n,
                                                     const void*       x,
@@ -23476,6 +28662,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
                                                     void*             result,
                                                     hipblasDatatype_t resultType,
                                                     hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       const void*       y,
+                                                       hipblasDatatype_t yType,
+                                                       int64_t           incy,
+                                                       int64_t           batchCount,
+                                                       void*             result,
+                                                       hipblasDatatype_t resultType,
+                                                       hipblasDatatype_t executionType);
 //! @}
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
@@ -23491,6 +28690,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx_v2(hipblasHandle_t handle,
                                                       hipDataType     resultType,
                                                       hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx_v2_64(hipblasHandle_t handle,
+                                                         int64_t         n,
+                                                         const void*     x,
+                                                         hipDataType     xType,
+                                                         int64_t         incx,
+                                                         const void*     y,
+                                                         hipDataType     yType,
+                                                         int64_t         incy,
+                                                         int64_t         batchCount,
+                                                         void*           result,
+                                                         hipDataType     resultType,
+                                                         hipDataType     executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
                                                        int             n,
                                                        const void*     x,
@@ -23504,6 +28716,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx_v2(hipblasHandle_t handle,
                                                        hipDataType     resultType,
                                                        hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx_v2_64(hipblasHandle_t handle,
+                                                          int64_t         n,
+                                                          const void*     x,
+                                                          hipDataType     xType,
+                                                          int64_t         incx,
+                                                          const void*     y,
+                                                          hipDataType     yType,
+                                                          int64_t         incy,
+                                                          int64_t         batchCount,
+                                                          void*           result,
+                                                          hipDataType     resultType,
+                                                          hipDataType     executionType);
+
 /*! @{
     \brief BLAS EX API
 
@@ -23632,6 +28857,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   hand
                                                           hipblasDatatype_t resultType,
                                                           hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                             int64_t           n,
+                                                             const void*       x,
+                                                             hipblasDatatype_t xType,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             const void*       y,
+                                                             hipblasDatatype_t yType,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             int64_t           batchCount,
+                                                             void*             result,
+                                                             hipblasDatatype_t resultType,
+                                                             hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
                                                            int               n,
                                                            const void*       x,
@@ -23646,6 +28886,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   han
                                                            void*             result,
                                                            hipblasDatatype_t resultType,
                                                            hipblasDatatype_t executionType);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              const void*       y,
+                                                              hipblasDatatype_t yType,
+                                                              int64_t           incy,
+                                                              hipblasStride     stridey,
+                                                              int64_t           batchCount,
+                                                              void*             result,
+                                                              hipblasDatatype_t resultType,
+                                                              hipblasDatatype_t executionType);
 //! @}
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t handle,
@@ -23663,6 +28918,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx_v2(hipblasHandle_t han
                                                              hipDataType     resultType,
                                                              hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                int64_t         n,
+                                                                const void*     x,
+                                                                hipDataType     xType,
+                                                                int64_t         incx,
+                                                                hipblasStride   stridex,
+                                                                const void*     y,
+                                                                hipDataType     yType,
+                                                                int64_t         incy,
+                                                                hipblasStride   stridey,
+                                                                int64_t         batchCount,
+                                                                void*           result,
+                                                                hipDataType     resultType,
+                                                                hipDataType     executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t handle,
                                                               int             n,
                                                               const void*     x,
@@ -23678,6 +28948,21 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx_v2(hipblasHandle_t ha
                                                               hipDataType     resultType,
                                                               hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                 int64_t         n,
+                                                                 const void*     x,
+                                                                 hipDataType     xType,
+                                                                 int64_t         incx,
+                                                                 hipblasStride   stridex,
+                                                                 const void*     y,
+                                                                 hipDataType     yType,
+                                                                 int64_t         incy,
+                                                                 hipblasStride   stridey,
+                                                                 int64_t         batchCount,
+                                                                 void*           result,
+                                                                 hipDataType     resultType,
+                                                                 hipDataType     executionType);
+
 /*! \brief BLAS_EX API
 
     \details
@@ -23759,6 +29044,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
                                              hipblasDatatype_t resultType,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                void*             result,
+                                                hipblasDatatype_t resultType,
+                                                hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
                                                 int             n,
                                                 const void*     x,
@@ -23768,6 +29062,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex_v2(hipblasHandle_t handle,
                                                 hipDataType     resultType,
                                                 hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex_v2_64(hipblasHandle_t handle,
+                                                   int64_t         n,
+                                                   const void*     x,
+                                                   hipDataType     xType,
+                                                   int64_t         incx,
+                                                   void*           result,
+                                                   hipDataType     resultType,
+                                                   hipDataType     executionType);
+
 /*! \brief BLAS_EX API
 
     \details
@@ -23856,6 +29159,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
                                                     hipblasDatatype_t resultType,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       int64_t           batchCount,
+                                                       void*             result,
+                                                       hipblasDatatype_t resultType,
+                                                       hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
                                                        int             n,
                                                        const void*     x,
@@ -23866,6 +29179,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx_v2(hipblasHandle_t handle,
                                                        hipDataType     resultType,
                                                        hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx_v2_64(hipblasHandle_t handle,
+                                                          int64_t         n,
+                                                          const void*     x,
+                                                          hipDataType     xType,
+                                                          int64_t         incx,
+                                                          int64_t         batchCount,
+                                                          void*           result,
+                                                          hipDataType     resultType,
+                                                          hipDataType     executionType);
+
 /*! \brief BLAS_EX API
 
     \details
@@ -23963,6 +29286,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   han
                                                            hipblasDatatype_t resultType,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              int64_t           batchCount,
+                                                              void*             result,
+                                                              hipblasDatatype_t resultType,
+                                                              hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t handle,
                                                               int             n,
                                                               const void*     x,
@@ -23974,6 +29308,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx_v2(hipblasHandle_t ha
                                                               hipDataType     resultType,
                                                               hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                 int64_t         n,
+                                                                 const void*     x,
+                                                                 hipDataType     xType,
+                                                                 int64_t         incx,
+                                                                 hipblasStride   stridex,
+                                                                 int64_t         batchCount,
+                                                                 void*           result,
+                                                                 hipDataType     resultType,
+                                                                 hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -24085,6 +29430,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
                                             hipblasDatatype_t csType,
                                             hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx_64(hipblasHandle_t   handle,
+                                               int64_t           n,
+                                               void*             x,
+                                               hipblasDatatype_t xType,
+                                               int64_t           incx,
+                                               void*             y,
+                                               hipblasDatatype_t yType,
+                                               int64_t           incy,
+                                               const void*       c,
+                                               const void*       s,
+                                               hipblasDatatype_t csType,
+                                               hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
                                                int             n,
                                                void*           x,
@@ -24098,6 +29456,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx_v2(hipblasHandle_t handle,
                                                hipDataType     csType,
                                                hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx_v2_64(hipblasHandle_t handle,
+                                                  int64_t         n,
+                                                  void*           x,
+                                                  hipDataType     xType,
+                                                  int64_t         incx,
+                                                  void*           y,
+                                                  hipDataType     yType,
+                                                  int64_t         incy,
+                                                  const void*     c,
+                                                  const void*     s,
+                                                  hipDataType     csType,
+                                                  hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -24215,6 +29586,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
                                                    int               batchCount,
                                                    hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx_64(hipblasHandle_t   handle,
+                                                      int64_t           n,
+                                                      void*             x,
+                                                      hipblasDatatype_t xType,
+                                                      int64_t           incx,
+                                                      void*             y,
+                                                      hipblasDatatype_t yType,
+                                                      int64_t           incy,
+                                                      const void*       c,
+                                                      const void*       s,
+                                                      hipblasDatatype_t csType,
+                                                      int64_t           batchCount,
+                                                      hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
                                                       int             n,
                                                       void*           x,
@@ -24229,6 +29614,20 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx_v2(hipblasHandle_t handle,
                                                       int             batchCount,
                                                       hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx_v2_64(hipblasHandle_t handle,
+                                                         int64_t         n,
+                                                         void*           x,
+                                                         hipDataType     xType,
+                                                         int64_t         incx,
+                                                         void*           y,
+                                                         hipDataType     yType,
+                                                         int64_t         incy,
+                                                         const void*     c,
+                                                         const void*     s,
+                                                         hipDataType     csType,
+                                                         int64_t         batchCount,
+                                                         hipDataType     executionType);
+
 /*! \brief BLAS Level 1 API
 
     \details
@@ -24358,6 +29757,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   hand
                                                           int               batchCount,
                                                           hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                             int64_t           n,
+                                                             void*             x,
+                                                             hipblasDatatype_t xType,
+                                                             int64_t           incx,
+                                                             hipblasStride     stridex,
+                                                             void*             y,
+                                                             hipblasDatatype_t yType,
+                                                             int64_t           incy,
+                                                             hipblasStride     stridey,
+                                                             const void*       c,
+                                                             const void*       s,
+                                                             hipblasDatatype_t csType,
+                                                             int64_t           batchCount,
+                                                             hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t handle,
                                                              int             n,
                                                              void*           x,
@@ -24374,6 +29789,22 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx_v2(hipblasHandle_t han
                                                              int             batchCount,
                                                              hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                int64_t         n,
+                                                                void*           x,
+                                                                hipDataType     xType,
+                                                                int64_t         incx,
+                                                                hipblasStride   stridex,
+                                                                void*           y,
+                                                                hipDataType     yType,
+                                                                int64_t         incy,
+                                                                hipblasStride   stridey,
+                                                                const void*     c,
+                                                                const void*     s,
+                                                                hipDataType     csType,
+                                                                int64_t         batchCount,
+                                                                hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -24453,6 +29884,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
                                              int               incx,
                                              hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx_64(hipblasHandle_t   handle,
+                                                int64_t           n,
+                                                const void*       alpha,
+                                                hipblasDatatype_t alphaType,
+                                                void*             x,
+                                                hipblasDatatype_t xType,
+                                                int64_t           incx,
+                                                hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
                                                 int             n,
                                                 const void*     alpha,
@@ -24462,6 +29902,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx_v2(hipblasHandle_t handle,
                                                 int             incx,
                                                 hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx_v2_64(hipblasHandle_t handle,
+                                                   int64_t         n,
+                                                   const void*     alpha,
+                                                   hipDataType     alphaType,
+                                                   void*           x,
+                                                   hipDataType     xType,
+                                                   int64_t         incx,
+                                                   hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -24547,6 +29996,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
                                                     int               batchCount,
                                                     hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx_64(hipblasHandle_t   handle,
+                                                       int64_t           n,
+                                                       const void*       alpha,
+                                                       hipblasDatatype_t alphaType,
+                                                       void*             x,
+                                                       hipblasDatatype_t xType,
+                                                       int64_t           incx,
+                                                       int64_t           batchCount,
+                                                       hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
                                                        int             n,
                                                        const void*     alpha,
@@ -24557,6 +30016,16 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx_v2(hipblasHandle_t handle,
                                                        int             batchCount,
                                                        hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx_v2_64(hipblasHandle_t handle,
+                                                          int64_t         n,
+                                                          const void*     alpha,
+                                                          hipDataType     alphaType,
+                                                          void*           x,
+                                                          hipDataType     xType,
+                                                          int64_t         incx,
+                                                          int64_t         batchCount,
+                                                          hipDataType     executionType);
+
 /*! \brief BLAS EX API
 
     \details
@@ -24652,6 +30121,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   han
                                                            int               batchCount,
                                                            hipblasDatatype_t executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_64(hipblasHandle_t   handle,
+                                                              int64_t           n,
+                                                              const void*       alpha,
+                                                              hipblasDatatype_t alphaType,
+                                                              void*             x,
+                                                              hipblasDatatype_t xType,
+                                                              int64_t           incx,
+                                                              hipblasStride     stridex,
+                                                              int64_t           batchCount,
+                                                              hipblasDatatype_t executionType);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t handle,
                                                               int             n,
                                                               const void*     alpha,
@@ -24663,6 +30143,17 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t ha
                                                               int             batchCount,
                                                               hipDataType     executionType);
 
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t handle,
+                                                                 int64_t         n,
+                                                                 const void*     alpha,
+                                                                 hipDataType     alphaType,
+                                                                 void*           x,
+                                                                 hipDataType     xType,
+                                                                 int64_t         incx,
+                                                                 hipblasStride   stridex,
+                                                                 int64_t         batchCount,
+                                                                 hipDataType     executionType);
+
 #ifdef HIPBLAS_V2
 
 // HIPBLAS_V2 Ex functions using hipDataType
@@ -25140,6 +30631,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t ha
 #define hipblasCgetrfStridedBatched hipblasCgetrfStridedBatched_v2
 #define hipblasZgetrfStridedBatched hipblasZgetrfStridedBatched_v2
 
+#define hipblasCgetrfRect hipblasCgetrfRect_v2
+#define hipblasZgetrfRect hipblasZgetrfRect_v2
+
+#define hipblasCgetrfRectBatched hipblasCgetrfRectBatched_v2
+#define hipblasZgetrfRectBatched hipblasZgetrfRectBatched_v2
+
+#define hipblasCgetrfRectStridedBatched hipblasCgetrfRectStridedBatched_v2
+#define hipblasZgetrfRectStridedBatched hipblasZgetrfRectStridedBatched_v2
+
 #define hipblasCgetrs hipblasCgetrs_v2
 #define hipblasZgetrs hipblasZgetrs_v2
 
@@ -25149,9 +30649,15 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t ha
 #define hipblasCgetrsStridedBatched hipblasCgetrsStridedBatched_v2
 #define hipblasZgetrsStridedBatched hipblasZgetrsStridedBatched_v2
 
+#define hipblasCgetri hipblasCgetri_v2
+#define hipblasZgetri hipblasZgetri_v2
+
 #define hipblasCgetriBatched hipblasCgetriBatched_v2
 #define hipblasZgetriBatched hipblasZgetriBatched_v2
 
+#define hipblasCgetriStridedBatched hipblasCgetriStridedBatched_v2
+#define hipblasZgetriStridedBatched hipblasZgetriStridedBatched_v2
+
 #define hipblasCgels hipblasCgels_v2
 #define hipblasZgels hipblasZgels_v2
 
@@ -25170,6 +30676,183 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2(hipblasHandle_t ha
 #define hipblasCgeqrfStridedBatched hipblasCgeqrfStridedBatched_v2
 #define hipblasZgeqrfStridedBatched hipblasZgeqrfStridedBatched_v2
 
+#define hipblasCpotrf hipblasCpotrf_v2
+#define hipblasZpotrf hipblasZpotrf_v2
+
+#define hipblasCpotrfBatched hipblasCpotrfBatched_v2
+#define hipblasZpotrfBatched hipblasZpotrfBatched_v2
+
+#define hipblasCpotrfStridedBatched hipblasCpotrfStridedBatched_v2
+#define hipblasZpotrfStridedBatched hipblasZpotrfStridedBatched_v2
+
+#define hipblasCpotrs hipblasCpotrs_v2
+#define hipblasZpotrs hipblasZpotrs_v2
+
+#define hipblasCpotrsBatched hipblasCpotrsBatched_v2
+#define hipblasZpotrsBatched hipblasZpotrsBatched_v2
+
+#define hipblasCpotrsStridedBatched hipblasCpotrsStridedBatched_v2
+#define hipblasZpotrsStridedBatched hipblasZpotrsStridedBatched_v2
+
+#define hipblasZCgesv hipblasZCgesv_v2
+#define hipblasZCgesvBatched hipblasZCgesvBatched_v2
+#define hipblasZCgesvStridedBatched hipblasZCgesvStridedBatched_v2
+
+// HIPBLAS_V2 ILP64 functions
+#define hipblasGemmEx_64 hipblasGemmEx_v2_64
+#define hipblasGemmBatchedEx_64 hipblasGemmBatchedEx_v2_64
+#define hipblasGemmStridedBatchedEx_64 hipblasGemmStridedBatchedEx_v2_64
+
+#define hipblasGemmExWithFlags_64 hipblasGemmExWithFlags_v2_64
+#define hipblasGemmBatchedExWithFlags_64 hipblasGemmBatchedExWithFlags_v2_64
+#define hipblasGemmStridedBatchedExWithFlags_64 hipblasGemmStridedBatchedExWithFlags_v2_64
+
+#define hipblasAxpyEx_64 hipblasAxpyEx_v2_64
+#define hipblasAxpyBatchedEx_64 hipblasAxpyBatchedEx_v2_64
+#define hipblasAxpyStridedBatchedEx_64 hipblasAxpyStridedBatchedEx_v2_64
+
+#define hipblasDotEx_64 hipblasDotEx_v2_64
+#define hipblasDotcEx_64 hipblasDotcEx_v2_64
+#define hipblasDotBatchedEx_64 hipblasDotBatchedEx_v2_64
+#define hipblasDotcBatchedEx_64 hipblasDotcBatchedEx_v2_64
+#define hipblasDotStridedBatchedEx_64 hipblasDotStridedBatchedEx_v2_64
+#define hipblasDotcStridedBatchedEx_64 hipblasDotcStridedBatchedEx_v2_64
+
+#define hipblasNrm2Ex_64 hipblasNrm2Ex_v2_64
+#define hipblasNrm2BatchedEx_64 hipblasNrm2BatchedEx_v2_64
+#define hipblasNrm2StridedBatchedEx_64 hipblasNrm2StridedBatchedEx_v2_64
+
+#define hipblasRotEx_64 hipblasRotEx_v2_64
+#define hipblasRotBatchedEx_64 hipblasRotBatchedEx_v2_64
+#define hipblasRotStridedBatchedEx_64 hipblasRotStridedBatchedEx_v2_64
+
+#define hipblasScalEx_64 hipblasScalEx_v2_64
+#define hipblasScalBatchedEx_64 hipblasScalBatchedEx_v2_64
+#define hipblasScalStridedBatchedEx_64 hipblasScalStridedBatchedEx_v2_64
+
+#define hipblasIcamax_64 hipblasIcamax_v2_64
+#define hipblasIzamax_64 hipblasIzamax_v2_64
+
+#define hipblasIcamaxBatched_64 hipblasIcamaxBatched_v2_64
+#define hipblasIzamaxBatched_64 hipblasIzamaxBatched_v2_64
+
+#define hipblasIcamaxStridedBatched_64 hipblasIcamaxStridedBatched_v2_64
+#define hipblasIzamaxStridedBatched_64 hipblasIzamaxStridedBatched_v2_64
+
+#define hipblasScasum_64 hipblasScasum_v2_64
+#define hipblasDzasum_64 hipblasDzasum_v2_64
+
+#define hipblasScasumBatched_64 hipblasScasumBatched_v2_64
+#define hipblasDzasumBatched_64 hipblasDzasumBatched_v2_64
+
+#define hipblasScasumStridedBatched_64 hipblasScasumStridedBatched_v2_64
+#define hipblasDzasumStridedBatched_64 hipblasDzasumStridedBatched_v2_64
+
+#define hipblasCaxpy_64 hipblasCaxpy_v2_64
+#define hipblasZaxpy_64 hipblasZaxpy_v2_64
+
+#define hipblasCaxpyBatched_64 hipblasCaxpyBatched_v2_64
+#define hipblasZaxpyBatched_64 hipblasZaxpyBatched_v2_64
+
+#define hipblasCaxpyStridedBatched_64 hipblasCaxpyStridedBatched_v2_64
+#define hipblasZaxpyStridedBatched_64 hipblasZaxpyStridedBatched_v2_64
+
+#define hipblasCcopy_64 hipblasCcopy_v2_64
+#define hipblasZcopy_64 hipblasZcopy_v2_64
+
+#define hipblasCcopyBatched_64 hipblasCcopyBatched_v2_64
+#define hipblasZcopyBatched_64 hipblasZcopyBatched_v2_64
+
+#define hipblasCcopyStridedBatched_64 hipblasCcopyStridedBatched_v2_64
+#define hipblasZcopyStridedBatched_64 hipblasZcopyStridedBatched_v2_64
+
+#define hipblasCdotu_64 hipblasCdotu_v2_64
+#define hipblasCdotc_64 hipblasCdotc_v2_64
+#define hipblasZdotu_64 hipblasZdotu_v2_64
+#define hipblasZdotc_64 hipblasZdotc_v2_64
+
+#define hipblasCdotuBatched_64 hipblasCdotuBatched_v2_64
+#define hipblasCdotcBatched_64 hipblasCdotcBatched_v2_64
+#define hipblasZdotuBatched_64 hipblasZdotuBatched_v2_64
+#define hipblasZdotcBatched_64 hipblasZdotcBatched_v2_64
+
+#define hipblasCdotuStridedBatched_64 hipblasCdotuStridedBatched_v2_64
+#define hipblasCdotcStridedBatched_64 hipblasCdotcStridedBatched_v2_64
+#define hipblasZdotuStridedBatched_64 hipblasZdotuStridedBatched_v2_64
+#define hipblasZdotcStridedBatched_64 hipblasZdotcStridedBatched_v2_64
+
+#define hipblasScnrm2_64 hipblasScnrm2_v2_64
+#define hipblasDznrm2_64 hipblasDznrm2_v2_64
+
+#define hipblasScnrm2Batched_64 hipblasScnrm2Batched_v2_64
+#define hipblasDznrm2Batched_64 hipblasDznrm2Batched_v2_64
+
+#define hipblasScnrm2StridedBatched_64 hipblasScnrm2StridedBatched_v2_64
+#define hipblasDznrm2StridedBatched_64 hipblasDznrm2StridedBatched_v2_64
+
+#define hipblasCrot_64 hipblasCrot_v2_64
+#define hipblasCsrot_64 hipblasCsrot_v2_64
+#define hipblasZrot_64 hipblasZrot_v2_64
+#define hipblasZdrot_64 hipblasZdrot_v2_64
+
+#define hipblasCrotBatched_64 hipblasCrotBatched_v2_64
+#define hipblasCsrotBatched_64 hipblasCsrotBatched_v2_64
+#define hipblasZrotBatched_64 hipblasZrotBatched_v2_64
+#define hipblasZdrotBatched_64 hipblasZdrotBatched_v2_64
+
+#define hipblasCrotStridedBatched_64 hipblasCrotStridedBatched_v2_64
+#define hipblasCsrotStridedBatched_64 hipblasCsrotStridedBatched_v2_64
+#define hipblasZrotStridedBatched_64 hipblasZrotStridedBatched_v2_64
+#define hipblasZdrotStridedBatched_64 hipblasZdrotStridedBatched_v2_64
+
+#define hipblasCrotgBatched_64 hipblasCrotgBatched_v2_64
+#define hipblasZrotgBatched_64 hipblasZrotgBatched_v2_64
+
+#define hipblasCrotgStridedBatched_64 hipblasCrotgStridedBatched_v2_64
+#define hipblasZrotgStridedBatched_64 hipblasZrotgStridedBatched_v2_64
+
+#define hipblasCscal_64 hipblasCscal_v2_64
+#define hipblasCsscal_64 hipblasCsscal_v2_64
+#define hipblasZscal_64 hipblasZscal_v2_64
+#define hipblasZdscal_64 hipblasZdscal_v2_64
+
+#define hipblasCscalBatched_64 hipblasCscalBatched_v2_64
+#define hipblasCsscalBatched_64 hipblasCsscalBatched_v2_64
+#define hipblasZscalBatched_64 hipblasZscalBatched_v2_64
+#define hipblasZdscalBatched_64 hipblasZdscalBatched_v2_64
+
+#define hipblasCscalStridedBatched_64 hipblasCscalStridedBatched_v2_64
+#define hipblasCsscalStridedBatched_64 hipblasCsscalStridedBatched_v2_64
+#define hipblasZscalStridedBatched_64 hipblasZscalStridedBatched_v2_64
+#define hipblasZdscalStridedBatched_64 hipblasZdscalStridedBatched_v2_64
+
+#define hipblasCswap_64 hipblasCswap_v2_64
+#define hipblasZswap_64 hipblasZswap_v2_64
+
+#define hipblasCswapBatched_64 hipblasCswapBatched_v2_64
+#define hipblasZswapBatched_64 hipblasZswapBatched_v2_64
+
+#define hipblasCswapStridedBatched_64 hipblasCswapStridedBatched_v2_64
+#define hipblasZswapStridedBatched_64 hipblasZswapStridedBatched_v2_64
+
+#define hipblasCgemv_64 hipblasCgemv_v2_64
+#define hipblasZgemv_64 hipblasZgemv_v2_64
+
+#define hipblasCgemvBatched_64 hipblasCgemvBatched_v2_64
+#define hipblasZgemvBatched_64 hipblasZgemvBatched_v2_64
+
+#define hipblasCgemvStridedBatched_64 hipblasCgemvStridedBatched_v2_64
+#define hipblasZgemvStridedBatched_64 hipblasZgemvStridedBatched_v2_64
+
+#define hipblasCgemm_64 hipblasCgemm_v2_64
+#define hipblasZgemm_64 hipblasZgemm_v2_64
+
+#define hipblasCgemmBatched_64 hipblasCgemmBatched_v2_64
+#define hipblasZgemmBatched_64 hipblasZgemmBatched_v2_64
+
+#define hipblasCgemmStridedBatched_64 hipblasCgemmStridedBatched_v2_64
+#define hipblasZgemmStridedBatched_64 hipblasZgemmStridedBatched_v2_64
+
 #endif
 
 /*! HIPBLAS Auxiliary API
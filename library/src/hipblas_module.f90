@@ -98,6 +98,11 @@ module hipblas_enums
         enumerator :: HIPBLAS_ATOMICS_ALLOWED = 1
     end enum
 
+    enum, bind(c)
+        enumerator :: HIPBLAS_BATCH_POINTER_MODE_DEVICE = 0
+        enumerator :: HIPBLAS_BATCH_POINTER_MODE_HOST = 1
+    end enum
+
     enum, bind(c)
         enumerator :: HIPBLAS_GEMM_FLAGS_NONE = 0
         enumerator :: HIPBLAS_GEMM_FLAGS_USE_CU_EFFICIENCY = 2
@@ -345,6 +350,141 @@ module hipblas
         end function hipblasGetAtomicsMode
     end interface
 
+    ! batch pointer mode
+    interface
+        function hipblasSetBatchPointerMode(handle, mode) &
+            bind(c, name='hipblasSetBatchPointerMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetBatchPointerMode
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_BATCH_POINTER_MODE_HOST)), value :: mode
+        end function hipblasSetBatchPointerMode
+    end interface
+
+    interface
+        function hipblasGetBatchPointerMode(handle, mode) &
+            bind(c, name='hipblasGetBatchPointerMode')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetBatchPointerMode
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: mode
+        end function hipblasGetBatchPointerMode
+    end interface
+
+    ! workspace size query
+    interface
+        function hipblasStartWorkspaceSizeQuery(handle) &
+            bind(c, name='hipblasStartWorkspaceSizeQuery')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStartWorkspaceSizeQuery
+            type(c_ptr), value :: handle
+        end function hipblasStartWorkspaceSizeQuery
+    end interface
+
+    interface
+        function hipblasStopWorkspaceSizeQuery(handle, size) &
+            bind(c, name='hipblasStopWorkspaceSizeQuery')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasStopWorkspaceSizeQuery
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: size
+        end function hipblasStopWorkspaceSizeQuery
+    end interface
+
+    ! workspace
+    interface
+        function hipblasSetWorkspace(handle, workspace, workspaceSizeInBytes) &
+            bind(c, name='hipblasSetWorkspace')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetWorkspace
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: workspace
+            integer(c_size_t), value :: workspaceSizeInBytes
+        end function hipblasSetWorkspace
+    end interface
+
+    interface
+        function hipblasGetWorkspaceSize(handle, workspaceSizeInBytes) &
+            bind(c, name='hipblasGetWorkspaceSize')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetWorkspaceSize
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: workspaceSizeInBytes
+        end function hipblasGetWorkspaceSize
+    end interface
+
+    ! GEMM solution
+    interface
+        function hipblasSetGemmSolutionIndex(handle, solutionIndex) &
+            bind(c, name='hipblasSetGemmSolutionIndex')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSetGemmSolutionIndex
+            type(c_ptr), value :: handle
+            integer(c_int32_t), value :: solutionIndex
+        end function hipblasSetGemmSolutionIndex
+    end interface
+
+    interface
+        function hipblasGetGemmSolutionIndex(handle, solutionIndex) &
+            bind(c, name='hipblasGetGemmSolutionIndex')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGetGemmSolutionIndex
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: solutionIndex
+        end function hipblasGetGemmSolutionIndex
+    end interface
+
+    ! batch pointer arrays
+    interface
+        function hipblasBuildBatchPointers(handle, base, elemSize, stride, batchCount, dArray) &
+            bind(c, name='hipblasBuildBatchPointers')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasBuildBatchPointers
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: base
+            integer(c_int), value :: elemSize
+            integer(c_int64_t), value :: stride
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: dArray
+        end function hipblasBuildBatchPointers
+    end interface
+
+    interface
+        function hipblasGatherBatchPointers(handle, base, elemSize, stride, dIndices, &
+                                            batchCount, dArray) &
+            bind(c, name='hipblasGatherBatchPointers')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasGatherBatchPointers
+            type(c_ptr), value :: handle
+            type(c_ptr), value :: base
+            integer(c_int), value :: elemSize
+            integer(c_int64_t), value :: stride
+            type(c_ptr), value :: dIndices
+            integer(c_int), value :: batchCount
+            type(c_ptr), value :: dArray
+        end function hipblasGatherBatchPointers
+    end interface
+
     !--------!
     ! blas 1 !
     !--------!
@@ -12985,6 +13125,241 @@ module hipblas
         end function hipblasZgetrfStridedBatched
     end interface
 
+    ! getrf_rect
+    interface
+        function hipblasSgetrfRect(handle, m, n, A, lda, ipiv, &
+                                  info) &
+            bind(c, name='hipblasSgetrfRect')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRect
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipblasSgetrfRect
+    end interface
+
+    interface
+        function hipblasDgetrfRect(handle, m, n, A, lda, ipiv, &
+                                  info) &
+            bind(c, name='hipblasDgetrfRect')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRect
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipblasDgetrfRect
+    end interface
+
+    interface
+        function hipblasCgetrfRect(handle, m, n, A, lda, ipiv, &
+                                  info) &
+            bind(c, name='hipblasCgetrfRect')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRect
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipblasCgetrfRect
+    end interface
+
+    interface
+        function hipblasZgetrfRect(handle, m, n, A, lda, ipiv, &
+                                  info) &
+            bind(c, name='hipblasZgetrfRect')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRect
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+        end function hipblasZgetrfRect
+    end interface
+
+    ! getrf_rect_batched
+    interface
+        function hipblasSgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+            bind(c, name='hipblasSgetrfRectBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRectBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgetrfRectBatched
+    end interface
+
+    interface
+        function hipblasDgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+            bind(c, name='hipblasDgetrfRectBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRectBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDgetrfRectBatched
+    end interface
+
+    interface
+        function hipblasCgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+            bind(c, name='hipblasCgetrfRectBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRectBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCgetrfRectBatched
+    end interface
+
+    interface
+        function hipblasZgetrfRectBatched(handle, m, n, A, lda, ipiv, &
+                                         info, batch_count) &
+            bind(c, name='hipblasZgetrfRectBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRectBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZgetrfRectBatched
+    end interface
+
+    ! getrf_rect_strided_batched
+    interface
+        function hipblasSgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+            bind(c, name='hipblasSgetrfRectStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetrfRectStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgetrfRectStridedBatched
+    end interface
+
+    interface
+        function hipblasDgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+            bind(c, name='hipblasDgetrfRectStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetrfRectStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDgetrfRectStridedBatched
+    end interface
+
+    interface
+        function hipblasCgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+            bind(c, name='hipblasCgetrfRectStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetrfRectStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCgetrfRectStridedBatched
+    end interface
+
+    interface
+        function hipblasZgetrfRectStridedBatched(handle, m, n, A, lda, strideA, &
+                                                ipiv, strideP, info, batch_count) &
+            bind(c, name='hipblasZgetrfRectStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetrfRectStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: m
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZgetrfRectStridedBatched
+    end interface
+
     ! getrs
     interface
         function hipblasSgetrs(handle, trans, n, nrhs, A, lda, ipiv, &
@@ -13260,14 +13635,15 @@ module hipblas
         end function hipblasZgetrsStridedBatched
     end interface
 
-    ! getri_batched
+    ! getri
     interface
-        function hipblasSgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count) &
-            bind(c, name='hipblasSgetriBatched')
+        function hipblasSgetri(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+            bind(c, name='hipblasSgetri')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetri
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: A
@@ -13276,17 +13652,17 @@ module hipblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
-        end function hipblasSgetriBatched
+        end function hipblasSgetri
     end interface
 
     interface
-        function hipblasDgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count) &
-            bind(c, name='hipblasDgetriBatched')
+        function hipblasDgetri(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+            bind(c, name='hipblasDgetri')
             use iso_c_binding
             use hipblas_enums
             implicit none
-            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriBatched
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetri
             type(c_ptr), value :: handle
             integer(c_int), value :: n
             type(c_ptr), value :: A
@@ -13295,7 +13671,83 @@ module hipblas
             type(c_ptr), value :: C
             integer(c_int), value :: ldc
             type(c_ptr), value :: info
-            integer(c_int), value :: batch_count
+        end function hipblasDgetri
+    end interface
+
+    interface
+        function hipblasCgetri(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+            bind(c, name='hipblasCgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasCgetri
+    end interface
+
+    interface
+        function hipblasZgetri(handle, n, A, lda, ipiv, C, &
+                              ldc, info) &
+            bind(c, name='hipblasZgetri')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetri
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+        end function hipblasZgetri
+    end interface
+
+    ! getri_batched
+    interface
+        function hipblasSgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count) &
+            bind(c, name='hipblasSgetriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgetriBatched
+    end interface
+
+    interface
+        function hipblasDgetriBatched(handle, n, A, lda, ipiv, C, ldc, info, batch_count) &
+            bind(c, name='hipblasDgetriBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
         end function hipblasDgetriBatched
     end interface
 
@@ -13337,6 +13789,99 @@ module hipblas
         end function hipblasZgetriBatched
     end interface
 
+    ! getri_strided_batched
+    interface
+        function hipblasSgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasSgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasSgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasDgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasDgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasDgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasCgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasCgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasCgetriStridedBatched
+    end interface
+
+    interface
+        function hipblasZgetriStridedBatched(handle, n, A, lda, strideA, ipiv, &
+                                            strideP, C, ldc, strideC, info, batch_count) &
+            bind(c, name='hipblasZgetriStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZgetriStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: C
+            integer(c_int), value :: ldc
+            integer(c_int64_t), value :: strideC
+            type(c_ptr), value :: info
+            integer(c_int), value :: batch_count
+        end function hipblasZgetriStridedBatched
+    end interface
+
     ! geqrf
     interface
         function hipblasSgeqrf(handle, m, n, A, lda, tau, info) &
@@ -13839,4 +14384,643 @@ module hipblas
         end function hipblasZgelsStridedBatched
     end interface
 
+    ! potrf
+    interface
+        function hipblasSpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasSpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasSpotrf
+    end interface
+
+    interface
+        function hipblasDpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasDpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasDpotrf
+    end interface
+
+    interface
+        function hipblasCpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasCpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasCpotrf
+    end interface
+
+    interface
+        function hipblasZpotrf(handle, uplo, n, A, lda, info) &
+            bind(c, name='hipblasZpotrf')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrf
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+        end function hipblasZpotrf
+    end interface
+
+    ! potrf_batched
+    interface
+        function hipblasSpotrfBatched(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+            bind(c, name='hipblasSpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfBatched
+    end interface
+
+    interface
+        function hipblasDpotrfBatched(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+            bind(c, name='hipblasDpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfBatched
+    end interface
+
+    interface
+        function hipblasCpotrfBatched(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+            bind(c, name='hipblasCpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfBatched
+    end interface
+
+    interface
+        function hipblasZpotrfBatched(handle, uplo, n, A, lda, info, &
+                                     batchCount) &
+            bind(c, name='hipblasZpotrfBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfBatched
+    end interface
+
+    ! potrf_strided_batched
+    interface
+        function hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+            bind(c, name='hipblasSpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+            bind(c, name='hipblasDpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+            bind(c, name='hipblasCpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrfStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, &
+                                            info, batchCount) &
+            bind(c, name='hipblasZpotrfStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrfStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrfStridedBatched
+    end interface
+
+    ! potrs
+    interface
+        function hipblasSpotrs(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+            bind(c, name='hipblasSpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasSpotrs
+    end interface
+
+    interface
+        function hipblasDpotrs(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+            bind(c, name='hipblasDpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasDpotrs
+    end interface
+
+    interface
+        function hipblasCpotrs(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+            bind(c, name='hipblasCpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasCpotrs
+    end interface
+
+    interface
+        function hipblasZpotrs(handle, uplo, n, nrhs, A, lda, &
+                              B, ldb, info) &
+            bind(c, name='hipblasZpotrs')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrs
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+        end function hipblasZpotrs
+    end interface
+
+    ! potrs_batched
+    interface
+        function hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+            bind(c, name='hipblasSpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsBatched
+    end interface
+
+    interface
+        function hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+            bind(c, name='hipblasDpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsBatched
+    end interface
+
+    interface
+        function hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+            bind(c, name='hipblasCpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsBatched
+    end interface
+
+    interface
+        function hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, &
+                                     B, ldb, info, batchCount) &
+            bind(c, name='hipblasZpotrsBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsBatched
+    end interface
+
+    ! potrs_strided_batched
+    interface
+        function hipblasSpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasSpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasSpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasSpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasDpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasDpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasDpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasCpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasCpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasCpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasCpotrsStridedBatched
+    end interface
+
+    interface
+        function hipblasZpotrsStridedBatched(handle, uplo, n, nrhs, A, lda, &
+                                            strideA, B, ldb, strideB, info, batchCount) &
+            bind(c, name='hipblasZpotrsStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZpotrsStridedBatched
+            type(c_ptr), value :: handle
+            integer(kind(HIPBLAS_FILL_MODE_FULL)), value :: uplo
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: info
+            integer(c_int), value :: batchCount
+        end function hipblasZpotrsStridedBatched
+    end interface
+
+    ! XXgesv
+    interface
+        function hipblasDSgesv(handle, n, nrhs, A, lda, ipiv, &
+                              B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+            bind(c, name='hipblasDSgesv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+        end function hipblasDSgesv
+    end interface
+
+    interface
+        function hipblasZCgesv(handle, n, nrhs, A, lda, ipiv, &
+                              B, ldb, X, ldx, iter, info, &
+                              deviceInfo) &
+            bind(c, name='hipblasZCgesv')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesv
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+        end function hipblasZCgesv
+    end interface
+
+    ! XXgesvBatched
+    interface
+        function hipblasDSgesvBatched(handle, n, nrhs, A, lda, ipiv, &
+                                     B, ldb, X, ldx, iter, info, &
+                                     deviceInfo, batchCount) &
+            bind(c, name='hipblasDSgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batchCount
+        end function hipblasDSgesvBatched
+    end interface
+
+    interface
+        function hipblasZCgesvBatched(handle, n, nrhs, A, lda, ipiv, &
+                                     B, ldb, X, ldx, iter, info, &
+                                     deviceInfo, batchCount) &
+            bind(c, name='hipblasZCgesvBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            type(c_ptr), value :: ipiv
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batchCount
+        end function hipblasZCgesvBatched
+    end interface
+
+    ! XXgesvStridedBatched
+    interface
+        function hipblasDSgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+                                            ipiv, strideP, B, ldb, strideB, X, &
+                                            ldx, strideX, iter, info, deviceInfo, batchCount) &
+            bind(c, name='hipblasDSgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasDSgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            integer(c_int64_t), value :: strideX
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batchCount
+        end function hipblasDSgesvStridedBatched
+    end interface
+
+    interface
+        function hipblasZCgesvStridedBatched(handle, n, nrhs, A, lda, strideA, &
+                                            ipiv, strideP, B, ldb, strideB, X, &
+                                            ldx, strideX, iter, info, deviceInfo, batchCount) &
+            bind(c, name='hipblasZCgesvStridedBatched')
+            use iso_c_binding
+            use hipblas_enums
+            implicit none
+            integer(kind(HIPBLAS_STATUS_SUCCESS)) :: hipblasZCgesvStridedBatched
+            type(c_ptr), value :: handle
+            integer(c_int), value :: n
+            integer(c_int), value :: nrhs
+            type(c_ptr), value :: A
+            integer(c_int), value :: lda
+            integer(c_int64_t), value :: strideA
+            type(c_ptr), value :: ipiv
+            integer(c_int64_t), value :: strideP
+            type(c_ptr), value :: B
+            integer(c_int), value :: ldb
+            integer(c_int64_t), value :: strideB
+            type(c_ptr), value :: X
+            integer(c_int), value :: ldx
+            integer(c_int64_t), value :: strideX
+            type(c_ptr), value :: iter
+            type(c_ptr), value :: info
+            type(c_ptr), value :: deviceInfo
+            integer(c_int), value :: batchCount
+        end function hipblasZCgesvStridedBatched
+    end interface
+
 end module hipblas
@@ -0,0 +1,68 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+
+// Checks of the hipblasGemmEpilogue_t taken by the *WithEpilogue GEMMs, shared by the backends
+
+// Whether type is one of the real types an epilogue reads and writes
+inline bool hipblasEpilogueSupportsType(hipDataType type)
+{
+    return type == HIP_R_16F || type == HIP_R_16BF || type == HIP_R_32F || type == HIP_R_64F;
+}
+
+// Whether the epilogue leaves the result of the GEMM in C as it is
+inline bool hipblasEpilogueIsNone(const hipblasGemmEpilogue_t* epilogue)
+{
+    return !epilogue
+           || (epilogue->scaleMode == HIPBLAS_EPILOGUE_SCALE_NONE && !epilogue->bias
+               && epilogue->activation == HIPBLAS_ACTIVATION_NONE && !epilogue->D);
+}
+
+// Validate the epilogue of a GEMM with m rows storing C as c_type
+inline hipblasStatus_t
+    hipblasCheckEpilogue(const hipblasGemmEpilogue_t* epilogue, int m, hipDataType c_type)
+{
+    if(!epilogue)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(epilogue->scaleMode != HIPBLAS_EPILOGUE_SCALE_NONE
+       && epilogue->scaleMode != HIPBLAS_EPILOGUE_SCALE_ROW
+       && epilogue->scaleMode != HIPBLAS_EPILOGUE_SCALE_COLUMN)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(epilogue->activation != HIPBLAS_ACTIVATION_NONE
+       && epilogue->activation != HIPBLAS_ACTIVATION_RELU
+       && epilogue->activation != HIPBLAS_ACTIVATION_GELU)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(epilogue->scaleMode != HIPBLAS_EPILOGUE_SCALE_NONE && !epilogue->scale)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(epilogue->D && epilogue->ldd < std::max(1, m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!hipblasEpilogueIsNone(epilogue)
+       && (!hipblasEpilogueSupportsType(c_type)
+           || (epilogue->D && !hipblasEpilogueSupportsType(epilogue->dType))))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,203 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "logging.hpp"
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// GEMM tuning file, named by HIPBLAS_GEMM_TUNING_FILE and written by hipblas-bench --tune.
+// Lines starting with # and the column header are skipped; every other line is
+//   function,transA,transB,m,n,k,lda,ldb,ldc,batch_count,a_type,b_type,c_type,compute_type,
+//   solution_index
+// where function is gemm_ex, gemm_batched_ex or gemm_strided_batched_ex, the types are
+// hipblas-bench precision names (f32_r, bf16_r, ...) and compute_type is the precision the
+// backend computes in. Further columns, such as the times measured by the tuning, are ignored.
+
+enum class hipblasGemmTuningFunction : int32_t
+{
+    gemm_ex,
+    gemm_batched_ex,
+    gemm_strided_batched_ex,
+};
+
+// Shape of a GemmEx call, with its datatypes numbered as the backend numbers them
+struct hipblasGemmTuningKey
+{
+    hipblasGemmTuningFunction function;
+    hipblasOperation_t        transA;
+    hipblasOperation_t        transB;
+    std::array<int64_t, 7>    sizes; // m, n, k, lda, ldb, ldc, batch_count
+    std::array<int64_t, 4>    types; // a, b, c, compute
+
+    bool operator==(const hipblasGemmTuningKey& rhs) const
+    {
+        return function == rhs.function && transA == rhs.transA && transB == rhs.transB
+               && sizes == rhs.sizes && types == rhs.types;
+    }
+};
+
+struct hipblasGemmTuningKeyHash
+{
+    size_t operator()(const hipblasGemmTuningKey& key) const
+    {
+        size_t hash = std::hash<int32_t>{}(int32_t(key.function));
+        auto   mix  = [&hash](int64_t value) {
+            hash ^= std::hash<int64_t>{}(value) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+        };
+        mix(key.transA);
+        mix(key.transB);
+        for(int64_t size : key.sizes)
+            mix(size);
+        for(int64_t type : key.types)
+            mix(type);
+        return hash;
+    }
+};
+
+// Solution chosen for each tuned shape
+struct hipblasGemmTuning
+{
+    std::unordered_map<hipblasGemmTuningKey, int32_t, hipblasGemmTuningKeyHash> solutions;
+
+    // Tuned solution of a shape, 0 if it was not tuned
+    int32_t find(const hipblasGemmTuningKey& key) const
+    {
+        auto it = solutions.find(key);
+        return it == solutions.end() ? 0 : it->second;
+    }
+};
+
+// Whether the tuned solution of each shape used on a handle is valid on the device of the handle,
+// checked the first time the shape is used
+struct hipblasGemmTuningChecks
+{
+    std::unordered_map<hipblasGemmTuningKey, bool, hipblasGemmTuningKeyHash> valid;
+};
+
+// Datatype named as by hipblas-bench, or false if the name is unknown
+inline bool hipblasGemmTuningDatatype(const std::string& name, hipDataType& type)
+{
+    for(int t = HIP_R_32F; t <= HIP_C_16BF; t++)
+        if(name == hipblasLogDatatypeString(t))
+        {
+            type = hipDataType(t);
+            return true;
+        }
+    return false;
+}
+
+// Parse one line of a tuning file; false if it is a comment, the header or malformed.
+// Convert maps a hipDataType to the number the backend gives the datatype.
+template <typename Convert>
+bool hipblasParseGemmTuningLine(const std::string&    line,
+                                Convert               convert,
+                                hipblasGemmTuningKey& key,
+                                int32_t&              solution_index)
+{
+    std::vector<std::string> fields;
+    std::istringstream       columns(line);
+    for(std::string field; std::getline(columns, field, ',');)
+        fields.push_back(field.substr(0, field.find_last_not_of(" \t\r") + 1));
+    if(fields.size() < 15 || fields[0].empty() || fields[0][0] == '#')
+        return false;
+
+    if(fields[0] == "gemm_ex")
+        key.function = hipblasGemmTuningFunction::gemm_ex;
+    else if(fields[0] == "gemm_batched_ex")
+        key.function = hipblasGemmTuningFunction::gemm_batched_ex;
+    else if(fields[0] == "gemm_strided_batched_ex")
+        key.function = hipblasGemmTuningFunction::gemm_strided_batched_ex;
+    else
+        return false;
+
+    auto operation = [](const std::string& field, hipblasOperation_t& op) {
+        op = field == "N" ? HIPBLAS_OP_N : field == "T" ? HIPBLAS_OP_T : HIPBLAS_OP_C;
+        return field == "N" || field == "T" || field == "C";
+    };
+    if(!operation(fields[1], key.transA) || !operation(fields[2], key.transB))
+        return false;
+
+    for(size_t i = 0; i < key.sizes.size(); i++)
+    {
+        char* end;
+        key.sizes[i] = strtoll(fields[3 + i].c_str(), &end, 10);
+        if(fields[3 + i].empty() || *end)
+            return false;
+    }
+
+    for(size_t i = 0; i < key.types.size(); i++)
+    {
+        hipDataType type;
+        if(!hipblasGemmTuningDatatype(fields[10 + i], type))
+            return false;
+        key.types[i] = int64_t(convert(type));
+    }
+
+    char* end;
+    solution_index = int32_t(strtol(fields[14].c_str(), &end, 10));
+    return !fields[14].empty() && !*end && solution_index > 0;
+}
+
+// Tuning of the file named by HIPBLAS_GEMM_TUNING_FILE, or null if it is not set. A file is
+// read the first time a handle is created with it, and its tuning is shared by the handles.
+// Lines that cannot be parsed, or a file that cannot be read, leave the shapes untuned.
+template <typename Convert>
+std::shared_ptr<const hipblasGemmTuning> hipblasGemmTuningFromEnv(Convert convert)
+{
+    const char* path = getenv("HIPBLAS_GEMM_TUNING_FILE");
+    if(!path || !*path)
+        return nullptr;
+
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::shared_ptr<const hipblasGemmTuning>> files;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto&                       tuning = files[path];
+    if(!tuning)
+    {
+        auto          read = std::make_shared<hipblasGemmTuning>();
+        std::ifstream file(path);
+        if(!file)
+            fprintf(stderr, "hipBLAS warning: cannot read HIPBLAS_GEMM_TUNING_FILE %s\n", path);
+
+        hipblasGemmTuningKey key;
+        int32_t              solution_index;
+        for(std::string line; std::getline(file, line);)
+            if(hipblasParseGemmTuningLine(line, convert, key, solution_index))
+                read->solutions[key] = solution_index;
+        tuning = std::move(read);
+    }
+    return tuning;
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright (C) 2023 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include "staging.hpp"
+#include <array>
+#include <memory>
+#include <stdint.h>
+#include <unordered_map>
+
+// Identifies a call that needs device workspace: the calling function and the arguments its
+// workspace requirement depends on (dimensions, batch count, and enums selecting the algorithm)
+struct hipblasWorkspaceShape
+{
+    const char*            func;
+    std::array<int64_t, 8> sizes{};
+
+    template <typename... Args>
+    hipblasWorkspaceShape(const char* function, Args... args)
+        : func(function)
+        , sizes{{int64_t(args)...}}
+    {
+        static_assert(sizeof...(Args) <= 8, "too many workspace shape arguments");
+    }
+
+    bool operator==(const hipblasWorkspaceShape& rhs) const
+    {
+        return func == rhs.func && sizes == rhs.sizes;
+    }
+};
+
+struct hipblasWorkspaceShapeHash
+{
+    size_t operator()(const hipblasWorkspaceShape& shape) const
+    {
+        size_t hash = std::hash<const char*>{}(shape.func);
+        for(int64_t size : shape.sizes)
+            hash ^= std::hash<int64_t>{}(size) + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+        return hash;
+    }
+};
+
+// Solutions chosen for tuned GEMM shapes, and whether they are valid on the device of a handle;
+// see gemm_tuning.hpp
+struct hipblasGemmTuning;
+struct hipblasGemmTuningChecks;
+
+// State kept by hipBLAS itself for each handle, independent of the backend.
+// Handle-scoped features (caches, logging, tuning) add their members here.
+struct hipblasHandleState
+{
+    // Device workspace in bytes needed by each shape that has outgrown the handle's workspace
+    std::unordered_map<hipblasWorkspaceShape, size_t, hipblasWorkspaceShapeHash> workspace_sizes;
+
+    // Device workspace provided by the application with hipblasSetWorkspace, if any. hipBLAS
+    // never replaces it with workspace of its own.
+    void*  user_workspace      = nullptr;
+    size_t user_workspace_size = 0;
+
+    // Between hipblasStartWorkspaceSizeQuery and hipblasStopWorkspaceSizeQuery: calls only
+    // record their workspace needs, and workspace_query_size is the largest seen so far
+    bool   workspace_query      = false;
+    size_t workspace_query_size = 0;
+
+    // Logging layers enabled for calls on this handle, see logging.hpp
+    uint32_t layer_mode = 0;
+
+    // Pointer mode last set with hipblasSetPointerMode, which the logging layers read rather
+    // than asking the backend on each call
+    hipblasPointerMode_t pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+
+    // Where the pointer arrays passed to Batched functions are. Host arrays are copied to the
+    // device through the staging ring.
+    hipblasBatchPointerMode_t batch_pointer_mode = HIPBLAS_BATCH_POINTER_MODE_DEVICE;
+    hipblasStagingRing        staging;
+
+    // GEMM solutions tuned for the shapes of the file named by HIPBLAS_GEMM_TUNING_FILE, whether
+    // those used on the handle are valid on its device, and the solution set with
+    // hipblasSetGemmSolutionIndex, which overrides them when it is not 0
+    std::shared_ptr<const hipblasGemmTuning> gemm_tuning;
+    std::shared_ptr<hipblasGemmTuningChecks> gemm_tuning_checks;
+    int32_t                                  gemm_solution_index = 0;
+};
+
+// The object behind a hipblasHandle_t. The public type stays an opaque pointer, so the
+// ABI is unchanged; the backend handle it used to be is now owned by this object.
+template <typename BackendHandle>
+struct hipblasHandle
+{
+    BackendHandle      backend{};
+    hipblasHandleState state;
+};
+
+// Backend handle owned by a hipBLAS handle. A null handle maps to a null backend handle
+// so the backend keeps reporting it the same way.
+template <typename BackendHandle>
+inline BackendHandle hipblasGetBackendHandle(hipblasHandle_t handle)
+{
+    return handle ? static_cast<hipblasHandle<BackendHandle>*>(handle)->backend
+                  : BackendHandle{};
+}
+
+// hipBLAS state of a non-null handle
+template <typename BackendHandle>
+inline hipblasHandleState& hipblasGetHandleState(hipblasHandle_t handle)
+{
+    return static_cast<hipblasHandle<BackendHandle>*>(handle)->state;
+}
@@ -0,0 +1,58 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <limits.h>
+#include <stdint.h>
+
+// Support for the _64 (ILP64) API on backends that only take 32-bit sizes: a call is
+// forwarded to the 32-bit function when its sizes fit, with large batches run in chunks.
+
+// True if every size is representable as an int
+template <typename... Sizes>
+inline bool hipblasFitsInt(Sizes... sizes)
+{
+    return ((sizes >= INT_MIN && sizes <= INT_MAX) && ...);
+}
+
+// Run func(first, count) over consecutive chunks of at most INT_MAX batches, stopping at the
+// first failure. A batch count that fits, or is invalid, is passed through in one call so
+// the 32-bit function validates it.
+template <typename Func>
+inline hipblasStatus_t hipblasBatchChunks(int64_t batch_count, Func&& func)
+{
+    if(batch_count <= INT_MAX)
+        return func(0, int(std::max<int64_t>(batch_count, -1)));
+
+    for(int64_t first = 0; first < batch_count; first += INT_MAX)
+    {
+        hipblasStatus_t status = func(first, int(std::min<int64_t>(batch_count - first, INT_MAX)));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
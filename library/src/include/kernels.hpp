@@ -0,0 +1,123 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <hip/hip_complex.h>
+#include <hip/hip_runtime_api.h>
+
+// Device kernels for the work hipBLAS does itself rather than forwarding to the backend. Each
+// launcher enqueues on stream and returns the launch status. Batched operands are device arrays
+// of batch_count device pointers.
+
+// Fill the device array A with base + b * stride elements of elem_size bytes, b < batch_count
+hipError_t hipblasBuildPointersLaunch(hipStream_t   stream,
+                                      void*         base,
+                                      size_t        elem_size,
+                                      hipblasStride stride,
+                                      int           batch_count,
+                                      void**        A);
+
+// Fill the device array A with base + indices[b] * stride elements of elem_size bytes
+hipError_t hipblasGatherPointersLaunch(hipStream_t   stream,
+                                       void*         base,
+                                       size_t        elem_size,
+                                       hipblasStride stride,
+                                       const int*    indices,
+                                       int           batch_count,
+                                       void**        A);
+
+// B_b = A_b converted to To, for m x n matrices. If overflow is not null, overflow[b] is set to
+// -2 when an element of A_b is too large for To; it is left alone otherwise.
+template <typename Ti, typename To>
+hipError_t hipblasConvertMatrixLaunch(hipStream_t      stream,
+                                      int              m,
+                                      int              n,
+                                      const Ti* const* A,
+                                      int              lda,
+                                      To* const*       B,
+                                      int              ldb,
+                                      int*             overflow,
+                                      int              batch_count);
+
+// B_b += A_b converted to To, for m x n matrices and only where active[b] is nonzero
+template <typename Ti, typename To>
+hipError_t hipblasAddConvertedMatrixLaunch(hipStream_t      stream,
+                                           int              m,
+                                           int              n,
+                                           const Ti* const* A,
+                                           int              lda,
+                                           To* const*       B,
+                                           int              ldb,
+                                           const int*       active,
+                                           int              batch_count);
+
+// norm[b] = infinity norm (largest absolute row sum) of the n x n matrix A_b
+template <typename T>
+hipError_t hipblasNormInfLaunch(
+    hipStream_t stream, int n, const T* const* A, int lda, double* norm, int batch_count);
+
+// converged[b] = 1 if every column j of the n x nrhs residual R_b satisfies
+// max|R_b(:,j)| <= max|X_b(:,j)| * norm[b] * tolerance, and 0 otherwise
+template <typename T>
+hipError_t hipblasRefinementConvergedLaunch(hipStream_t     stream,
+                                            int             n,
+                                            int             nrhs,
+                                            const T* const* R,
+                                            int             ldr,
+                                            const T* const* X,
+                                            int             ldx,
+                                            const double*   norm,
+                                            double          tolerance,
+                                            int*            converged,
+                                            int             batch_count);
+
+// After refinement iteration it, for the entries b still active: if converged[b] is set, iter[b]
+// = it - 1 and the entry stops; otherwise if it > max_iterations, iter[b] = -max_iterations - 1
+// and the entry stops. Stopped entries have active[b] = 0.
+hipError_t hipblasRefinementStepLaunch(hipStream_t stream,
+                                       int         it,
+                                       int         max_iterations,
+                                       const int*  converged,
+                                       int*        active,
+                                       int*        iter,
+                                       int         batch_count);
+
+// D_b = activation(scale_b * C_b + bias_b) rounded to d_type, for m x n matrices at stride_c and
+// stride_d of C and D, with the scale, bias and activation of epilogue. C and D may be the same
+// matrix when c_type == d_type. c_type and d_type are each one of HIP_R_16F, HIP_R_16BF,
+// HIP_R_32F and HIP_R_64F, other types return hipErrorInvalidValue.
+hipError_t hipblasGemmEpilogueLaunch(hipStream_t                  stream,
+                                     int                          m,
+                                     int                          n,
+                                     const void*                  C,
+                                     hipDataType                  c_type,
+                                     int                          ldc,
+                                     hipblasStride                stride_c,
+                                     const hipblasGemmEpilogue_t& epilogue,
+                                     void*                        D,
+                                     hipDataType                  d_type,
+                                     int                          ldd,
+                                     hipblasStride                stride_d,
+                                     int                          batch_count);
@@ -0,0 +1,1045 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "handle.hpp"
+#include "hipblas.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Logging layers, enabled by setting HIPBLAS_LAYER to a bitwise or of
+//   1 (trace):   one line per call with its arguments
+//   2 (bench):   a hipblas-bench command line that reruns the call
+//   4 (profile): call count and host time of each unique call signature, written at exit
+// Each layer writes to the file named by HIPBLAS_LOG_TRACE_PATH, HIPBLAS_LOG_BENCH_PATH or
+// HIPBLAS_LOG_PROFILE_PATH, or to stderr.
+//
+// The profile times each call on the host only, until it returns. Most calls return once their
+// work is queued on the stream, so this is the time to submit the work, not the time the device
+// takes to run it.
+//
+// A call only copies its arguments into a ring buffer owned by the calling thread. A full ring
+// is handed to a writer thread without taking a lock, and rings are also written when their
+// thread exits and at process exit, so the cost of formatting and I/O is kept out of the call.
+enum hipblasLayerMode : uint32_t
+{
+    hipblasLayerModeNone    = 0,
+    hipblasLayerModeTrace   = 1,
+    hipblasLayerModeBench   = 2,
+    hipblasLayerModeProfile = 4,
+};
+
+// Layers requested in the environment, given to each handle when it is created
+inline uint32_t hipblasLayerModeFromEnv()
+{
+    static const uint32_t mode = [] {
+        const char* layer = getenv("HIPBLAS_LAYER");
+        return layer ? uint32_t(strtoul(layer, nullptr, 0))
+                           & (hipblasLayerModeTrace | hipblasLayerModeBench
+                              | hipblasLayerModeProfile)
+                     : uint32_t(hipblasLayerModeNone);
+    }();
+    return mode;
+}
+
+/*
+ * ===========================================================================
+ *    Captured arguments
+ * ===========================================================================
+ */
+
+enum class hipblasLogKind : uint8_t
+{
+    integer,
+    pointer,
+    scalar,
+    operation,
+    fill,
+    diagonal,
+    side,
+    datatype,
+    computetype,
+};
+
+// Value of a scalar argument read from host memory when the call was made
+struct hipblasLogScalarValue
+{
+    hipDataType   type;
+    unsigned char bytes[16];
+};
+
+struct hipblasLogValue
+{
+    hipblasLogKind kind;
+    union
+    {
+        int64_t               integer;
+        const void*           pointer;
+        hipblasLogScalarValue scalar;
+    };
+};
+
+// A scalar argument (alpha, beta) and its type. It is logged by value in host pointer mode.
+struct hipblasLogScalarArg
+{
+    const void* ptr;
+    hipDataType type;
+};
+
+template <typename T>
+inline hipblasLogScalarArg hipblasLogScalar(const T* ptr)
+{
+    static_assert(sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 16,
+                  "unexpected scalar type");
+    if constexpr(std::is_same<T, float>{})
+        return {ptr, HIP_R_32F};
+    else if constexpr(std::is_same<T, double>{})
+        return {ptr, HIP_R_64F};
+    else if constexpr(std::is_same<T, hipblasBfloat16>{})
+        return {ptr, HIP_R_16BF};
+    else if constexpr(sizeof(T) == 2)
+        return {ptr, HIP_R_16F};
+    else if constexpr(sizeof(T) == 8)
+        return {ptr, HIP_C_32F};
+    else
+        return {ptr, HIP_C_64F};
+}
+
+inline hipblasLogScalarArg hipblasLogScalar(const void* ptr, hipDataType type)
+{
+    return {ptr, type};
+}
+
+#ifndef HIPBLAS_V2
+inline hipDataType hipblasLogDatatype(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return HIP_R_16F;
+    case HIPBLAS_R_32F:
+        return HIP_R_32F;
+    case HIPBLAS_R_64F:
+        return HIP_R_64F;
+    case HIPBLAS_C_16F:
+        return HIP_C_16F;
+    case HIPBLAS_C_32F:
+        return HIP_C_32F;
+    case HIPBLAS_C_64F:
+        return HIP_C_64F;
+    case HIPBLAS_R_8I:
+        return HIP_R_8I;
+    case HIPBLAS_R_8U:
+        return HIP_R_8U;
+    case HIPBLAS_R_32I:
+        return HIP_R_32I;
+    case HIPBLAS_R_32U:
+        return HIP_R_32U;
+    case HIPBLAS_C_8I:
+        return HIP_C_8I;
+    case HIPBLAS_C_8U:
+        return HIP_C_8U;
+    case HIPBLAS_C_32I:
+        return HIP_C_32I;
+    case HIPBLAS_C_32U:
+        return HIP_C_32U;
+    case HIPBLAS_R_16B:
+        return HIP_R_16BF;
+    case HIPBLAS_C_16B:
+        return HIP_C_16BF;
+    default:
+        return hipDataType(type);
+    }
+}
+
+inline hipblasLogScalarArg hipblasLogScalar(const void* ptr, hipblasDatatype_t type)
+{
+    return {ptr, hipblasLogDatatype(type)};
+}
+#endif
+
+// Scalars of a hipblasComputeType_t computation are real unless C is complex
+inline hipblasLogScalarArg
+    hipblasLogScalar(const void* ptr, hipblasComputeType_t compute_type, hipDataType c_type)
+{
+    bool complex = c_type == HIP_C_32F || c_type == HIP_C_64F;
+    switch(compute_type)
+    {
+    case HIPBLAS_COMPUTE_16F:
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return {ptr, HIP_R_16F};
+    case HIPBLAS_COMPUTE_64F:
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return {ptr, complex ? HIP_C_64F : HIP_R_64F};
+    case HIPBLAS_COMPUTE_32I:
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return {ptr, HIP_R_32I};
+    default:
+        return {ptr, complex ? HIP_C_32F : HIP_R_32F};
+    }
+}
+
+inline size_t hipblasLogScalarSize(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_16F:
+    case HIP_R_16BF:
+        return 2;
+    case HIP_R_32F:
+    case HIP_R_32I:
+        return 4;
+    case HIP_R_64F:
+    case HIP_C_32F:
+        return 8;
+    case HIP_C_64F:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+inline hipblasLogValue hipblasLogCapture(bool host_scalars, hipblasLogScalarArg arg)
+{
+    hipblasLogValue value;
+    size_t          size = hipblasLogScalarSize(arg.type);
+    if(host_scalars && arg.ptr && size)
+    {
+        value.kind        = hipblasLogKind::scalar;
+        value.scalar.type = arg.type;
+        memcpy(value.scalar.bytes, arg.ptr, size);
+    }
+    else
+    {
+        value.kind    = hipblasLogKind::pointer;
+        value.pointer = arg.ptr;
+    }
+    return value;
+}
+
+template <typename T>
+inline hipblasLogValue hipblasLogCapture(bool, T arg)
+{
+    hipblasLogValue value;
+    value.integer = 0;
+    if constexpr(std::is_pointer<T>{})
+    {
+        value.kind    = hipblasLogKind::pointer;
+        value.pointer = (const void*)arg;
+        return value;
+    }
+    else if constexpr(std::is_same<T, hipblasOperation_t>{})
+        value.kind = hipblasLogKind::operation;
+    else if constexpr(std::is_same<T, hipblasFillMode_t>{})
+        value.kind = hipblasLogKind::fill;
+    else if constexpr(std::is_same<T, hipblasDiagType_t>{})
+        value.kind = hipblasLogKind::diagonal;
+    else if constexpr(std::is_same<T, hipblasSideMode_t>{})
+        value.kind = hipblasLogKind::side;
+    else if constexpr(std::is_same<T, hipDataType>{})
+        value.kind = hipblasLogKind::datatype;
+#ifndef HIPBLAS_V2
+    else if constexpr(std::is_same<T, hipblasDatatype_t>{})
+    {
+        value.kind    = hipblasLogKind::datatype;
+        value.integer = hipblasLogDatatype(arg);
+        return value;
+    }
+#endif
+    else if constexpr(std::is_same<T, hipblasComputeType_t>{})
+        value.kind = hipblasLogKind::computetype;
+    else
+    {
+        static_assert(std::is_integral<T>{} || std::is_enum<T>{}, "unexpected argument type");
+        value.kind = hipblasLogKind::integer;
+    }
+    value.integer = int64_t(arg);
+    return value;
+}
+
+/*
+ * ===========================================================================
+ *    Per-thread ring buffers
+ * ===========================================================================
+ */
+
+constexpr int hipblasLogMaxArgs = 28;
+
+struct hipblasLogRecord
+{
+    const char*     func; // name of the hipBLAS function
+    const char*     names; // its logged arguments, as written in the source
+    uint32_t        layers;
+    int             count;
+    int64_t         time_ns; // host time spent in the call, profile layer only
+    hipblasLogValue values[hipblasLogMaxArgs];
+};
+
+// Single producer ring: only the owning thread writes records and advances head. Once full, the
+// ring is handed to the sink whole, and the thread carries on with an empty one.
+struct hipblasLogRing
+{
+    static constexpr uint64_t capacity = 256;
+
+    hipblasLogRecord      records[capacity];
+    std::atomic<uint64_t> head{0};
+    hipblasLogRing*       next = nullptr; // in a hipblasLogRingStack
+};
+
+// Lock-free stack of rings. Any thread pushes, and take removes all the rings at once, so that a
+// ring is never popped while another thread pushes it back.
+class hipblasLogRingStack
+{
+public:
+    void push(hipblasLogRing* ring)
+    {
+        ring->next = top.load(std::memory_order_relaxed);
+        while(!top.compare_exchange_weak(
+            ring->next, ring, std::memory_order_release, std::memory_order_relaxed))
+            ;
+    }
+
+    // The rings of the stack, the last pushed first
+    hipblasLogRing* take()
+    {
+        return top.exchange(nullptr, std::memory_order_acquire);
+    }
+
+private:
+    std::atomic<hipblasLogRing*> top{nullptr};
+};
+
+// Ring a thread is logging to
+struct hipblasLogThread
+{
+    hipblasLogRing* ring;
+};
+
+inline float hipblasLogHalfToFloat(uint16_t h)
+{
+    uint32_t sign = uint32_t(h & 0x8000) << 16;
+    uint32_t exp  = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t bits;
+    if(exp == 0x1f)
+        bits = sign | 0x7f800000 | (mant << 13);
+    else if(exp)
+        bits = sign | ((exp + 112) << 23) | (mant << 13);
+    else if(mant)
+    {
+        // normalize the subnormal
+        exp = 113;
+        while(!(mant & 0x400))
+        {
+            mant <<= 1;
+            exp--;
+        }
+        bits = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+    }
+    else
+        bits = sign;
+
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    return f;
+}
+
+// Real and imaginary parts of a logged scalar
+inline void hipblasLogScalarParts(const hipblasLogScalarValue& scalar, double& re, double& im)
+{
+    const unsigned char* bytes = scalar.bytes;
+
+    float    f[2];
+    double   d[2];
+    uint16_t h;
+    int32_t  i;
+    im = 0;
+    switch(scalar.type)
+    {
+    case HIP_R_16F:
+        memcpy(&h, bytes, sizeof(h));
+        re = hipblasLogHalfToFloat(h);
+        break;
+    case HIP_R_16BF:
+    {
+        memcpy(&h, bytes, sizeof(h));
+        uint32_t bits = uint32_t(h) << 16;
+        memcpy(f, &bits, sizeof(float));
+        re = f[0];
+        break;
+    }
+    case HIP_R_32F:
+    case HIP_C_32F:
+        memcpy(f, bytes, sizeof(f));
+        re = f[0];
+        im = scalar.type == HIP_C_32F ? f[1] : 0;
+        break;
+    case HIP_R_32I:
+        memcpy(&i, bytes, sizeof(i));
+        re = i;
+        break;
+    default:
+        memcpy(d, bytes, sizeof(d));
+        re = d[0];
+        im = scalar.type == HIP_C_64F ? d[1] : 0;
+        break;
+    }
+}
+
+inline const char* hipblasLogDatatypeString(int64_t type)
+{
+    switch(hipDataType(type))
+    {
+    case HIP_R_16F:
+        return "f16_r";
+    case HIP_R_32F:
+        return "f32_r";
+    case HIP_R_64F:
+        return "f64_r";
+    case HIP_C_16F:
+        return "f16_c";
+    case HIP_C_32F:
+        return "f32_c";
+    case HIP_C_64F:
+        return "f64_c";
+    case HIP_R_8I:
+        return "i8_r";
+    case HIP_R_8U:
+        return "u8_r";
+    case HIP_R_32I:
+        return "i32_r";
+    case HIP_R_32U:
+        return "u32_r";
+    case HIP_R_16BF:
+        return "bf16_r";
+    case HIP_C_16BF:
+        return "bf16_c";
+    default:
+        return "invalid";
+    }
+}
+
+inline const char* hipblasLogComputetypeString(int64_t type)
+{
+    switch(hipblasComputeType_t(type))
+    {
+    case HIPBLAS_COMPUTE_16F:
+        return "16f";
+    case HIPBLAS_COMPUTE_16F_PEDANTIC:
+        return "16f_pedantic";
+    case HIPBLAS_COMPUTE_32F:
+        return "32f";
+    case HIPBLAS_COMPUTE_32F_PEDANTIC:
+        return "32f_pedantic";
+    case HIPBLAS_COMPUTE_32F_FAST_16F:
+        return "32f_fast_16f";
+    case HIPBLAS_COMPUTE_32F_FAST_16BF:
+        return "32f_fast_16Bf";
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return "32f_fast_tf32";
+    case HIPBLAS_COMPUTE_64F:
+        return "64f";
+    case HIPBLAS_COMPUTE_64F_PEDANTIC:
+        return "64f_pedantic";
+    case HIPBLAS_COMPUTE_32I:
+        return "32i";
+    case HIPBLAS_COMPUTE_32I_PEDANTIC:
+        return "32i_pedantic";
+    default:
+        return "invalid";
+    }
+}
+
+// Letter used by hipblas-bench for an operation, fill mode, diagonal type or side
+inline char hipblasLogModeChar(hipblasLogKind kind, int64_t mode)
+{
+    switch(kind)
+    {
+    case hipblasLogKind::operation:
+        return mode == HIPBLAS_OP_T ? 'T' : mode == HIPBLAS_OP_C ? 'C' : 'N';
+    case hipblasLogKind::fill:
+        return mode == HIPBLAS_FILL_MODE_UPPER ? 'U' : mode == HIPBLAS_FILL_MODE_LOWER ? 'L' : 'F';
+    case hipblasLogKind::diagonal:
+        return mode == HIPBLAS_DIAG_UNIT ? 'U' : 'N';
+    default:
+        return mode == HIPBLAS_SIDE_LEFT ? 'L' : mode == HIPBLAS_SIDE_RIGHT ? 'R' : 'B';
+    }
+}
+
+inline std::string hipblasLogValueString(const hipblasLogValue& value)
+{
+    char buf[64];
+    switch(value.kind)
+    {
+    case hipblasLogKind::integer:
+        snprintf(buf, sizeof(buf), "%lld", (long long)value.integer);
+        break;
+    case hipblasLogKind::pointer:
+        snprintf(buf, sizeof(buf), "%p", value.pointer);
+        break;
+    case hipblasLogKind::scalar:
+    {
+        double re, im;
+        hipblasLogScalarParts(value.scalar, re, im);
+        if(value.scalar.type == HIP_C_32F || value.scalar.type == HIP_C_64F)
+            snprintf(buf, sizeof(buf), "(%.17g,%.17g)", re, im);
+        else
+            snprintf(buf, sizeof(buf), "%.17g", re);
+        break;
+    }
+    case hipblasLogKind::datatype:
+        return hipblasLogDatatypeString(value.integer);
+    case hipblasLogKind::computetype:
+        return hipblasLogComputetypeString(value.integer);
+    default:
+        return std::string(1, hipblasLogModeChar(value.kind, value.integer));
+    }
+    return buf;
+}
+
+// Argument names of a record. The names are the macro arguments as written, so a scalar
+// "hipblasLogScalar(alpha, compute_type)" is reduced to "alpha".
+inline std::vector<std::string> hipblasLogSplitNames(const char* names)
+{
+    std::vector<std::string> result;
+    std::string              name;
+    bool                     in_call = false, first = false;
+    for(const char* c = names;; c++)
+    {
+        if(*c == '(')
+        {
+            in_call = first = true;
+            name.clear();
+        }
+        else if(*c == ')')
+            in_call = false;
+        else if(*c == ',' && in_call)
+            first = false;
+        else if(*c == ',' || !*c)
+        {
+            result.push_back(name);
+            name.clear();
+            if(!*c)
+                return result;
+        }
+        else if(*c != ' ' && (!in_call || first))
+            name += *c;
+    }
+}
+
+// hipblas-bench function and precision of a hipBLAS function, e.g. hipblasCgemmStridedBatched
+// is gemm_strided_batched with precision c. types holds the datatype options of functions mixing
+// real and complex types.
+inline void hipblasLogBenchFunction(const char*  func,
+                                    std::string& function,
+                                    std::string& precision,
+                                    std::string& types)
+{
+    std::string name = func + strlen("hipblas");
+    for(const char* suffix : {"_64", "_v2", "WithFlags"})
+    {
+        size_t pos = name.rfind(suffix);
+        if(pos != std::string::npos && pos + strlen(suffix) == name.size())
+            name.erase(pos);
+    }
+
+    auto is_lower = [&](size_t i) { return i < name.size() && islower(name[i]); };
+    auto follows  = [&](size_t i, const char* s) { return name.compare(i, strlen(s), s) == 0; };
+
+    precision.clear();
+    types.clear();
+    if(name.size() > 2 && name[0] == 'I' && is_lower(1) && follows(2, "am"))
+    {
+        // amax and amin are iamax and iamin in hipblas-bench
+        precision = name[1];
+        name      = "i" + name.substr(2);
+    }
+    else if(name.size() > 2 && (follows(0, "Sc") || follows(0, "Dz"))
+            && (follows(2, "asum") || follows(2, "nrm2")))
+    {
+        precision = name[0] == 'S' ? "c" : "z";
+        name      = name.substr(2);
+    }
+    else if(name.size() > 2 && (follows(0, "Cs") || follows(0, "Zd"))
+            && (follows(2, "scal") || follows(2, "rot")))
+    {
+        precision = name[0] == 'C' ? "c" : "z";
+        name      = name.substr(2);
+        if(follows(0, "rot"))
+            types = name[0] == 'C' ? " --b_type f32_r --c_type f32_r"
+                                   : " --b_type f64_r --c_type f64_r";
+    }
+    else if(follows(0, "Bf") && is_lower(2))
+    {
+        precision = "bf16_r";
+        name      = name.substr(2);
+    }
+    else if(strchr("HSDCZ", name[0]) && is_lower(1))
+    {
+        precision = char(tolower(name[0]));
+        name      = name.substr(1);
+        // complex rot takes real cosines
+        if(precision == "c" && follows(0, "rot") && !follows(0, "rotg"))
+            types = " --b_type f32_r";
+        else if(precision == "z" && follows(0, "rot") && !follows(0, "rotg"))
+            types = " --b_type f64_r";
+    }
+
+    function.clear();
+    for(size_t i = 0; i < name.size(); i++)
+    {
+        if(isupper(name[i]))
+        {
+            if(i)
+                function += '_';
+            function += char(tolower(name[i]));
+        }
+        else
+            function += name[i];
+    }
+}
+
+inline std::string hipblasLogBenchLine(const hipblasLogRecord&        record,
+                                       const std::vector<std::string>& names)
+{
+    static const std::map<std::string, std::string> options = {
+        {"m", "-m"},
+        {"n", "-n"},
+        {"k", "-k"},
+        {"kl", "--kl"},
+        {"ku", "--ku"},
+        {"lda", "--lda"},
+        {"ldb", "--ldb"},
+        {"ldc", "--ldc"},
+        {"ldd", "--ldd"},
+        {"incx", "--incx"},
+        {"incy", "--incy"},
+        {"trans", "--transposeA"},
+        {"transA", "--transposeA"},
+        {"transa", "--transposeA"},
+        {"transB", "--transposeB"},
+        {"transb", "--transposeB"},
+        {"uplo", "--uplo"},
+        {"side", "--side"},
+        {"diag", "--diag"},
+        {"batchCount", "--batch_count"},
+        {"batch_count", "--batch_count"},
+        {"group_count", "--group_count"},
+        {"strideA", "--stride_a"},
+        {"strideAP", "--stride_a"},
+        {"stride_A", "--stride_a"},
+        {"stride_a", "--stride_a"},
+        {"strideB", "--stride_b"},
+        {"stride_B", "--stride_b"},
+        {"stride_b", "--stride_b"},
+        {"strideC", "--stride_c"},
+        {"stride_C", "--stride_c"},
+        {"stride_c", "--stride_c"},
+        {"stridex", "--stride_x"},
+        {"stride_x", "--stride_x"},
+        {"stridey", "--stride_y"},
+        {"stride_y", "--stride_y"},
+        {"algo", "--algo"},
+        {"flags", "--flags"},
+    };
+    static const char* datatype_options[] = {"--a_type", "--b_type", "--c_type", "--d_type"};
+
+    std::string function, precision, args;
+    hipblasLogBenchFunction(record.func, function, precision, args);
+
+    bool v2        = strstr(record.func, "_v2") != nullptr;
+    int  datatypes = 0;
+    for(int i = 0; i < record.count; i++)
+    {
+        const hipblasLogValue& value = record.values[i];
+        const std::string&     name  = names[i];
+        if(value.kind == hipblasLogKind::scalar && (name == "alpha" || name == "beta"))
+        {
+            double re, im;
+            hipblasLogScalarParts(value.scalar, re, im);
+            char buf[96];
+            snprintf(buf, sizeof(buf), " --%s %.17g", name.c_str(), re);
+            args += buf;
+            if(im)
+            {
+                snprintf(buf, sizeof(buf), " --%si %.17g", name.c_str(), im);
+                args += buf;
+            }
+        }
+        else if(value.kind == hipblasLogKind::datatype)
+        {
+            std::string type = hipblasLogValueString(value);
+            if(name == "compute_type" || name == "executionType")
+                args += " --compute_type " + type;
+            else if(datatypes < 4)
+            {
+                args += std::string(" ") + datatype_options[datatypes++] + " " + type;
+                if(precision.empty())
+                    precision = type;
+            }
+        }
+        else if(value.kind == hipblasLogKind::computetype)
+            args += " --compute_type_gemm " + hipblasLogValueString(value);
+        else if(value.kind != hipblasLogKind::pointer && value.kind != hipblasLogKind::scalar)
+        {
+            auto option = options.find(name);
+            if(option != options.end())
+                args += " " + option->second + " " + hipblasLogValueString(value);
+        }
+    }
+
+    std::string line = v2 ? "hipblas_v2-bench -f " : "hipblas-bench -f ";
+    line += function;
+    if(!precision.empty())
+        line += " -r " + precision;
+    return line + args;
+}
+
+/*
+ * ===========================================================================
+ *    Output
+ * ===========================================================================
+ */
+
+// Owner of the output files and of the profile. Full rings are handed to a writer thread through
+// a lock-free stack; the rings of the threads still logging are written when the process exits.
+class hipblasLogSink
+{
+public:
+    static hipblasLogSink& get()
+    {
+        static hipblasLogSink sink;
+        return sink;
+    }
+
+    void add(hipblasLogThread* thread)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.push_back(thread);
+    }
+
+    // Hand the ring of an exiting thread to the writer
+    void remove(hipblasLogThread* thread)
+    {
+        full.push(thread->ring);
+        wake.notify_one();
+        std::lock_guard<std::mutex> lock(mutex);
+        threads.erase(std::find(threads.begin(), threads.end(), thread));
+    }
+
+    // Hand a full ring to the writer and return an empty one, without taking a lock
+    hipblasLogRing* hand_off(hipblasLogRing* ring)
+    {
+        full.push(ring);
+        wake.notify_one();
+
+        hipblasLogRing* spare = empty.take();
+        if(!spare)
+            return new hipblasLogRing;
+        for(hipblasLogRing *rest = spare->next, *next; rest; rest = next)
+        {
+            next = rest->next;
+            empty.push(rest);
+        }
+        spare->head.store(0, std::memory_order_relaxed);
+        return spare;
+    }
+
+private:
+    struct profile_entry
+    {
+        uint64_t count   = 0;
+        int64_t  time_ns = 0;
+    };
+
+    std::mutex                                     mutex;
+    std::condition_variable                        wake;
+    bool                                           stopping = false;
+    std::vector<hipblasLogThread*>                 threads;
+    hipblasLogRingStack                            full;
+    hipblasLogRingStack                            empty;
+    std::map<const char*, std::vector<std::string>> names;
+    std::map<std::string, profile_entry>           profile;
+    FILE*                                          trace_file;
+    FILE*                                          bench_file;
+    FILE*                                          profile_file;
+    std::thread                                    writer;
+
+    static FILE* open(const char* env)
+    {
+        const char* path = getenv(env);
+        FILE*       file = path ? fopen(path, "w") : nullptr;
+        return file ? file : stderr;
+    }
+
+    hipblasLogSink()
+    {
+        uint32_t mode = hipblasLayerModeFromEnv();
+        trace_file = mode & hipblasLayerModeTrace ? open("HIPBLAS_LOG_TRACE_PATH") : stderr;
+        bench_file = mode & hipblasLayerModeBench ? open("HIPBLAS_LOG_BENCH_PATH") : stderr;
+        profile_file
+            = mode & hipblasLayerModeProfile ? open("HIPBLAS_LOG_PROFILE_PATH") : stderr;
+        writer = std::thread([this] { run(); });
+    }
+
+    ~hipblasLogSink()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        wake.notify_one();
+        if(writer.joinable())
+            writer.join();
+
+        write_full();
+        for(hipblasLogThread* thread : threads)
+            write(*thread->ring);
+        fflush(trace_file);
+        fflush(bench_file);
+
+        // Signatures taking the most time first
+        std::vector<std::pair<std::string, profile_entry>> entries(profile.begin(),
+                                                                  profile.end());
+        std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+            return a.second.time_ns > b.second.time_ns;
+        });
+        for(const auto& entry : entries)
+            fprintf(profile_file,
+                    "- { %s, call_count: %llu, total_time_us: %.3f }\n",
+                    entry.first.c_str(),
+                    (unsigned long long)entry.second.count,
+                    entry.second.time_ns * 1e-3);
+        fflush(profile_file);
+
+        for(FILE* file : {trace_file, bench_file, profile_file})
+            if(file != stderr)
+                fclose(file);
+
+        for(hipblasLogRing *ring = empty.take(), *next; ring; ring = next)
+        {
+            next = ring->next;
+            delete ring;
+        }
+    }
+
+    // Write the rings handed off, waking when one is. A wake-up missed between the check and
+    // the wait is caught by the timeout.
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while(!stopping)
+        {
+            write_full();
+            wake.wait_for(lock, std::chrono::milliseconds(100));
+        }
+    }
+
+    // Write the full rings in the order they were handed off and recycle them
+    void write_full()
+    {
+        hipblasLogRing* rings = nullptr;
+        for(hipblasLogRing *ring = full.take(), *next; ring; ring = next)
+        {
+            next       = ring->next;
+            ring->next = rings;
+            rings      = ring;
+        }
+        if(!rings)
+            return;
+
+        for(hipblasLogRing *ring = rings, *next; ring; ring = next)
+        {
+            next = ring->next;
+            write(*ring);
+            empty.push(ring);
+        }
+        fflush(trace_file);
+        fflush(bench_file);
+    }
+
+    // Format and write the published records of a ring
+    void write(const hipblasLogRing& ring)
+    {
+        uint64_t head = ring.head.load(std::memory_order_acquire);
+        for(uint64_t i = 0; i < head; i++)
+            write(ring.records[i]);
+    }
+
+    void write(const hipblasLogRecord& record)
+    {
+        auto it = names.find(record.names);
+        if(it == names.end())
+            it = names.emplace(record.names, hipblasLogSplitNames(record.names)).first;
+        const std::vector<std::string>& arg_names = it->second;
+
+        if(record.layers & hipblasLayerModeTrace)
+        {
+            std::string line = record.func;
+            for(int i = 0; i < record.count; i++)
+                line += "," + hipblasLogValueString(record.values[i]);
+            fprintf(trace_file, "%s\n", line.c_str());
+        }
+
+        if(record.layers & hipblasLayerModeBench)
+            fprintf(bench_file, "%s\n", hipblasLogBenchLine(record, arg_names).c_str());
+
+        if(record.layers & hipblasLayerModeProfile)
+        {
+            // Pointers differ between otherwise identical calls, so they are left out
+            std::string signature = std::string("function: ") + record.func;
+            for(int i = 0; i < record.count; i++)
+                if(record.values[i].kind != hipblasLogKind::pointer)
+                    signature
+                        += ", " + arg_names[i] + ": " + hipblasLogValueString(record.values[i]);
+
+            profile_entry& entry = profile[signature];
+            entry.count++;
+            entry.time_ns += record.time_ns;
+        }
+    }
+};
+
+// Logging state of the calling thread, whose ring is written when the thread exits
+inline hipblasLogThread& hipblasGetLogThread()
+{
+    struct thread_state
+    {
+        hipblasLogThread thread{new hipblasLogRing};
+
+        thread_state()
+        {
+            hipblasLogSink::get().add(&thread);
+        }
+        ~thread_state()
+        {
+            hipblasLogSink::get().remove(&thread);
+        }
+    };
+    thread_local thread_state state;
+    return state.thread;
+}
+
+/*
+ * ===========================================================================
+ *    Logger
+ * ===========================================================================
+ */
+
+// Records one call. Calls made by hipBLAS itself while a call is being logged (for example a
+// _64 function forwarding to its 32-bit version) are not logged again.
+class hipblasLogger
+{
+public:
+    explicit hipblasLogger(uint32_t layers)
+        : layers(layers && !depth() ? layers : 0)
+    {
+        if(this->layers)
+            depth()++;
+    }
+
+    ~hipblasLogger()
+    {
+        if(!layers)
+            return;
+
+        if(layers & hipblasLayerModeProfile)
+            ring->records[head % hipblasLogRing::capacity].time_ns
+                = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                      std::chrono::steady_clock::now() - start)
+                      .count();
+        ring->head.store(head + 1, std::memory_order_release);
+        depth()--;
+    }
+
+    explicit operator bool() const
+    {
+        return layers != 0;
+    }
+
+    // Scalars are logged by value when the handle is in host pointer mode
+    template <typename... Args>
+    void record(hipblasPointerMode_t mode, const char* func, const char* names, Args... args)
+    {
+        static_assert(sizeof...(Args) <= hipblasLogMaxArgs, "too many logged arguments");
+
+        hipblasLogThread& thread = hipblasGetLogThread();
+        if(thread.ring->head.load(std::memory_order_relaxed) == hipblasLogRing::capacity)
+            thread.ring = hipblasLogSink::get().hand_off(thread.ring);
+        ring = thread.ring;
+        head = ring->head.load(std::memory_order_relaxed);
+
+        bool host_scalars = mode == HIPBLAS_POINTER_MODE_HOST;
+
+        hipblasLogRecord& record = ring->records[head % hipblasLogRing::capacity];
+        record.func              = func;
+        record.names             = names;
+        record.layers            = layers;
+        record.count             = sizeof...(Args);
+        record.time_ns           = 0;
+
+        int i = 0;
+        ((record.values[i++] = hipblasLogCapture(host_scalars, args)), ...);
+
+        if(layers & hipblasLayerModeProfile)
+            start = std::chrono::steady_clock::now();
+    }
+
+private:
+    uint32_t                              layers;
+    hipblasLogRing*                       ring = nullptr;
+    uint64_t                              head = 0;
+    std::chrono::steady_clock::time_point start;
+
+    static int& depth()
+    {
+        thread_local int depth = 0;
+        return depth;
+    }
+};
+
+// Log a call to the layers enabled on its handle. Used as the first statement of a function
+// with a hipblasHandle_t named handle, through a HIPBLAS_LOG macro naming the backend handle
+// type. Nothing but the handle's layer mode is read when logging is off, and the backend is
+// not called when it is on.
+#define HIPBLAS_LOG_CALL(BackendHandle, ...)                                                       \
+    hipblasLogger hipblas_logger_(                                                                 \
+        handle ? hipblasGetHandleState<BackendHandle>(handle).layer_mode : 0);                     \
+    if(hipblas_logger_)                                                                            \
+    hipblas_logger_.record(hipblasGetHandleState<BackendHandle>(handle).pointer_mode,              \
+                           __func__,                                                               \
+                           #__VA_ARGS__,                                                           \
+                           __VA_ARGS__)
@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "hipblas.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+// Pinned host memory and device memory that host arrays of batch pointers are copied through,
+// for handles in HIPBLAS_BATCH_POINTER_MODE_HOST. Each call takes the oldest slot of the ring and
+// queues the upload on the handle's stream, so the calling thread can reuse its arrays as soon as
+// the call returns. While the oldest slot's upload is still queued, a slot is added, up to
+// max_slots; then the call waits for that upload, queued max_slots calls earlier. The cuBLAS
+// backend also reads device arrays of batch pointers back through the pinned memory of a slot.
+class hipblasStagingRing
+{
+public:
+    hipblasStagingRing() = default;
+
+    hipblasStagingRing(const hipblasStagingRing&) = delete;
+    hipblasStagingRing& operator=(const hipblasStagingRing&) = delete;
+
+    ~hipblasStagingRing()
+    {
+        for(Slot& slot : slots)
+        {
+            release(slot);
+            if(slot.event)
+                (void)hipEventDestroy(slot.event);
+        }
+        if(fence)
+            (void)hipEventDestroy(fence);
+    }
+
+    // Called when the handle moves off stream. Device memory of the ring may still be read by
+    // work queued on stream, so the next upload, on the new stream, waits for that work there.
+    hipblasStatus_t leave(hipStream_t stream)
+    {
+        if(slots.empty() || stream != last_stream)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!fence && hipEventCreateWithFlags(&fence, hipEventDisableTiming) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(hipEventRecord(fence, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        fenced = true;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Copy the batch_count pointers of each host array to the device and replace the array with
+    // its device copy. Null arrays are left as they are, for the backend to report.
+    template <typename... Arrays>
+    hipblasStatus_t stage(hipStream_t stream, int64_t batch_count, Arrays*&... arrays)
+    {
+        if(batch_count <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        const void*     host[] = {arrays...};
+        void*           device[sizeof...(Arrays)];
+        hipblasStatus_t status
+            = upload(stream, sizeof(void*) * batch_count, sizeof...(Arrays), host, device);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            size_t i = 0;
+            ((arrays = static_cast<Arrays*>(device[i++])), ...);
+        }
+        return status;
+    }
+
+    // Copy the batch_count pointers of each device array to pinned host memory, in order with
+    // the work queued on stream, and replace the array with its host copy. Only the copy is
+    // waited for, through the slot's event. Null arrays are left as they are.
+    template <typename... Arrays>
+    hipblasStatus_t fetch(hipStream_t stream, int64_t batch_count, Arrays*&... arrays)
+    {
+        if(batch_count <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        const void*     device[] = {arrays...};
+        void*           host[sizeof...(Arrays)];
+        hipblasStatus_t status
+            = download(stream, sizeof(void*) * batch_count, sizeof...(Arrays), device, host);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            size_t i = 0;
+            ((arrays = static_cast<Arrays*>(host[i++])), ...);
+        }
+        return status;
+    }
+
+private:
+    static constexpr size_t max_slots  = 8;
+    static constexpr size_t slot_bytes = 64 * 1024;
+
+    struct Slot
+    {
+        char*      host   = nullptr;
+        char*      device = nullptr;
+        size_t     size   = 0;
+        hipEvent_t event  = nullptr;
+    };
+
+    std::vector<Slot> slots;
+    size_t            next        = 0; // oldest slot
+    hipStream_t       last_stream = nullptr;
+    hipEvent_t        fence       = nullptr; // end of the work on the stream the handle left
+    bool              fenced      = false;
+
+    static void release(Slot& slot)
+    {
+        if(slot.host)
+            (void)hipHostFree(slot.host);
+        if(slot.device)
+            (void)hipFree(slot.device);
+        slot.host   = nullptr;
+        slot.device = nullptr;
+        slot.size   = 0;
+    }
+
+    // Oldest slot once its upload is done, or a new slot, inserted before it, while the ring is
+    // smaller than max_slots. The uploads of a stream finish in order, so when the oldest is
+    // busy the others are too.
+    hipblasStatus_t acquire(Slot** slot)
+    {
+        if(!slots.empty())
+        {
+            Slot&      oldest = slots[next];
+            hipError_t ready  = hipEventQuery(oldest.event);
+            if(ready == hipErrorNotReady && slots.size() >= max_slots)
+                ready = hipEventSynchronize(oldest.event);
+            if(ready == hipSuccess)
+            {
+                *slot = &oldest;
+                next  = (next + 1) % slots.size();
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+            if(ready != hipErrorNotReady)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        Slot added;
+        if(hipEventCreateWithFlags(&added.event, hipEventDisableTiming) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        slots.insert(slots.begin() + next, added);
+        *slot = &slots[next];
+        next  = (next + 1) % slots.size();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Slot of at least size bytes for a copy on stream
+    hipblasStatus_t reserve(hipStream_t stream, size_t size, Slot** reserved)
+    {
+        // The ring relies on stream order to reuse device memory that earlier calls may still
+        // be reading, so on a new stream it first waits for the work of the stream it left
+        if(stream != last_stream)
+        {
+            if(fenced && hipStreamWaitEvent(stream, fence, 0) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            fenced      = false;
+            last_stream = stream;
+        }
+
+        Slot*           slot;
+        hipblasStatus_t status = acquire(&slot);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Growing frees the old device memory, which hipFree only does once the device is idle
+        if(size > slot->size)
+        {
+            release(*slot);
+            size_t capacity = std::max(size, slot_bytes);
+            if(hipHostMalloc((void**)&slot->host, capacity) != hipSuccess
+               || hipMalloc((void**)&slot->device, capacity) != hipSuccess)
+            {
+                release(*slot);
+                return HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            slot->size = capacity;
+        }
+        *reserved = slot;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t
+        upload(hipStream_t stream, size_t bytes, size_t count, const void** host, void** device)
+    {
+        size_t          size = bytes * count;
+        Slot*           slot;
+        hipblasStatus_t status = reserve(stream, size, &slot);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(size_t i = 0; i < count; i++)
+        {
+            device[i] = host[i] ? slot->device + i * bytes : nullptr;
+            if(host[i])
+                memcpy(slot->host + i * bytes, host[i], bytes);
+        }
+        if(hipMemcpyAsync(slot->device, slot->host, size, hipMemcpyHostToDevice, stream)
+               != hipSuccess
+           || hipEventRecord(slot->event, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t
+        download(hipStream_t stream, size_t bytes, size_t count, const void** device, void** host)
+    {
+        Slot*           slot;
+        hipblasStatus_t status = reserve(stream, bytes * count, &slot);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(size_t i = 0; i < count; i++)
+        {
+            host[i] = device[i] ? slot->host + i * bytes : nullptr;
+            if(device[i]
+               && hipMemcpyAsync(host[i], device[i], bytes, hipMemcpyDefault, stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        if(hipEventRecord(slot->event, stream) != hipSuccess
+           || hipEventSynchronize(slot->event) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+};
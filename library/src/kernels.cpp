@@ -0,0 +1,704 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "kernels.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <hip/hip_bfloat16.h>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+#include <type_traits>
+
+namespace
+{
+    constexpr int block_dim   = 16;
+    constexpr int reduce_size = 256;
+    constexpr int max_grid_z  = 65535;
+
+    /*
+     * ===========================================================================
+     *    Element helpers
+     * ===========================================================================
+     */
+
+    template <typename To>
+    __device__ To convert_element(float x);
+    template <typename To>
+    __device__ To convert_element(double x);
+    template <typename To>
+    __device__ To convert_element(hipFloatComplex x);
+    template <typename To>
+    __device__ To convert_element(hipDoubleComplex x);
+
+    template <>
+    __device__ float convert_element<float>(float x)
+    {
+        return x;
+    }
+    template <>
+    __device__ double convert_element<double>(float x)
+    {
+        return x;
+    }
+    template <>
+    __device__ float convert_element<float>(double x)
+    {
+        return float(x);
+    }
+    template <>
+    __device__ double convert_element<double>(double x)
+    {
+        return x;
+    }
+    template <>
+    __device__ hipFloatComplex convert_element<hipFloatComplex>(hipFloatComplex x)
+    {
+        return x;
+    }
+    template <>
+    __device__ hipDoubleComplex convert_element<hipDoubleComplex>(hipFloatComplex x)
+    {
+        return hipComplexFloatToDouble(x);
+    }
+    template <>
+    __device__ hipFloatComplex convert_element<hipFloatComplex>(hipDoubleComplex x)
+    {
+        return hipComplexDoubleToFloat(x);
+    }
+    template <>
+    __device__ hipDoubleComplex convert_element<hipDoubleComplex>(hipDoubleComplex x)
+    {
+        return x;
+    }
+
+    // Whether x has a part too large for single precision
+    __device__ bool exceeds_float(float)
+    {
+        return false;
+    }
+    __device__ bool exceeds_float(double x)
+    {
+        return fabs(x) > FLT_MAX;
+    }
+    __device__ bool exceeds_float(hipFloatComplex)
+    {
+        return false;
+    }
+    __device__ bool exceeds_float(hipDoubleComplex x)
+    {
+        return fabs(hipCreal(x)) > FLT_MAX || fabs(hipCimag(x)) > FLT_MAX;
+    }
+
+    __device__ float add_element(float x, float y)
+    {
+        return x + y;
+    }
+    __device__ double add_element(double x, double y)
+    {
+        return x + y;
+    }
+    __device__ hipFloatComplex add_element(hipFloatComplex x, hipFloatComplex y)
+    {
+        return hipCaddf(x, y);
+    }
+    __device__ hipDoubleComplex add_element(hipDoubleComplex x, hipDoubleComplex y)
+    {
+        return hipCadd(x, y);
+    }
+
+    __device__ double abs_element(float x)
+    {
+        return fabs(x);
+    }
+    __device__ double abs_element(double x)
+    {
+        return fabs(x);
+    }
+    __device__ double abs_element(hipFloatComplex x)
+    {
+        return hipCabsf(x);
+    }
+    __device__ double abs_element(hipDoubleComplex x)
+    {
+        return hipCabs(x);
+    }
+
+    // Real GEMM results are loaded in single precision, or in double precision for double
+    template <typename Tf>
+    __device__ Tf load_real(__half x)
+    {
+        return __half2float(x);
+    }
+    template <typename Tf>
+    __device__ Tf load_real(hip_bfloat16 x)
+    {
+        return float(x);
+    }
+    template <typename Tf>
+    __device__ Tf load_real(float x)
+    {
+        return x;
+    }
+    template <typename Tf>
+    __device__ Tf load_real(double x)
+    {
+        return x;
+    }
+
+    template <typename To, typename Tf>
+    __device__ To store_real(Tf x)
+    {
+        if constexpr(std::is_same<To, __half>{})
+            return __float2half(float(x));
+        else if constexpr(std::is_same<To, hip_bfloat16>{})
+            return hip_bfloat16(float(x));
+        else
+            return To(x);
+    }
+
+    template <typename Tf>
+    __device__ Tf activate(Tf x, hipblasActivation_t activation)
+    {
+        switch(activation)
+        {
+        case HIPBLAS_ACTIVATION_RELU:
+            return x > 0 ? x : Tf(0);
+        case HIPBLAS_ACTIVATION_GELU:
+            // tanh approximation, sqrt(2 / pi) = 0.7978845608...
+            return Tf(0.5) * x
+                   * (Tf(1) + tanh(Tf(0.7978845608028654) * (x + Tf(0.044715) * x * x * x)));
+        default:
+            return x;
+        }
+    }
+
+    // Largest value of every thread's v in the block, returned to all threads
+    __device__ double block_max(double v, double* shared)
+    {
+        shared[threadIdx.x] = v;
+        __syncthreads();
+        for(int s = blockDim.x / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+                shared[threadIdx.x] = fmax(shared[threadIdx.x], shared[threadIdx.x + s]);
+            __syncthreads();
+        }
+        v = shared[0];
+        __syncthreads();
+        return v;
+    }
+
+    /*
+     * ===========================================================================
+     *    Kernels
+     * ===========================================================================
+     */
+
+    __global__ void build_pointers_kernel(
+        char* base, size_t elem_size, hipblasStride stride, int batch_count, void** A)
+    {
+        for(int b = blockIdx.x * blockDim.x + threadIdx.x; b < batch_count;
+            b += gridDim.x * blockDim.x)
+            A[b] = base + b * stride * elem_size;
+    }
+
+    __global__ void gather_pointers_kernel(char*         base,
+                                           size_t        elem_size,
+                                           hipblasStride stride,
+                                           const int*    indices,
+                                           int           batch_count,
+                                           void**        A)
+    {
+        for(int b = blockIdx.x * blockDim.x + threadIdx.x; b < batch_count;
+            b += gridDim.x * blockDim.x)
+            A[b] = base + indices[b] * stride * elem_size;
+    }
+
+    template <typename Ti, typename To>
+    __global__ void convert_matrix_kernel(int              m,
+                                          int              n,
+                                          const Ti* const* A,
+                                          int              lda,
+                                          To* const*       B,
+                                          int              ldb,
+                                          int*             overflow,
+                                          int              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            Ti a = A[b][i + size_t(j) * lda];
+            if(overflow && exceeds_float(a))
+                overflow[b] = -2;
+            B[b][i + size_t(j) * ldb] = convert_element<To>(a);
+        }
+    }
+
+    template <typename Ti, typename To>
+    __global__ void add_converted_matrix_kernel(int              m,
+                                                int              n,
+                                                const Ti* const* A,
+                                                int              lda,
+                                                To* const*       B,
+                                                int              ldb,
+                                                const int*       active,
+                                                int              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(!active[b])
+                continue;
+            To& y = B[b][i + size_t(j) * ldb];
+            y     = add_element(y, convert_element<To>(A[b][i + size_t(j) * lda]));
+        }
+    }
+
+    template <typename T>
+    __global__ void
+        norm_inf_kernel(int n, const T* const* A, int lda, double* norm, int batch_count)
+    {
+        __shared__ double shared[reduce_size];
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            double row_max = 0;
+            for(int i = threadIdx.x; i < n; i += blockDim.x)
+            {
+                double sum = 0;
+                for(int j = 0; j < n; j++)
+                    sum += abs_element(A[b][i + size_t(j) * lda]);
+                row_max = fmax(row_max, sum);
+            }
+            row_max = block_max(row_max, shared);
+            if(threadIdx.x == 0)
+                norm[b] = row_max;
+        }
+    }
+
+    template <typename T>
+    __global__ void refinement_converged_kernel(int             n,
+                                                int             nrhs,
+                                                const T* const* R,
+                                                int             ldr,
+                                                const T* const* X,
+                                                int             ldx,
+                                                const double*   norm,
+                                                double          tolerance,
+                                                int*            converged,
+                                                int             batch_count)
+    {
+        __shared__ double shared[reduce_size];
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            bool done = true;
+            for(int j = 0; j < nrhs && done; j++)
+            {
+                double r_max = 0, x_max = 0;
+                for(int i = threadIdx.x; i < n; i += blockDim.x)
+                {
+                    r_max = fmax(r_max, abs_element(R[b][i + size_t(j) * ldr]));
+                    x_max = fmax(x_max, abs_element(X[b][i + size_t(j) * ldx]));
+                }
+                r_max = block_max(r_max, shared);
+                x_max = block_max(x_max, shared);
+                done  = r_max <= x_max * norm[b] * tolerance;
+            }
+            if(threadIdx.x == 0)
+                converged[b] = done;
+        }
+    }
+
+    __global__ void refinement_step_kernel(
+        int it, int max_iterations, const int* converged, int* active, int* iter, int batch_count)
+    {
+        for(int b = blockIdx.x * blockDim.x + threadIdx.x; b < batch_count;
+            b += gridDim.x * blockDim.x)
+        {
+            if(!active[b])
+                continue;
+            if(converged[b])
+            {
+                iter[b]   = it - 1;
+                active[b] = 0;
+            }
+            else if(it > max_iterations)
+            {
+                iter[b]   = -max_iterations - 1;
+                active[b] = 0;
+            }
+        }
+    }
+
+    template <typename Tc, typename Td>
+    __global__ void gemm_epilogue_kernel(int                    m,
+                                         int                    n,
+                                         const Tc*              C,
+                                         int                    ldc,
+                                         hipblasStride          stride_c,
+                                         hipblasEpilogueScale_t scale_mode,
+                                         const Tc*              scale,
+                                         hipblasStride          stride_scale,
+                                         const Tc*              bias,
+                                         hipblasStride          stride_bias,
+                                         hipblasActivation_t    activation,
+                                         Td*                    D,
+                                         int                    ldd,
+                                         hipblasStride          stride_d,
+                                         int                    batch_count)
+    {
+        using Tf = std::conditional_t<std::is_same<Tc, double>{}, double, float>;
+
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            Tf x = load_real<Tf>(C[b * stride_c + i + size_t(j) * ldc]);
+            if(scale_mode == HIPBLAS_EPILOGUE_SCALE_ROW)
+                x *= load_real<Tf>(scale[b * stride_scale + i]);
+            else if(scale_mode == HIPBLAS_EPILOGUE_SCALE_COLUMN)
+                x *= load_real<Tf>(scale[b * stride_scale + j]);
+            if(bias)
+                x += load_real<Tf>(bias[b * stride_bias + i]);
+            D[b * stride_d + i + size_t(j) * ldd] = store_real<Td>(activate(x, activation));
+        }
+    }
+
+    dim3 matrix_grid(int m, int n, int batch_count)
+    {
+        return dim3((m - 1) / block_dim + 1,
+                    (n - 1) / block_dim + 1,
+                    std::min(batch_count, max_grid_z));
+    }
+}
+
+/*
+ * ===========================================================================
+ *    Launchers
+ * ===========================================================================
+ */
+
+hipError_t hipblasBuildPointersLaunch(hipStream_t   stream,
+                                      void*         base,
+                                      size_t        elem_size,
+                                      hipblasStride stride,
+                                      int           batch_count,
+                                      void**        A)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    int blocks = std::min((batch_count - 1) / reduce_size + 1, max_grid_z);
+    hipLaunchKernelGGL(build_pointers_kernel,
+                       dim3(blocks),
+                       dim3(reduce_size),
+                       0,
+                       stream,
+                       static_cast<char*>(base),
+                       elem_size,
+                       stride,
+                       batch_count,
+                       A);
+    return hipGetLastError();
+}
+
+hipError_t hipblasGatherPointersLaunch(hipStream_t   stream,
+                                       void*         base,
+                                       size_t        elem_size,
+                                       hipblasStride stride,
+                                       const int*    indices,
+                                       int           batch_count,
+                                       void**        A)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    int blocks = std::min((batch_count - 1) / reduce_size + 1, max_grid_z);
+    hipLaunchKernelGGL(gather_pointers_kernel,
+                       dim3(blocks),
+                       dim3(reduce_size),
+                       0,
+                       stream,
+                       static_cast<char*>(base),
+                       elem_size,
+                       stride,
+                       indices,
+                       batch_count,
+                       A);
+    return hipGetLastError();
+}
+
+template <typename Ti, typename To>
+hipError_t hipblasConvertMatrixLaunch(hipStream_t      stream,
+                                      int              m,
+                                      int              n,
+                                      const Ti* const* A,
+                                      int              lda,
+                                      To* const*       B,
+                                      int              ldb,
+                                      int*             overflow,
+                                      int              batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL((convert_matrix_kernel<Ti, To>),
+                       matrix_grid(m, n, batch_count),
+                       dim3(block_dim, block_dim),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       overflow,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename Ti, typename To>
+hipError_t hipblasAddConvertedMatrixLaunch(hipStream_t      stream,
+                                           int              m,
+                                           int              n,
+                                           const Ti* const* A,
+                                           int              lda,
+                                           To* const*       B,
+                                           int              ldb,
+                                           const int*       active,
+                                           int              batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL((add_converted_matrix_kernel<Ti, To>),
+                       matrix_grid(m, n, batch_count),
+                       dim3(block_dim, block_dim),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       active,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblasNormInfLaunch(
+    hipStream_t stream, int n, const T* const* A, int lda, double* norm, int batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL((norm_inf_kernel<T>),
+                       dim3(std::min(batch_count, max_grid_z)),
+                       dim3(reduce_size),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       norm,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblasRefinementConvergedLaunch(hipStream_t     stream,
+                                            int             n,
+                                            int             nrhs,
+                                            const T* const* R,
+                                            int             ldr,
+                                            const T* const* X,
+                                            int             ldx,
+                                            const double*   norm,
+                                            double          tolerance,
+                                            int*            converged,
+                                            int             batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL((refinement_converged_kernel<T>),
+                       dim3(std::min(batch_count, max_grid_z)),
+                       dim3(reduce_size),
+                       0,
+                       stream,
+                       n,
+                       nrhs,
+                       R,
+                       ldr,
+                       X,
+                       ldx,
+                       norm,
+                       tolerance,
+                       converged,
+                       batch_count);
+    return hipGetLastError();
+}
+
+hipError_t hipblasRefinementStepLaunch(hipStream_t stream,
+                                       int         it,
+                                       int         max_iterations,
+                                       const int*  converged,
+                                       int*        active,
+                                       int*        iter,
+                                       int         batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    int blocks = std::min((batch_count - 1) / reduce_size + 1, max_grid_z);
+    hipLaunchKernelGGL(refinement_step_kernel,
+                       dim3(blocks),
+                       dim3(reduce_size),
+                       0,
+                       stream,
+                       it,
+                       max_iterations,
+                       converged,
+                       active,
+                       iter,
+                       batch_count);
+    return hipGetLastError();
+}
+
+hipError_t hipblasGemmEpilogueLaunch(hipStream_t                  stream,
+                                     int                          m,
+                                     int                          n,
+                                     const void*                  C,
+                                     hipDataType                  c_type,
+                                     int                          ldc,
+                                     hipblasStride                stride_c,
+                                     const hipblasGemmEpilogue_t& epilogue,
+                                     void*                        D,
+                                     hipDataType                  d_type,
+                                     int                          ldd,
+                                     hipblasStride                stride_d,
+                                     int                          batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // The type tags select the instantiation of the kernel for c_type and d_type
+    auto launch = [&](auto c_tag, auto d_tag) {
+        using Tc = decltype(c_tag);
+        using Td = decltype(d_tag);
+        hipLaunchKernelGGL((gemm_epilogue_kernel<Tc, Td>),
+                           matrix_grid(m, n, batch_count),
+                           dim3(block_dim, block_dim),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           static_cast<const Tc*>(C),
+                           ldc,
+                           stride_c,
+                           epilogue.scaleMode,
+                           static_cast<const Tc*>(epilogue.scale),
+                           epilogue.strideScale,
+                           static_cast<const Tc*>(epilogue.bias),
+                           epilogue.strideBias,
+                           epilogue.activation,
+                           static_cast<Td*>(D),
+                           ldd,
+                           stride_d,
+                           batch_count);
+        return hipGetLastError();
+    };
+    auto launch_c = [&](auto d_tag) {
+        switch(c_type)
+        {
+        case HIP_R_16F:
+            return launch(__half{}, d_tag);
+        case HIP_R_16BF:
+            return launch(hip_bfloat16{}, d_tag);
+        case HIP_R_32F:
+            return launch(float{}, d_tag);
+        case HIP_R_64F:
+            return launch(double{}, d_tag);
+        default:
+            return hipErrorInvalidValue;
+        }
+    };
+
+    switch(d_type)
+    {
+    case HIP_R_16F:
+        return launch_c(__half{});
+    case HIP_R_16BF:
+        return launch_c(hip_bfloat16{});
+    case HIP_R_32F:
+        return launch_c(float{});
+    case HIP_R_64F:
+        return launch_c(double{});
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+#define INSTANTIATE_CONVERT(Ti_, To_)                                                           \
+    template hipError_t hipblasConvertMatrixLaunch<Ti_, To_>(                                   \
+        hipStream_t, int, int, const Ti_* const*, int, To_* const*, int, int*, int);            \
+    template hipError_t hipblasAddConvertedMatrixLaunch<Ti_, To_>(                              \
+        hipStream_t, int, int, const Ti_* const*, int, To_* const*, int, const int*, int);
+
+INSTANTIATE_CONVERT(double, float)
+INSTANTIATE_CONVERT(float, double)
+INSTANTIATE_CONVERT(double, double)
+INSTANTIATE_CONVERT(hipDoubleComplex, hipFloatComplex)
+INSTANTIATE_CONVERT(hipFloatComplex, hipDoubleComplex)
+INSTANTIATE_CONVERT(hipDoubleComplex, hipDoubleComplex)
+
+#define INSTANTIATE_REDUCE(T_)                                                                  \
+    template hipError_t hipblasNormInfLaunch<T_>(                                               \
+        hipStream_t, int, const T_* const*, int, double*, int);                                 \
+    template hipError_t hipblasRefinementConvergedLaunch<T_>(hipStream_t,                       \
+                                                             int,                               \
+                                                             int,                               \
+                                                             const T_* const*,                  \
+                                                             int,                               \
+                                                             const T_* const*,                  \
+                                                             int,                               \
+                                                             const double*,                     \
+                                                             double,                            \
+                                                             int*,                              \
+                                                             int);
+
+INSTANTIATE_REDUCE(double)
+INSTANTIATE_REDUCE(hipDoubleComplex)